@@ -0,0 +1,121 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+//
+// Thread-scaling benchmark of parallel matrix assembly: the ranged walk (Walker::walk(true), where
+// every scalar add_to_entry takes the container's striped lock) against the colored walk
+// (Walker::walk_colored(), where no two concurrently processed elements share a DoF, so the
+// containers skip their locks, see XT::Common::ConflictFreeScope). Both are run for a continuous
+// Lagrange P2 Laplace form and a DG P1 form with interior penalty coupling on a 2d YaspGrid, on
+// 1, 2, 4, ... threads (see Benchmark::thread_counts()). The coloring is computed once per grid,
+// outside of the timed region. The speedup w.r.t. the respective single-threaded run is printed
+// after the sweep.
+
+#include "config.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/parallel/partitioning/colored.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/walker.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/integrands/ipdg.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+#include "benchmark_common.hh"
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+namespace {
+
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using I = XT::Grid::extract_intersection_t<GV>;
+using M = XT::LA::IstlRowMajorSparseMatrix<double>;
+
+
+template <class SpaceType>
+void run_for_space(ankerl::nanobench::Bench& bench, const std::string& space_tag, const SpaceType& space)
+{
+  const bool coupling = !space.continuous(0);
+  const XT::Grid::ColoredPartitioning<GV> coloring(space.grid_view(), /*include_face_neighbors=*/coupling);
+  const auto assemble = [&](const bool colored) {
+    auto form = make_bilinear_form(space.grid_view());
+    form += LocalElementIntegralBilinearForm<E>(LocalLaplaceIntegrand<E>());
+    if (coupling)
+      form += {LocalCouplingIntersectionIntegralBilinearForm<I>(LocalIPDGIntegrands::InnerPenalty<I>(8.)),
+               XT::Grid::ApplyOn::InnerIntersectionsOnce<GV>()};
+    auto matrix_op = make_matrix_operator<M>(space);
+    matrix_op.append(form);
+    auto walker = XT::Grid::make_walker(space.grid_view());
+    walker.append(matrix_op);
+    if (colored)
+      walker.walk_colored(coloring);
+    else
+      walker.walk(/*use_tbb=*/true);
+    ankerl::nanobench::doNotOptimizeAway(matrix_op.matrix().sup_norm());
+  };
+  for (const std::string mode : {"ranged", "colored"}) {
+    for (const size_t threads : Benchmark::thread_counts()) {
+      const Benchmark::ScopedThreads scoped_threads(threads);
+      bench.run(space_tag + "__" + mode + "__threads_" + std::to_string(threads),
+                [&]() { assemble(mode == "colored"); });
+    }
+  }
+} // ... run_for_space(...)
+
+
+// prints the speedup of each run w.r.t. the single-threaded run of the same space and mode (always the first of a sweep)
+void print_speedups(const ankerl::nanobench::Bench& bench)
+{
+  const auto& results = bench.results();
+  const auto num_threads = Benchmark::thread_counts().size();
+  std::cout << "\nspeedup w.r.t. 1 thread:\n";
+  for (size_t ii = 0; ii < results.size(); ++ii) {
+    const auto& baseline = results[ii - (ii % num_threads)];
+    const auto elapsed = ankerl::nanobench::Result::Measure::elapsed;
+    std::cout << "  " << std::left << std::setw(56) << results[ii].config().mBenchmarkName << std::right
+              << std::fixed << std::setprecision(2) << baseline.median(elapsed) / results[ii].median(elapsed)
+              << "\n";
+  }
+} // ... print_speedups(...)
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+  MPIHelper::instance(argc, argv);
+
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 256u);
+  const auto grid_view = grid.leaf_view();
+
+  auto bench = Benchmark::make_bench("assembly_kernels__colored_thread_scaling");
+  bench.warmup(1).epochs(5).minEpochIterations(1);
+
+  run_for_space(bench, "continuous_lagrange_p2", make_continuous_lagrange_space(grid_view, 2));
+  run_for_space(bench, "discontinuous_lagrange_p1", make_discontinuous_lagrange_space(grid_view, 1));
+
+  print_speedups(bench);
+  Benchmark::write_report(bench, "assembly_kernels__colored_thread_scaling");
+  return 0;
+}
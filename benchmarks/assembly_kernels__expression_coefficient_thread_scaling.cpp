@@ -0,0 +1,140 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+//
+// Thread-scaling benchmark of parallel matrix assembly with a diffusion coefficient given as an
+// XT::Functions::ExpressionFunction: a continuous Lagrange P2 Laplace form on a 2d YaspGrid is
+// assembled with Walker::walk(true) on 1, 2, 4, ... threads (see Benchmark::thread_counts()). The
+// expression is evaluated at every quadrature point, so this measures how well the expression
+// engine scales when many threads evaluate the same function concurrently (each thread evaluates
+// its own copy of the compiled expression). A second sweep evaluates the expression at all
+// quadrature points of the grid, once point by point and once via evaluate_batch(). The speedup
+// w.r.t. the respective single-threaded run is printed after the sweep.
+
+#include "config.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/functions/expression.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/walker.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+
+#include "benchmark_common.hh"
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+namespace {
+
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using M = XT::LA::IstlRowMajorSparseMatrix<double>;
+static constexpr size_t d = G::dimension;
+using ExpressionType = XT::Functions::ExpressionFunction<d>;
+
+
+// prints the speedup of each run w.r.t. the single-threaded run of the same sweep (always the first of a sweep)
+void print_speedups(const ankerl::nanobench::Bench& bench)
+{
+  const auto& results = bench.results();
+  const auto num_threads = Benchmark::thread_counts().size();
+  std::cout << "\nspeedup w.r.t. 1 thread:\n";
+  for (size_t ii = 0; ii < results.size(); ++ii) {
+    const auto& baseline = results[ii - (ii % num_threads)];
+    const auto elapsed = ankerl::nanobench::Result::Measure::elapsed;
+    std::cout << "  " << std::left << std::setw(56) << results[ii].config().mBenchmarkName << std::right
+              << std::fixed << std::setprecision(2) << baseline.median(elapsed) / results[ii].median(elapsed)
+              << "\n";
+  }
+} // ... print_speedups(...)
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+  MPIHelper::instance(argc, argv);
+
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 128u);
+  const auto grid_view = grid.leaf_view();
+  const ContinuousLagrangeSpace<GV> space(grid_view, 2);
+  const ExpressionType diffusion("x", {"1 + 0.5*sin(2*pi*x[0])*cos(2*pi*x[1]) + x[0]*x[1]"}, /*order=*/3);
+
+  auto bench = Benchmark::make_bench("assembly_kernels__expression_coefficient_thread_scaling");
+  bench.warmup(1).epochs(5).minEpochIterations(1);
+
+  // the full assembly
+  for (const size_t threads : Benchmark::thread_counts()) {
+    const Benchmark::ScopedThreads scoped_threads(threads);
+    bench.run("continuous_lagrange_p2__assembly__threads_" + std::to_string(threads), [&]() {
+      auto form = make_bilinear_form(grid_view);
+      form += LocalElementIntegralBilinearForm<E>(LocalLaplaceIntegrand<E>(diffusion));
+      auto matrix_op = make_matrix_operator<M>(space);
+      matrix_op.append(form);
+      auto walker = XT::Grid::make_walker(grid_view);
+      walker.append(matrix_op);
+      walker.walk(/*use_tbb=*/true);
+      ankerl::nanobench::doNotOptimizeAway(matrix_op.matrix().sup_norm());
+    });
+  }
+
+  // the expression only, at the quadrature points used by the assembly above (the order of the Laplace integrand is
+  // the order of the diffusion plus twice the order of the P2 gradients)
+  std::vector<ExpressionType::DomainType> points;
+  for (auto&& element : elements(grid_view)) {
+    const auto& quadrature = QuadratureRules<double, d>::rule(element.type(), diffusion.order() + 2 * 1);
+    for (auto&& quadrature_point : quadrature)
+      points.emplace_back(element.geometry().global(quadrature_point.position()));
+  }
+  std::vector<ExpressionType::RangeReturnType> values(points.size());
+  for (const bool batched : {false, true}) {
+    for (const size_t threads : Benchmark::thread_counts()) {
+      const Benchmark::ScopedThreads scoped_threads(threads);
+      bench.run(std::string("expression__") + (batched ? "batched" : "pointwise") + "__threads_"
+                    + std::to_string(threads),
+                [&]() {
+                  tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size(), 256),
+                                    [&](const tbb::blocked_range<size_t>& range) {
+                                      if (batched)
+                                        diffusion.evaluate_batch(
+                                            points.data() + range.begin(), range.size(), values.data() + range.begin());
+                                      else
+                                        for (size_t pp = range.begin(); pp != range.end(); ++pp)
+                                          values[pp] = diffusion.evaluate(points[pp]);
+                                    });
+                  ankerl::nanobench::doNotOptimizeAway(values.back()[0]);
+                });
+    }
+  }
+
+  print_speedups(bench);
+  Benchmark::write_report(bench, "assembly_kernels__expression_coefficient_thread_scaling");
+  return 0;
+}
@@ -12,14 +12,26 @@
 // solver. It exercises the DG coupling/penalty integrands that the continuous-Lagrange element
 // benchmark does not.
 //
+// In addition, the integrand kernels are timed in isolation for P1 and P2, once with the batched
+// evaluate_all() of the integrands (which works on all quadrature points at once) and once with the
+// per-point fallback evaluate_all_pointwise(), to compare both evaluation paths.
+//
 // Requires a simplex grid (dune-alugrid); a no-op otherwise, matching the e2e benchmark.
 
 #include "config.h"
 
+#include <array>
 #include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <dune/common/parallel/mpihelper.hh>
 
+#include <dune/geometry/quadraturerules.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
 #include <dune/xt/common/parallel/threadmanager.hh>
 #include <dune/xt/grid/grids.hh>
 #include <dune/xt/grid/type_traits.hh>
@@ -104,6 +116,105 @@ int main(int argc, char** argv)
     ankerl::nanobench::doNotOptimizeAway(matrix_op.matrix().sup_norm());
     ankerl::nanobench::doNotOptimizeAway(rhs_func.vector().sup_norm());
   });
+
+  // integrand kernels only: bind and evaluate all SIPDG integrands on all elements and intersections, without
+  // assembling into a matrix
+  const LocalLaplaceIntegrand<E> laplace(problem.diffusion);
+  const LocalLaplaceIPDGIntegrands::InnerCoupling<I> inner_coupling(1., problem.diffusion, problem.diffusion);
+  const LocalIPDGIntegrands::InnerPenalty<I> inner_penalty_integrand(
+      inner_penalty, problem.diffusion, intersection_diameter);
+  const LocalLaplaceIPDGIntegrands::DirichletCoupling<I> dirichlet_coupling(1., problem.diffusion);
+  const LocalIPDGIntegrands::BoundaryPenalty<I> boundary_penalty(
+      dirichlet_penalty, problem.diffusion, intersection_diameter);
+  const auto evaluate_all_integrands = [&](const DiscontinuousLagrangeSpace<GV>& sp, const bool batched) {
+    auto element_integrand = laplace.copy_as_binary_element_integrand();
+    auto coupling_integrand = (inner_coupling + inner_penalty_integrand).copy_as_quaternary_intersection_integrand();
+    std::array<std::unique_ptr<LocalBinaryIntersectionIntegrandInterface<I>>, 2> boundary_integrands{
+        {dirichlet_coupling.copy_as_binary_intersection_integrand(),
+         boundary_penalty.copy_as_binary_intersection_integrand()}};
+    auto basis_in = sp.basis().localize();
+    auto basis_out = sp.basis().localize();
+    std::vector<double> weights;
+    std::array<DynamicMatrix<double>, 4> results;
+    double checksum = 0.;
+    for (auto&& element : elements(sp.grid_view())) {
+      basis_in->bind(element);
+      element_integrand->bind(element);
+      const auto& element_quadrature =
+          QuadratureRules<double, d>::rule(element.type(), element_integrand->order(*basis_in, *basis_in));
+      weights.resize(element_quadrature.size());
+      for (size_t qq = 0; qq < element_quadrature.size(); ++qq)
+        weights[qq] = element.geometry().integrationElement(element_quadrature[qq].position())
+                      * element_quadrature[qq].weight();
+      if (batched)
+        element_integrand->evaluate_all(*basis_in, *basis_in, element_quadrature, weights, results[0]);
+      else
+        element_integrand->evaluate_all_pointwise(*basis_in, *basis_in, element_quadrature, weights, results[0]);
+      checksum += results[0][0][0];
+      for (auto&& intersection : intersections(sp.grid_view(), element)) {
+        const bool inner = intersection.neighbor();
+        if (inner)
+          basis_out->bind(intersection.outside());
+        else if (problem.boundary_info.type(intersection) != XT::Grid::DirichletBoundary())
+          continue;
+        const auto prepare_weights = [&](const int integrand_order) -> const auto& {
+          const auto& quadrature = QuadratureRules<double, d - 1>::rule(intersection.type(), integrand_order);
+          weights.resize(quadrature.size());
+          for (size_t qq = 0; qq < quadrature.size(); ++qq)
+            weights[qq] =
+                intersection.geometry().integrationElement(quadrature[qq].position()) * quadrature[qq].weight();
+          return quadrature;
+        };
+        if (inner) {
+          coupling_integrand->bind(intersection);
+          const auto& quadrature =
+              prepare_weights(coupling_integrand->order(*basis_in, *basis_in, *basis_out, *basis_out));
+          if (batched)
+            coupling_integrand->evaluate_all(*basis_in,
+                                             *basis_in,
+                                             *basis_out,
+                                             *basis_out,
+                                             quadrature,
+                                             weights,
+                                             results[0],
+                                             results[1],
+                                             results[2],
+                                             results[3]);
+          else
+            coupling_integrand->evaluate_all_pointwise(*basis_in,
+                                                       *basis_in,
+                                                       *basis_out,
+                                                       *basis_out,
+                                                       quadrature,
+                                                       weights,
+                                                       results[0],
+                                                       results[1],
+                                                       results[2],
+                                                       results[3]);
+          checksum += results[0][0][0];
+        } else {
+          for (auto& boundary_integrand : boundary_integrands) {
+            boundary_integrand->bind(intersection);
+            const auto& quadrature = prepare_weights(boundary_integrand->order(*basis_in, *basis_in));
+            if (batched)
+              boundary_integrand->evaluate_all(*basis_in, *basis_in, quadrature, weights, results[0]);
+            else
+              boundary_integrand->evaluate_all_pointwise(*basis_in, *basis_in, quadrature, weights, results[0]);
+            checksum += results[0][0][0];
+          }
+        }
+      }
+    }
+    return checksum;
+  }; // ... evaluate_all_integrands(...)
+  for (const int order : {1, 2}) {
+    const DiscontinuousLagrangeSpace<GV> kernel_space(grid_view, order);
+    for (const bool batched : {false, true}) {
+      bench.run("sipdg_p" + std::to_string(order) + "__integrands_" + (batched ? "batched" : "pointwise"),
+                [&]() { ankerl::nanobench::doNotOptimizeAway(evaluate_all_integrands(kernel_space, batched)); });
+    }
+  }
+
   Benchmark::write_report(bench, "assembly_kernels__sipdg");
 
   return 0;
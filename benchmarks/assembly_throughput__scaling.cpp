@@ -0,0 +1,318 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+//
+// Assembly throughput harness: sweeps the number of threads (1, 2, 4, ... max, see
+// Benchmark::thread_counts()) and the polynomial order for the four discretizations we care about
+// in production, all on the same 2d YaspGrid:
+//   - cg:           continuous Lagrange Laplace matrix (Walker::walk(true)),
+//   - sipdg:        symmetric interior penalty DG Laplace matrix, incl. Dirichlet boundary terms,
+//   - fv:           application of the finite volume advection operator (upwind flux),
+//   - dg_advection: application of the DG advection operator (upwind flux).
+// Each run is reported per DoF by nanobench (batch = number of DoFs), so the JSON report directly
+// contains the DoF throughput; DoFs/s and elements/s are additionally written to the "metrics" of
+// the report and printed after the sweep.
+//
+// For cg and sipdg, one serial pass of the local assembly is additionally timed phase by phase:
+// binding the local bases and computing the global indices (bind), evaluating the local bilinear
+// forms, i.e. the integrands (evaluate), and adding the local matrices to the global one (scatter).
+//
+// Use benchmarks/check_regressions.py to compare the reports against a baseline (see the
+// check_benchmark_regressions target).
+
+#include "config.h"
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <dune/common/dynmatrix.hh>
+#include <dune/common/dynvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/functions/generic/function.hh>
+#include <dune/xt/grid/filters/intersection.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/view/periodic.hh>
+#include <dune/xt/grid/walker.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/integrands/ipdg.hh>
+#include <dune/gdt/local/integrands/laplace-ipdg.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/local/numerical-fluxes/upwind.hh>
+#include <dune/gdt/operators/advection-dg.hh>
+#include <dune/gdt/operators/advection-fv.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/finite-volume.hh>
+#include <dune/gdt/tools/sparsity-pattern.hh>
+
+#include "benchmark_common.hh"
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+namespace {
+
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using I = XT::Grid::extract_intersection_t<GV>;
+using M = XT::LA::IstlRowMajorSparseMatrix<double>;
+using V = XT::LA::IstlDenseVector<double>;
+static constexpr size_t d = G::dimension;
+
+const unsigned int elements_per_dim = 64;
+const std::vector<int> orders = {1, 2, 3};
+
+
+// Runs work once per thread count, reporting the time per DoF, and records the DoFs/s and elements/s of each run.
+template <class WorkType>
+void sweep_threads(ankerl::nanobench::Bench& bench,
+                   Benchmark::Metrics& metrics,
+                   const std::string& tag,
+                   const size_t num_dofs,
+                   const size_t num_elements,
+                   WorkType&& work)
+{
+  for (const size_t threads : Benchmark::thread_counts()) {
+    const Benchmark::ScopedThreads scoped_threads(threads);
+    const std::string run_name = tag + "__threads_" + std::to_string(threads);
+    bench.batch(num_dofs).unit("dof").run(run_name, work);
+    const double seconds_per_dof = bench.results().back().median(ankerl::nanobench::Result::Measure::elapsed);
+    const double seconds = seconds_per_dof * double(num_dofs);
+    auto& run_metrics = metrics[run_name];
+    run_metrics["threads"] = double(threads);
+    run_metrics["dofs"] = double(num_dofs);
+    run_metrics["elements"] = double(num_elements);
+    run_metrics["dofs_per_second"] = double(num_dofs) / seconds;
+    run_metrics["elements_per_second"] = double(num_elements) / seconds;
+  }
+} // ... sweep_threads(...)
+
+
+// One serial pass of the local assembly of the given local bilinear forms (coupling forms are applied once per inner
+// intersection, boundary forms on all boundary intersections), timed phase by phase, see the top of this file.
+template <class SpaceType>
+std::map<std::string, double>
+time_assembly_phases(const SpaceType& space,
+                     const LocalElementBilinearFormInterface<E>& element_form,
+                     const LocalCouplingIntersectionBilinearFormInterface<I>* coupling_form = nullptr,
+                     const std::vector<const LocalIntersectionBilinearFormInterface<I>*>& boundary_forms = {})
+{
+  const auto& grid_view = space.grid_view();
+  M matrix(space.mapper().size(), space.mapper().size(), make_element_and_intersection_sparsity_pattern(space));
+  auto basis_in = space.basis().localize();
+  auto basis_out = space.basis().localize();
+  const size_t max_local_size = space.mapper().max_local_size();
+  DynamicMatrix<double> in_in(max_local_size, max_local_size), in_out(max_local_size, max_local_size),
+      out_in(max_local_size, max_local_size), out_out(max_local_size, max_local_size);
+  DynamicVector<size_t> indices_in(max_local_size), indices_out(max_local_size);
+  Benchmark::PhaseTimer timer;
+  for (auto&& element : elements(grid_view)) {
+    timer.start("bind");
+    basis_in->bind(element);
+    space.mapper().global_indices(element, indices_in);
+    const size_t size_in = basis_in->size();
+    timer.start("evaluate");
+    element_form.apply2(*basis_in, *basis_in, in_in);
+    timer.start("scatter");
+    matrix.add_to_entries(indices_in, indices_in, in_in, 1., size_in, size_in);
+    timer.stop();
+    if (coupling_form == nullptr && boundary_forms.empty())
+      continue;
+    for (auto&& intersection : intersections(grid_view, element)) {
+      if (intersection.neighbor()) {
+        const auto outside = intersection.outside();
+        if (coupling_form == nullptr || grid_view.indexSet().index(outside) < grid_view.indexSet().index(element))
+          continue;
+        timer.start("bind");
+        basis_out->bind(outside);
+        space.mapper().global_indices(outside, indices_out);
+        const size_t size_out = basis_out->size();
+        timer.start("evaluate");
+        coupling_form->apply2(
+            intersection, *basis_in, *basis_in, *basis_out, *basis_out, in_in, in_out, out_in, out_out);
+        timer.start("scatter");
+        matrix.add_to_entries(indices_in, indices_in, in_in, 1., size_in, size_in);
+        matrix.add_to_entries(indices_in, indices_out, in_out, 1., size_in, size_out);
+        matrix.add_to_entries(indices_out, indices_in, out_in, 1., size_out, size_in);
+        matrix.add_to_entries(indices_out, indices_out, out_out, 1., size_out, size_out);
+        timer.stop();
+      } else if (intersection.boundary()) {
+        for (const auto* boundary_form : boundary_forms) {
+          timer.start("evaluate");
+          boundary_form->apply2(intersection, *basis_in, *basis_in, in_in);
+          timer.start("scatter");
+          matrix.add_to_entries(indices_in, indices_in, in_in, 1., size_in, size_in);
+          timer.stop();
+        }
+      }
+    }
+  }
+  ankerl::nanobench::doNotOptimizeAway(matrix.sup_norm());
+  return timer.seconds();
+} // ... time_assembly_phases(...)
+
+
+void add_phase_metrics(Benchmark::Metrics& metrics,
+                       const std::string& tag,
+                       const std::map<std::string, double>& seconds_per_phase)
+{
+  for (const auto& [phase, seconds] : seconds_per_phase)
+    metrics[tag + "__phases"][phase + "_seconds"] = seconds;
+}
+
+
+void run_cg(ankerl::nanobench::Bench& bench, Benchmark::Metrics& metrics, const GV& grid_view)
+{
+  for (const int order : orders) {
+    const std::string tag = "cg_p" + std::to_string(order);
+    const ContinuousLagrangeSpace<GV> space(grid_view, order);
+    const LocalElementIntegralBilinearForm<E> element_form(LocalLaplaceIntegrand<E>(1.));
+    sweep_threads(bench, metrics, tag, space.mapper().size(), grid_view.size(0), [&]() {
+      auto form = make_bilinear_form(grid_view);
+      form += element_form;
+      auto matrix_op = make_matrix_operator<M>(space);
+      matrix_op.append(form);
+      auto walker = XT::Grid::make_walker(grid_view);
+      walker.append(matrix_op);
+      walker.walk(/*use_tbb=*/true);
+      ankerl::nanobench::doNotOptimizeAway(matrix_op.matrix().sup_norm());
+    });
+    add_phase_metrics(metrics, tag, time_assembly_phases(space, element_form));
+  }
+} // ... run_cg(...)
+
+
+void run_sipdg(ankerl::nanobench::Bench& bench, Benchmark::Metrics& metrics, const GV& grid_view)
+{
+  const double inner_penalty = 8.;
+  const double dirichlet_penalty = 14.;
+  for (const int order : orders) {
+    const std::string tag = "sipdg_p" + std::to_string(order);
+    const DiscontinuousLagrangeSpace<GV> space(grid_view, order);
+    const LocalElementIntegralBilinearForm<E> element_form(LocalLaplaceIntegrand<E>(1.));
+    const LocalCouplingIntersectionIntegralBilinearForm<I> coupling_form(
+        LocalLaplaceIPDGIntegrands::InnerCoupling<I>(1., 1.) + LocalIPDGIntegrands::InnerPenalty<I>(inner_penalty));
+    const LocalIntersectionIntegralBilinearForm<I> dirichlet_coupling_form(
+        LocalLaplaceIPDGIntegrands::DirichletCoupling<I>(1., 1.));
+    const LocalIntersectionIntegralBilinearForm<I> boundary_penalty_form(
+        LocalIPDGIntegrands::BoundaryPenalty<I>(dirichlet_penalty));
+    sweep_threads(bench, metrics, tag, space.mapper().size(), grid_view.size(0), [&]() {
+      auto form = make_bilinear_form(grid_view);
+      form += element_form;
+      form += {coupling_form, XT::Grid::ApplyOn::InnerIntersectionsOnce<GV>()};
+      form += {dirichlet_coupling_form, XT::Grid::ApplyOn::BoundaryIntersections<GV>()};
+      form += {boundary_penalty_form, XT::Grid::ApplyOn::BoundaryIntersections<GV>()};
+      auto matrix_op = make_matrix_operator<M>(space, Stencil::element_and_intersection);
+      matrix_op.append(form);
+      auto walker = XT::Grid::make_walker(grid_view);
+      walker.append(matrix_op);
+      walker.walk(/*use_tbb=*/true);
+      ankerl::nanobench::doNotOptimizeAway(matrix_op.matrix().sup_norm());
+    });
+    add_phase_metrics(metrics,
+                      tag,
+                      time_assembly_phases(
+                          space, element_form, &coupling_form, {&dirichlet_coupling_form, &boundary_penalty_form}));
+  }
+} // ... run_sipdg(...)
+
+
+// linear transport in direction (1, 0.5) on the periodic unit square
+template <class PGV>
+void run_advection(ankerl::nanobench::Bench& bench, Benchmark::Metrics& metrics, const PGV& periodic_grid_view)
+{
+  using PI = XT::Grid::extract_intersection_t<PGV>;
+  const FieldVector<double, d> direction{1., 0.5};
+  const XT::Functions::GenericFunction<1, d, 1> flux(
+      1,
+      [&](const auto& u, const auto& /*param*/) { return direction * u; },
+      "linear_transport",
+      {},
+      [&](const auto& /*u*/, const auto& /*param*/) { return direction; });
+  const NumericalUpwindFlux<PI, d, 1> numerical_flux(flux);
+  const XT::Common::Parameter param({{"_t", {0.}}, {"_dt", {1e-3}}});
+  {
+    const FiniteVolumeSpace<PGV, 1> space(periodic_grid_view);
+    AdvectionFvOperator<PGV, 1, double, M> op(periodic_grid_view, numerical_flux, space, space);
+    const V source(space.mapper().size(), 1.);
+    V range(space.mapper().size(), 0.);
+    sweep_threads(bench, metrics, "fv", space.mapper().size(), periodic_grid_view.size(0), [&]() {
+      op.apply(source, range, param);
+      ankerl::nanobench::doNotOptimizeAway(range);
+    });
+  }
+  for (const int order : orders) {
+    const DiscontinuousLagrangeSpace<PGV, 1> space(periodic_grid_view, order);
+    AdvectionDgOperator<PGV, 1, double, M> op(periodic_grid_view, numerical_flux, space, space);
+    op.assemble(/*use_tbb=*/true);
+    const V source(space.mapper().size(), 1.);
+    V range(space.mapper().size(), 0.);
+    sweep_threads(bench,
+                  metrics,
+                  "dg_advection_p" + std::to_string(order),
+                  space.mapper().size(),
+                  periodic_grid_view.size(0),
+                  [&]() {
+                    op.apply(source, range, param);
+                    ankerl::nanobench::doNotOptimizeAway(range);
+                  });
+  }
+} // ... run_advection(...)
+
+
+void print_summary(const Benchmark::Metrics& metrics)
+{
+  std::cout << "\nthroughput (phase timings in seconds, serial):\n";
+  for (const auto& [run, run_metrics] : metrics) {
+    std::cout << "  " << std::left << std::setw(32) << run << std::right;
+    if (run_metrics.count("dofs_per_second") > 0)
+      std::cout << std::scientific << std::setprecision(3) << std::setw(12) << run_metrics.at("dofs_per_second")
+                << " DoFs/s" << std::setw(12) << run_metrics.at("elements_per_second") << " elements/s";
+    else
+      for (const auto& [phase, seconds] : run_metrics)
+        std::cout << "  " << phase << " = " << std::fixed << std::setprecision(4) << seconds;
+    std::cout << "\n";
+  }
+} // ... print_summary(...)
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+  MPIHelper::instance(argc, argv);
+
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., elements_per_dim);
+  const GV grid_view = grid.leaf_view();
+  const auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid_view);
+
+  auto bench = Benchmark::make_bench("assembly_throughput__scaling");
+  bench.warmup(1).epochs(3).minEpochIterations(1);
+  Benchmark::Metrics metrics;
+
+  run_cg(bench, metrics, grid_view);
+  run_sipdg(bench, metrics, grid_view);
+  run_advection(bench, metrics, periodic_grid_view);
+
+  print_summary(metrics);
+  Benchmark::write_report(bench, "assembly_throughput__scaling", metrics);
+  return 0;
+}
@@ -8,12 +8,23 @@
 #ifndef DUNE_GDT_BENCHMARKS_BENCHMARK_COMMON_HH
 #define DUNE_GDT_BENCHMARKS_BENCHMARK_COMMON_HH
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+#include <dune/xt/common/parallel/threadmanager.hh>
 
 // The benchmarks are standalone executables (one translation unit each), so it is safe to emit
 // the nanobench implementation here in the single header every benchmark includes.
@@ -39,6 +50,99 @@ inline ankerl::nanobench::Bench make_bench(const std::string& title)
 }
 
 
+/**
+ * \brief The thread counts to sweep in scaling benchmarks: 1, 2, 4, ... up to the maximum (always included).
+ *
+ * The maximum defaults to the hardware concurrency and can be overridden by ${DUNE_GDT_BENCHMARK_MAX_THREADS}.
+ */
+inline std::vector<size_t> thread_counts()
+{
+  size_t max_threads = std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+  if (const char* env = std::getenv("DUNE_GDT_BENCHMARK_MAX_THREADS"); env && env[0] != '\0')
+    max_threads = std::max(size_t(1), size_t(std::stoul(env)));
+  std::vector<size_t> counts;
+  for (size_t threads = 1; threads < max_threads; threads *= 2)
+    counts.push_back(threads);
+  counts.push_back(max_threads);
+  return counts;
+}
+
+
+/**
+ * \brief Limits both TBB and dune-xt's ThreadManager to the given number of threads for the lifetime of this object.
+ *
+ * The previous ThreadManager setting is restored on destruction, the TBB limit is lifted.
+ */
+class ScopedThreads
+{
+public:
+  explicit ScopedThreads(const size_t num_threads)
+    : previous_(XT::Common::threadManager().max_threads())
+    , control_(std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads))
+  {
+    XT::Common::threadManager().set_max_threads(num_threads);
+  }
+
+  ScopedThreads(const ScopedThreads&) = delete;
+  ScopedThreads& operator=(const ScopedThreads&) = delete;
+
+  ~ScopedThreads()
+  {
+    XT::Common::threadManager().set_max_threads(previous_);
+  }
+
+private:
+  const size_t previous_;
+  const std::unique_ptr<tbb::global_control> control_;
+};
+
+
+/**
+ * \brief Accumulates the wall time spent in named phases (e.g. bind, evaluate, scatter) of a repeated computation.
+ *
+ * Usage: `timer.start("bind"); ...; timer.start("evaluate"); ...; timer.stop();`, where start() implicitly stops the
+ * running phase. Not thread-safe, use one timer per thread.
+ */
+class PhaseTimer
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  void start(const std::string& phase)
+  {
+    stop();
+    current_phase_ = phase;
+    current_start_ = Clock::now();
+  }
+
+  void stop()
+  {
+    if (current_phase_.empty())
+      return;
+    seconds_[current_phase_] += std::chrono::duration<double>(Clock::now() - current_start_).count();
+    current_phase_.clear();
+  }
+
+  /// \brief The accumulated seconds per phase.
+  const std::map<std::string, double>& seconds() const
+  {
+    return seconds_;
+  }
+
+private:
+  std::map<std::string, double> seconds_;
+  std::string current_phase_;
+  Clock::time_point current_start_;
+};
+
+
+/**
+ * \brief Additional named metrics per benchmark run (e.g. elements per second), written to the report by
+ *        write_report(), keyed by the name of the run.
+ */
+using Metrics = std::map<std::string, std::map<std::string, double>>;
+
+
 /**
  * \brief Return the current UTC time as an ISO-8601 timestamp, e.g. "2026-06-07T09:58:00Z".
  */
@@ -65,8 +169,10 @@ inline std::string utc_timestamp()
  * "meta" object so that downstream consumers (e.g. the documentation plots) have reliable date
  * metadata to plot runtime over time. The capture date is the UTC wall-clock time at which the
  * report is written; the optional git revision is taken from ${DUNE_GDT_BENCHMARK_GIT_REVISION}.
+ *
+ * If given, the metrics are written to an additional "metrics" object, mapping the name of a run to its metrics.
  */
-inline void write_report(const ankerl::nanobench::Bench& bench, const std::string& name)
+inline void write_report(const ankerl::nanobench::Bench& bench, const std::string& name, const Metrics& metrics = {})
 {
   const char* dir = std::getenv("DUNE_GDT_BENCHMARK_OUTPUT_DIR");
   const std::string path = (dir && dir[0] != '\0' ? std::string(dir) + "/" : std::string()) + name + ".json";
@@ -85,6 +191,25 @@ inline void write_report(const ankerl::nanobench::Bench& bench, const std::strin
   if (const char* rev = std::getenv("DUNE_GDT_BENCHMARK_GIT_REVISION"); rev && rev[0] != '\0')
     meta << ",\n  \"git_revision\": \"" << rev << "\"";
   meta << "\n },";
+  if (!metrics.empty()) {
+    meta << "\n \"metrics\": {";
+    std::string run_separator;
+    for (const auto& [run, run_metrics] : metrics) {
+      meta << run_separator << "\n  \"" << run << "\": {";
+      std::string metric_separator;
+      for (const auto& [metric, value] : run_metrics) {
+        meta << metric_separator << "\"" << metric << "\": ";
+        if (std::isfinite(value))
+          meta << value;
+        else
+          meta << "null";
+        metric_separator = ", ";
+      }
+      meta << "}";
+      run_separator = ",";
+    }
+    meta << "\n },";
+  }
   json.insert(brace + 1, meta.str());
 
   std::ofstream out(path);
@@ -21,6 +21,7 @@
 #include <dune/xt/la/container/istl.hh>
 
 #include <dune/gdt/data/burgers.hh>
+#include <dune/gdt/discretefunction/default.hh>
 #include <dune/gdt/local/numerical-fluxes/upwind.hh>
 #include <dune/gdt/operators/advection-fv.hh>
 #include <dune/gdt/spaces/l2/finite-volume.hh>
@@ -72,6 +73,33 @@ int main(int argc, char** argv)
     }
     ankerl::nanobench::doNotOptimizeAway(u);
   });
+  // the same time loop, but applying the operator to a grid function, which sets up a Walker in every step instead of
+  // reusing the operator's execution plan (the difference is the per-step overhead saved by the plan)
+  bench.run("explicit_euler__upwind__walker_per_step", [&]() {
+    auto u = u_0.dofs().vector();
+    V update(u.size(), 0.);
+    double time = 0.;
+    while (time < T_end) {
+      const auto u_function = make_discrete_function(space, u);
+      op.apply(u_function, update, {{"_t", {time}}, {"_dt", {dt}}});
+      u -= update * dt;
+      time += dt;
+    }
+    ankerl::nanobench::doNotOptimizeAway(u);
+  });
+  // the same time loop as the first one, but streaming over the flat face table instead of the elements
+  AdvectionFvOperator<GV, m, R, M> face_table_op(
+      space.grid_view(), numerical_flux, space, space, XT::Grid::ApplyOn::NoIntersections<GV>());
+  face_table_op.use_face_table();
+  bench.run("explicit_euler__upwind__face_table", [&]() {
+    auto u = u_0.dofs().vector();
+    double time = 0.;
+    while (time < T_end) {
+      u -= face_table_op.apply(u, {{"_t", {time}}, {"_dt", {dt}}}) * dt;
+      time += dt;
+    }
+    ankerl::nanobench::doNotOptimizeAway(u);
+  });
   Benchmark::write_report(bench, "burgers__1d__explicit__fv");
 
   return 0;
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Compare nanobench JSON reports against a baseline and fail on throughput regressions.
+
+For every <name>.json in the reports directory that also exists in the baseline directory, each run
+(nanobench result) present in both is compared by throughput, i.e. 1 / median(elapsed):
+
+* a run regresses if its throughput dropped by more than --threshold (relative) w.r.t. the baseline;
+* runs named <series>__threads_<N> (see Benchmark::thread_counts()) are additionally compared by
+  their speedup w.r.t. <series>__threads_1; a run regresses if its speedup dropped by more than
+  --scaling-threshold (relative) w.r.t. the baseline speedup.
+
+Runs, reports or thread counts which only exist on one side are listed but never fail the check, so
+adding benchmarks or running on a machine with a different core count is fine. Without any baseline
+report (e.g. the very first run) the check passes. stdlib only.
+
+Prints one line per compared run and exits 1 if any run regressed.
+
+Usage: check_regressions.py --baseline <dir> --reports <dir> [--threshold 0.15] [--scaling-threshold 0.25]
+"""
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+
+THREADS_PATTERN = re.compile(r"^(?P<series>.*)__threads_(?P<threads>\d+)$")
+
+
+def load_medians(path):
+    """Map run name -> median(elapsed) of the nanobench report at path (runs without timing are skipped)."""
+    with open(path) as f:
+        report = json.load(f)
+    medians = {}
+    for result in report.get("results", []):
+        median = result.get("median(elapsed)")
+        if result.get("name") and median:
+            medians[result["name"]] = float(median)
+    return medians
+
+
+def speedups(medians):
+    """Map run name -> speedup w.r.t. the single-threaded run of the same series, for all __threads_<N> runs."""
+    result = {}
+    for name, median in medians.items():
+        match = THREADS_PATTERN.match(name)
+        if not match:
+            continue
+        single_threaded = medians.get(match.group("series") + "__threads_1")
+        if single_threaded:
+            result[name] = single_threaded / median
+    return result
+
+
+def compare(report_name, baseline, current, threshold, scaling_threshold):
+    """Print the comparison of one report, return the number of regressions."""
+    regressions = 0
+    baseline_speedups = speedups(baseline)
+    current_speedups = speedups(current)
+    print(f"{report_name}:")
+    for name in current:
+        if name not in baseline:
+            print(f"  {name:<60} (not in baseline)")
+            continue
+        # throughput is inversely proportional to the (per unit) median time
+        ratio = baseline[name] / current[name]
+        failed = ratio < 1.0 - threshold
+        line = f"  {name:<60} throughput {ratio:7.1%} of baseline"
+        if name in current_speedups and name in baseline_speedups:
+            scaling_ratio = current_speedups[name] / baseline_speedups[name]
+            line += f", speedup {current_speedups[name]:5.2f} (baseline {baseline_speedups[name]:5.2f})"
+            if scaling_ratio < 1.0 - scaling_threshold:
+                failed = True
+        if failed:
+            regressions += 1
+            line += "  <-- REGRESSION"
+        print(line)
+    for name in baseline:
+        if name not in current:
+            print(f"  {name:<60} (only in baseline)")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--baseline", required=True, type=Path, help="directory holding the baseline reports")
+    parser.add_argument("--reports", required=True, type=Path, help="directory holding the reports to check")
+    parser.add_argument(
+        "--threshold", type=float, default=0.15, help="tolerated relative throughput loss (default: 0.15)"
+    )
+    parser.add_argument(
+        "--scaling-threshold",
+        type=float,
+        default=0.25,
+        help="tolerated relative loss of the speedup w.r.t. one thread (default: 0.25)",
+    )
+    args = parser.parse_args()
+
+    reports = sorted(args.reports.glob("*.json"))
+    if not reports:
+        print(f"error: no reports found in {args.reports}", file=sys.stderr)
+        return 1
+    if not args.baseline.is_dir() or not any(args.baseline.glob("*.json")):
+        print(f"no baseline reports found in {args.baseline}, nothing to compare against")
+        return 0
+
+    regressions = 0
+    for report in reports:
+        baseline_report = args.baseline / report.name
+        if not baseline_report.exists():
+            print(f"{report.stem}: (not in baseline)")
+            continue
+        regressions += compare(
+            report.stem, load_medians(baseline_report), load_medians(report), args.threshold, args.scaling_threshold
+        )
+
+    if regressions > 0:
+        print(f"\n{regressions} run(s) regressed beyond the threshold", file=sys.stderr)
+        return 1
+    print("\nno regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,74 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+//
+// Thread-scaling benchmark of default_interpolation(). Continuous spaces share DoFs between
+// elements; these are written lock-free by their owning element only (see DofOwnership in
+// dune/gdt/tools/dof-ownership.hh), while DG DoFs are element-local anyway. The same workload is
+// run on 1, 2, 4, ... threads (see Benchmark::thread_counts()), so the report directly shows the
+// parallel speedup of the interpolation write path.
+
+#include "config.h"
+
+#include <cmath>
+#include <string>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dune/xt/functions/generic/function.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/interpolations/default.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+#include "benchmark_common.hh"
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+namespace {
+
+
+template <class SpaceType>
+void run_for_space(ankerl::nanobench::Bench& bench, const std::string& space_tag, const SpaceType& space)
+{
+  using V = XT::LA::IstlDenseVector<double>;
+  const XT::Functions::GenericFunction<2> source(3, [](const auto& x, const auto&) {
+    return std::sin(x[0]) * std::cos(x[1]) + x[0] * x[0] * x[1];
+  });
+  for (const size_t threads : Benchmark::thread_counts()) {
+    const Benchmark::ScopedThreads scoped_threads(threads);
+    bench.run(space_tag + "__threads_" + std::to_string(threads), [&]() {
+      auto target = default_interpolation<V>(source, space);
+      ankerl::nanobench::doNotOptimizeAway(target.dofs().vector().sup_norm());
+    });
+  }
+}
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+  MPIHelper::instance(argc, argv);
+
+  using G = YASP_2D_EQUIDISTANT_OFFSET;
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 256u);
+  const auto grid_view = grid.leaf_view();
+
+  auto bench = Benchmark::make_bench("interpolations_default__thread_scaling");
+  bench.warmup(1).epochs(5).minEpochIterations(1);
+
+  run_for_space(bench, "continuous_lagrange_p2", make_continuous_lagrange_space(grid_view, 2));
+  run_for_space(bench, "discontinuous_lagrange_p2", make_discontinuous_lagrange_space(grid_view, 2));
+
+  Benchmark::write_report(bench, "interpolations_default__thread_scaling");
+  return 0;
+}
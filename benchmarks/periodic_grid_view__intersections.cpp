@@ -0,0 +1,89 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+//
+// Standalone benchmark of walking all intersections of a periodic 2d grid, as done by every finite volume or DG
+// operator: for each element and each of its intersections with a neighbor, the outside element, its index and the
+// local geometry of the intersection in the outside element are accessed. Compares
+//   - periodic_grid_view: XT::Grid::PeriodicGridView on top of a non-periodic YaspGrid (periodic neighbors are read
+//                         from the precomputed neighbor table),
+//   - yasp_native:        a YaspGrid with native periodicity (the periodic neighbors are overlap elements),
+// and times the construction of the PeriodicGridView (i.e., of the neighbor table) separately.
+
+#include "config.h"
+
+#include <array>
+#include <bitset>
+#include <vector>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+#include <dune/grid/yaspgrid.hh>
+
+#include <dune/xt/common/parallel/threadmanager.hh>
+#include <dune/xt/grid/view/periodic.hh>
+
+#include "benchmark_common.hh"
+
+using namespace Dune;
+
+
+template <class GV>
+double walk_intersections(const GV& grid_view, const std::vector<double>& u)
+{
+  const auto& index_set = grid_view.indexSet();
+  double result = 0.;
+  for (auto&& element : elements(grid_view, Partitions::interior)) {
+    const double u_inside = u[index_set.index(element)];
+    for (auto&& intersection : intersections(grid_view, element)) {
+      if (!intersection.neighbor())
+        continue;
+      const auto outside = intersection.outside();
+      const auto x_in_outside = intersection.geometryInOutside().center();
+      result += intersection.geometry().volume() * (u[index_set.index(outside)] - u_inside)
+                + x_in_outside[0] * intersection.indexInOutside();
+    }
+  }
+  return result;
+} // ... walk_intersections(...)
+
+
+int main(int argc, char** argv)
+{
+  MPIHelper::instance(argc, argv);
+  XT::Common::threadManager().set_max_threads(1);
+
+  using G = YaspGrid<2>;
+  const FieldVector<double, 2> upper_right(1.);
+  const std::array<int, 2> num_elements{{256, 256}};
+
+  const G grid(upper_right, num_elements, std::bitset<2>(), /*overlap=*/0);
+  const auto periodic_grid_view = XT::Grid::make_periodic_grid_view(grid.leafGridView());
+  std::vector<double> u(periodic_grid_view.indexSet().size(0));
+  for (size_t ii = 0; ii < u.size(); ++ii)
+    u[ii] = double(ii % 17);
+
+  // overlap 1 is required for YaspGrid to provide neighbors across the periodic boundary
+  const G native_periodic_grid(upper_right, num_elements, std::bitset<2>("11"), /*overlap=*/1);
+  const auto native_grid_view = native_periodic_grid.leafGridView();
+  std::vector<double> native_u(native_grid_view.indexSet().size(0));
+  for (size_t ii = 0; ii < native_u.size(); ++ii)
+    native_u[ii] = double(ii % 17);
+
+  auto bench = Benchmark::make_bench("periodic_grid_view__intersections");
+  bench.run("walk__periodic_grid_view",
+            [&]() { ankerl::nanobench::doNotOptimizeAway(walk_intersections(periodic_grid_view, u)); });
+  bench.run("walk__yasp_native",
+            [&]() { ankerl::nanobench::doNotOptimizeAway(walk_intersections(native_grid_view, native_u)); });
+  bench.run("construct__periodic_grid_view", [&]() {
+    const auto grid_view = XT::Grid::make_periodic_grid_view(grid.leafGridView());
+    ankerl::nanobench::doNotOptimizeAway(grid_view.indexSet().size(0));
+  });
+  Benchmark::write_report(bench, "periodic_grid_view__intersections");
+
+  return 0;
+}
@@ -14,6 +14,13 @@
 #ifndef DUNE_GDT_ALGORITHMS_NEWTON_HH
 #define DUNE_GDT_ALGORITHMS_NEWTON_HH
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <dune/xt/common/parameter.hh>
 #include <dune/xt/common/print.hh>
 #include <dune/xt/common/timedlogging.hh>
@@ -32,27 +39,76 @@ class OperatorInterface;
 
 
 /**
- * \brief Returns the default options (precision, maximum iterations, maximum dampening iterations) for newton_solve.
+ * \brief Returns the default options for newton_solve.
+ *
+ * - precision, max_iter, max_dampening_iter: stopping criteria of the Newton and the dampening iteration
+ * - jacobian_lag: the jacobian (and the linear solver) is reused for at most this many iterations (1 means classical
+ *   Newton, larger values a lagged jacobian), it is recomputed early if the residual is not reduced by at least a
+ *   factor of jacobian_max_contraction or if the update of a reused jacobian needs to be dampened
+ * - forcing: the precision of the linear solver in iteration l, either "constant" (0.1 * precision) or
+ *   "eisenstat_walker" (choice 2 from [EW1996], eta_l = gamma * (|r_l| / |r_{l - 1}|)^alpha with the usual safeguards,
+ *   bounded by forcing.eta_max, starting with forcing.eta_0)
+ * - reuse_linear_solver_type: try the linear solver type which succeeded last first, instead of all types in order
+ *   (off by default, which keeps the order of the linear solver types)
+ *
+ * [EW1996] Eisenstat, Walker, Choosing the forcing terms in an inexact Newton method, SIAM J. Sci. Comput. 17 (1996)
  */
 static inline XT::Common::Configuration default_newton_solve_options()
 {
-  return {{{"precision", "1e-7"}, {"max_iter", "100"}, {"max_dampening_iter", "1000"}}};
+  return {{{"precision", "1e-7"},
+           {"max_iter", "100"},
+           {"max_dampening_iter", "1000"},
+           {"jacobian_lag", "1"},
+           {"jacobian_max_contraction", "0.5"},
+           {"forcing", "constant"},
+           {"forcing.eta_0", "0.5"},
+           {"forcing.eta_max", "0.9"},
+           {"forcing.gamma", "0.9"},
+           {"forcing.alpha", "2"},
+           {"reuse_linear_solver_type", "false"}}};
 }
 
 
+/**
+ * \brief Per-iteration data of newton_solve, e.g. to tune its options for production runs.
+ *
+ * All vectors but residual_norms contain one entry per Newton iteration, residual_norms additionally contains the
+ * final residual. All timings are in seconds.
+ */
+struct NewtonSolveInfo
+{
+  std::vector<double> residual_norms;
+  std::vector<double> residual_timings;
+  std::vector<double> jacobian_timings; // <- 0 if the jacobian was reused
+  std::vector<size_t> jacobian_ages; // <- 0 if the jacobian was computed in this iteration
+  std::vector<double> linear_solver_timings;
+  std::vector<double> linear_solver_precisions;
+  std::vector<std::string> linear_solver_types;
+  std::vector<double> update_timings;
+  std::vector<double> dampenings;
+  size_t num_jacobians = 0;
+
+  size_t num_iterations() const
+  {
+    return residual_timings.size() > 0 ? residual_timings.size() - 1 : 0;
+  }
+}; // struct NewtonSolveInfo
+
+
 /**
  * \brief Computes the inverse action of the operator.
  *
- * Currently implemented is the dampened Newton from [DF2015, Sec. 8.4.4.1].
+ * Currently implemented is the dampened Newton from [DF2015, Sec. 8.4.4.1], optionally with a lagged jacobian and an
+ * adaptive precision of the linear solver, \sa default_newton_solve_options.
  *
  * \todo Allow to pass jacobian options as subcfg in newton.
  **/
 template <class AGV, size_t s_r, size_t s_rC, size_t r_r, size_t r_rC, class F, class M, class SGV, class RGV, class V>
-void newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV, RGV>& lhs_operator,
-                  const XT::LA::VectorInterface<V>& rhs_vector,
-                  XT::LA::VectorInterface<V>& initial_guess_vector,
-                  const XT::Common::Parameter& param = {},
-                  const XT::Common::Configuration& opts = default_newton_solve_options())
+NewtonSolveInfo newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV, RGV>& lhs_operator,
+                             const XT::LA::VectorInterface<V>& rhs_vector,
+                             XT::LA::VectorInterface<V>& initial_guess_vector,
+                             const XT::Common::Parameter& param = {},
+                             const XT::Common::Configuration& opts = default_newton_solve_options())
 {
   XT::Common::DefaultLogger logger("newton_solve");
   LOG(debug) << "(lhs_operator=" << &lhs_operator << ", rhs_vector.sup_norm()=" << rhs_vector.sup_norm()
@@ -63,12 +119,35 @@ void newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV,
   auto& initial_guess = initial_guess_vector.as_imp();
   auto residual_op = lhs_operator - rhs;
   auto residual = rhs.copy();
+  auto defect = rhs.copy();
   auto update = initial_guess.copy();
   auto candidate = initial_guess.copy();
   const auto default_opts = default_newton_solve_options();
   const auto precision = opts.get("precision", default_opts.get<double>("precision"));
   const auto max_iter = opts.get("max_iter", default_opts.get<size_t>("max_iter"));
   const auto max_dampening_iter = opts.get("max_dampening_iter", default_opts.get<size_t>("max_dampening_iter"));
+  const auto jacobian_lag = std::max(size_t(1), opts.get("jacobian_lag", default_opts.get<size_t>("jacobian_lag")));
+  const auto jacobian_max_contraction =
+      opts.get("jacobian_max_contraction", default_opts.get<double>("jacobian_max_contraction"));
+  const auto forcing = opts.get("forcing", default_opts.get<std::string>("forcing"));
+  DUNE_THROW_IF(forcing != "constant" && forcing != "eisenstat_walker",
+                Exceptions::newton_error,
+                "forcing has to be one of {constant, eisenstat_walker}!\nopts:\n"
+                    << opts);
+  const auto eta_max = opts.get("forcing.eta_max", default_opts.get<double>("forcing.eta_max"));
+  const auto gamma = opts.get("forcing.gamma", default_opts.get<double>("forcing.gamma"));
+  const auto alpha = opts.get("forcing.alpha", default_opts.get<double>("forcing.alpha"));
+  const auto reuse_linear_solver_type =
+      opts.get("reuse_linear_solver_type", default_opts.get<bool>("reuse_linear_solver_type"));
+  double eta = opts.get("forcing.eta_0", default_opts.get<double>("forcing.eta_0"));
+  using JacobianOperatorType = decltype(residual_op.jacobian(initial_guess, XT::Common::Configuration(), param));
+  using LinearSolverType = decltype(XT::LA::make_solver(std::declval<JacobianOperatorType>().matrix()));
+  std::unique_ptr<JacobianOperatorType> jacobian_op;
+  std::unique_ptr<LinearSolverType> jacobian_solver;
+  size_t jacobian_age = 0;
+  bool recompute_jacobian = true;
+  std::string last_linear_solver_type;
+  NewtonSolveInfo info;
   LOG(info) << "solving system by dampened newton:" << std::endl;
   size_t l = 0;
   Timer timer;
@@ -78,6 +157,8 @@ void newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV,
     LOG(info) << "l = " << l << ": computing residual ... " << std::flush;
     residual_op.apply(initial_guess, residual, param);
     auto res = residual.l2_norm();
+    info.residual_norms.push_back(res);
+    info.residual_timings.push_back(timer.elapsed());
     LOG(info) << "took " << timer.elapsed() << "s, |residual|_l2 = " << res << std::endl;
     if (res < precision) {
       LOG(info) << prefix << "residual below tolerance, succeeded!" << std::endl;
@@ -87,37 +168,101 @@ void newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV,
                   Exceptions::newton_error,
                   "max iterations reached!\n|residual|_l2 = " << res << "\nopts:\n"
                                                               << opts);
-    LOG(info) << prefix << "computing jacobi matrix ... " << std::flush;
-    timer.reset();
-    auto jacobian_op = residual_op.jacobian(initial_guess, {{"type", residual_op.jacobian_options().at(0)}}, param);
-    jacobian_op.assemble(/*use_tbb=*/true);
-    LOG(info) << "took " << timer.elapsed() << "s\n" << prefix << "solving for defect ... " << std::flush;
-    timer.reset();
-    residual *= -1.;
-    auto jacobian_solver = XT::LA::make_solver(jacobian_op.matrix());
-    update = initial_guess; // <- initial guess for the linear solver
-    bool linear_solve_succeeded = false;
-    std::vector<std::string> tried_linear_solvers;
-    for (const auto& linear_solver_type : jacobian_solver.types()) {
-      try {
-        tried_linear_solvers.push_back(linear_solver_type);
-        jacobian_solver.apply(
-            residual, update, {{"type", linear_solver_type}, {"precision", XT::Common::to_string(0.1 * precision)}});
-        linear_solve_succeeded = true;
-        break;
-      } catch (const XT::LA::Exceptions::linear_solver_failed&) {
+    // the precision of the linear solver
+    double linear_precision = 0.1 * precision;
+    if (forcing == "eisenstat_walker") {
+      if (l > 0) {
+        const double previous_eta = eta;
+        eta = gamma * std::pow(res / info.residual_norms[l - 1], alpha);
+        // safeguard against oversolving, see [EW1996]
+        const double safeguard = gamma * std::pow(previous_eta, alpha);
+        if (safeguard > 0.1)
+          eta = std::max(eta, safeguard);
       }
+      eta = std::min(eta, eta_max);
+      // do not solve more accurately than required to reach the prescribed precision
+      linear_precision = std::max(eta, 0.5 * precision / res);
     }
-    DUNE_THROW_IF(!linear_solve_succeeded,
-                  Exceptions::newton_error,
-                  "could not solve linear system for defect!\nTried the following linear solvers: "
-                      << tried_linear_solvers << "\nopts:\n"
-                      << opts);
-    LOG(info) << "took " << timer.elapsed() << "s";
-    if (tried_linear_solvers.size() > 1) {
-      LOG(info) << " (and " << tried_linear_solvers.size() << " attempts with different linear solvers)";
+    bool jacobian_was_reused = true;
+    double undampened_candidate_res = -1.;
+    while (true) {
+      if (recompute_jacobian || !jacobian_op || jacobian_age >= jacobian_lag) {
+        LOG(info) << prefix << "computing jacobi matrix ... " << std::flush;
+        timer.reset();
+        jacobian_solver.reset();
+        jacobian_op = std::make_unique<JacobianOperatorType>(
+            residual_op.jacobian(initial_guess, {{"type", residual_op.jacobian_options().at(0)}}, param));
+        jacobian_op->assemble(/*use_tbb=*/true);
+        jacobian_solver = std::make_unique<LinearSolverType>(XT::LA::make_solver(jacobian_op->matrix()));
+        jacobian_age = 0;
+        recompute_jacobian = false;
+        undampened_candidate_res = -1.;
+        jacobian_was_reused = false;
+        ++info.num_jacobians;
+        LOG(info) << "took " << timer.elapsed() << "s" << std::endl;
+      }
+      info.jacobian_timings.push_back(jacobian_was_reused ? 0. : timer.elapsed());
+      LOG(info) << prefix << "solving for defect ";
+      if (jacobian_age > 0)
+        LOG(info) << "(with a jacobian from " << jacobian_age << " iterations ago) ";
+      LOG(info) << "... " << std::flush;
+      timer.reset();
+      defect = residual;
+      defect *= -1.;
+      update = initial_guess; // <- initial guess for the linear solver
+      bool linear_solve_succeeded = false;
+      std::vector<std::string> tried_linear_solvers;
+      auto linear_solver_types = jacobian_solver->types();
+      if (reuse_linear_solver_type && !last_linear_solver_type.empty()) {
+        linear_solver_types.erase(
+            std::remove(linear_solver_types.begin(), linear_solver_types.end(), last_linear_solver_type),
+            linear_solver_types.end());
+        linear_solver_types.insert(linear_solver_types.begin(), last_linear_solver_type);
+      }
+      for (const auto& linear_solver_type : linear_solver_types) {
+        try {
+          tried_linear_solvers.push_back(linear_solver_type);
+          auto linear_solver_opts = jacobian_solver->options(linear_solver_type);
+          linear_solver_opts["precision"] = XT::Common::to_string(linear_precision);
+          if (forcing != "constant") // an inexact solution is intended
+            linear_solver_opts["post_check_solves_system"] = "0";
+          jacobian_solver->apply(defect, update, linear_solver_opts);
+          linear_solve_succeeded = true;
+          last_linear_solver_type = linear_solver_type;
+          break;
+        } catch (const XT::LA::Exceptions::linear_solver_failed&) {
+        }
+      }
+      DUNE_THROW_IF(!linear_solve_succeeded,
+                    Exceptions::newton_error,
+                    "could not solve linear system for defect!\nTried the following linear solvers: "
+                        << tried_linear_solvers << "\nopts:\n"
+                        << opts);
+      info.linear_solver_timings.push_back(timer.elapsed());
+      info.linear_solver_precisions.push_back(linear_precision);
+      info.linear_solver_types.push_back(last_linear_solver_type);
+      LOG(info) << "took " << timer.elapsed() << "s";
+      if (tried_linear_solvers.size() > 1) {
+        LOG(info) << " (and " << tried_linear_solvers.size() << " attempts with different linear solvers)";
+      }
+      LOG(info) << std::endl;
+      if (jacobian_age == 0)
+        break;
+      // a reused jacobian has to yield a decreasing residual without dampening, otherwise we recompute it
+      candidate = initial_guess + update;
+      residual_op.apply(candidate, defect, param);
+      undampened_candidate_res = defect.l2_norm();
+      if (undampened_candidate_res < res)
+        break;
+      LOG(info) << prefix << "update did not reduce the residual, recomputing jacobian" << std::endl;
+      recompute_jacobian = true;
+      info.jacobian_timings.pop_back();
+      info.linear_solver_timings.pop_back();
+      info.linear_solver_precisions.pop_back();
+      info.linear_solver_types.pop_back();
     }
-    LOG(info) << "\n" << prefix << "computing update ... " << std::flush;
+    info.jacobian_ages.push_back(jacobian_age);
+    LOG(info) << prefix << "computing update ... " << std::flush;
     timer.reset();
     // try the automatic dampening strategy proposed in [DF2015, Sec. 8.4.4.1, p. 432]
     size_t k = 0;
@@ -129,16 +274,28 @@ void newton_solve(const OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV,
                     "max iterations reached when trying to compute automatic dampening!\n|residual|_l2 = "
                         << res << "\nl = " << l << "\nopts:\n"
                         << opts);
-      candidate = initial_guess + update * lambda;
-      residual_op.apply(candidate, residual, param);
-      candidate_res = residual.l2_norm();
+      if (k == 0 && undampened_candidate_res >= 0) {
+        // already computed above
+        candidate_res = undampened_candidate_res;
+      } else {
+        candidate = initial_guess + update * lambda;
+        residual_op.apply(candidate, residual, param);
+        candidate_res = residual.l2_norm();
+      }
       lambda /= 2;
       k += 1;
     }
     initial_guess = candidate;
+    info.update_timings.push_back(timer.elapsed());
+    info.dampenings.push_back(2 * lambda);
     LOG(info) << "took " << timer.elapsed() << "s and a dampening of " << 2 * lambda << std::endl;
+    // reuse the jacobian only if it yielded a sufficient contraction
+    ++jacobian_age;
+    if (candidate_res / res > jacobian_max_contraction)
+      recompute_jacobian = true;
     l += 1;
   }
+  return info;
 } // ... newton (...)
 
 
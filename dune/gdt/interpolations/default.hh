@@ -16,6 +16,7 @@
 #ifndef DUNE_GDT_INTERPOLATIONS_DEFAULT_HH
 #define DUNE_GDT_INTERPOLATIONS_DEFAULT_HH
 
+#include <memory>
 #include <vector>
 
 #include <dune/grid/common/rangegenerators.hh>
@@ -30,6 +31,7 @@
 #include <dune/xt/functions/generic/function.hh>
 
 #include <dune/gdt/discretefunction/default.hh>
+#include <dune/gdt/tools/dof-ownership.hh>
 
 namespace Dune {
 namespace GDT {
@@ -37,6 +39,10 @@ namespace GDT {
 
 /**
  * \brief Element functor that interpolates a source grid function into the target discrete function element-wise.
+ *
+ * If a DofOwnership is given, each element only writes the DoFs it owns, which allows to apply this functor in parallel
+ * without locking, even if DoFs are shared between elements (as in continuous spaces). Without ownership, all local
+ * DoFs are written, which is only thread safe if no DoFs are shared between elements (as in FV or DG spaces).
  */
 template <class GV, size_t r, size_t rC, class R, class V, class IGV>
 class DefaultInterpolationElementFunctor : public XT::Grid::ElementFunctor<IGV>
@@ -51,11 +57,16 @@ public:
   using TargetType = DiscreteFunction<V, GV, r, rC, R>;
   using LocalDofVectorType = typename TargetType::DofVectorType::LocalDofVectorType;
   using TargetBasisType = typename TargetType::SpaceType::GlobalBasisType::LocalizedType;
+  using DofOwnershipType = DofOwnership<GV, IGV>;
 
-  DefaultInterpolationElementFunctor(SourceType source, TargetType& target, const XT::Common::Parameter& param = {})
+  DefaultInterpolationElementFunctor(SourceType source,
+                                     TargetType& target,
+                                     const XT::Common::Parameter& param = {},
+                                     std::shared_ptr<const DofOwnershipType> dof_ownership = nullptr)
     : source_(source.copy_as_grid_function())
     , target_(target)
     , param_(param)
+    , dof_ownership_(std::move(dof_ownership))
     , local_dof_vector_(target.dofs().localize())
     , local_source_(source_->local_function())
     , target_basis_(target.space().basis().localize())
@@ -70,6 +81,7 @@ public:
     , source_(other.source_->copy_as_grid_function())
     , target_(other.target_)
     , param_(other.param_)
+    , dof_ownership_(other.dof_ownership_)
     , local_dof_vector_(target_.dofs().localize())
     , local_source_(source_->local_function())
     , target_basis_(target_.space().basis().localize())
@@ -88,16 +100,30 @@ public:
     local_source_->bind(element);
     local_dof_vector_.bind(element);
     target_basis_->bind(element);
+    if (!dof_ownership_) {
+      target_basis_->interpolate([&](const auto& xx) { return local_source_->evaluate(xx, param_); },
+                                 local_source_->order(param_),
+                                 local_dof_vector_);
+      return;
+    }
+    // owner-computes: interpolate locally, but only write those DoFs this element owns
     target_basis_->interpolate([&](const auto& xx) { return local_source_->evaluate(xx, param_); },
                                local_source_->order(param_),
-                               local_dof_vector_);
+                               local_dofs_);
+    const auto& global_indices = local_dof_vector_.global_indices();
+    const size_t element_index = dof_ownership_->grid_view().indexSet().index(element);
+    for (size_t ii = 0; ii < local_dof_vector_.size(); ++ii)
+      if (dof_ownership_->owns(element_index, global_indices[ii]))
+        local_dof_vector_.set_entry(ii, local_dofs_[ii]);
   }
 
 private:
   const std::unique_ptr<XT::Functions::GridFunctionInterface<XT::Grid::extract_entity_t<GV>, r, rC, R>> source_;
   TargetType& target_;
   XT::Common::Parameter param_;
+  const std::shared_ptr<const DofOwnershipType> dof_ownership_;
   LocalDofVectorType local_dof_vector_;
+  DynamicVector<R> local_dofs_;
   std::unique_ptr<LocalSourceType> local_source_;
   std::unique_ptr<TargetBasisType> target_basis_;
 }; // class DefaultInterpolationElementFunctor
@@ -125,11 +151,17 @@ default_interpolation(const XT::Functions::GridFunctionInterface<XT::Grid::extra
                       const GridView<IGVT>& interpolation_grid_view,
                       const XT::Common::Parameter& param = {})
 {
-  DefaultInterpolationElementFunctor<GV, r, rC, R, V, GridView<IGVT>> functor(source, target, param);
+  using FunctorType = DefaultInterpolationElementFunctor<GV, r, rC, R, V, GridView<IGVT>>;
+  // DoFs of FV and DG spaces belong to a single element, all other spaces may share DoFs between elements, which are
+  // then only written by their owning element to allow for a lock-free parallel walk
+  std::shared_ptr<const typename FunctorType::DofOwnershipType> dof_ownership;
+  if (target.space().type() != SpaceType::finite_volume && target.space().type() != SpaceType::discontinuous_lagrange)
+    dof_ownership = std::make_shared<const typename FunctorType::DofOwnershipType>(target.space().mapper(),
+                                                                                  interpolation_grid_view);
+  FunctorType functor(source, target, param, dof_ownership);
   auto walker = XT::Grid::Walker<GridView<IGVT>>(interpolation_grid_view);
   walker.append(functor);
-  // Basis functions other than FV do not seem to be thread safe. TODO: fix
-  walker.walk(/*parallel=*/target.space().type() == SpaceType::finite_volume);
+  walker.walk(/*parallel=*/true);
 } // ... default_interpolation(...)
 
 
@@ -129,10 +129,12 @@ public:
     // copy local matrix to global matrix
     test_space_->mapper().global_indices(element, global_test_indices_);
     ansatz_space_->mapper().global_indices(element, global_ansatz_indices_);
-    for (size_t ii = 0; ii < test_basis_->size(param_); ++ii)
-      for (size_t jj = 0; jj < ansatz_basis_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_[ii], global_ansatz_indices_[jj], scaling_ * local_matrix_[ii][jj]);
+    global_matrix_.add_to_entries(global_test_indices_,
+                                  global_ansatz_indices_,
+                                  local_matrix_,
+                                  scaling_,
+                                  test_basis_->size(param_),
+                                  ansatz_basis_->size(param_));
   } // ... apply_local(...)
 
 private:
@@ -272,22 +274,30 @@ public:
     test_space_->mapper().global_indices(outside_element, global_test_indices_out_);
     ansatz_space_->mapper().global_indices(inside_element, global_ansatz_indices_in_);
     ansatz_space_->mapper().global_indices(outside_element, global_ansatz_indices_out_);
-    for (size_t ii = 0; ii < test_basis_inside_->size(param_); ++ii) {
-      for (size_t jj = 0; jj < ansatz_basis_inside_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_in_[ii], global_ansatz_indices_in_[jj], scaling_ * local_matrix_in_in_[ii][jj]);
-      for (size_t jj = 0; jj < ansatz_basis_outside_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_in_[ii], global_ansatz_indices_out_[jj], scaling_ * local_matrix_in_out_[ii][jj]);
-    }
-    for (size_t ii = 0; ii < test_basis_outside_->size(param_); ++ii) {
-      for (size_t jj = 0; jj < ansatz_basis_inside_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_out_[ii], global_ansatz_indices_in_[jj], scaling_ * local_matrix_out_in_[ii][jj]);
-      for (size_t jj = 0; jj < ansatz_basis_outside_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_out_[ii], global_ansatz_indices_out_[jj], scaling_ * local_matrix_out_out_[ii][jj]);
-    }
+    const size_t test_size_in = test_basis_inside_->size(param_);
+    const size_t test_size_out = test_basis_outside_->size(param_);
+    const size_t ansatz_size_in = ansatz_basis_inside_->size(param_);
+    const size_t ansatz_size_out = ansatz_basis_outside_->size(param_);
+    global_matrix_.add_to_entries(
+        global_test_indices_in_, global_ansatz_indices_in_, local_matrix_in_in_, scaling_, test_size_in, ansatz_size_in);
+    global_matrix_.add_to_entries(global_test_indices_in_,
+                                  global_ansatz_indices_out_,
+                                  local_matrix_in_out_,
+                                  scaling_,
+                                  test_size_in,
+                                  ansatz_size_out);
+    global_matrix_.add_to_entries(global_test_indices_out_,
+                                  global_ansatz_indices_in_,
+                                  local_matrix_out_in_,
+                                  scaling_,
+                                  test_size_out,
+                                  ansatz_size_in);
+    global_matrix_.add_to_entries(global_test_indices_out_,
+                                  global_ansatz_indices_out_,
+                                  local_matrix_out_out_,
+                                  scaling_,
+                                  test_size_out,
+                                  ansatz_size_out);
   } // ... apply_local(...)
 
 private:
@@ -407,10 +417,12 @@ public:
     // copy local matrices to global matrix
     test_space_->mapper().global_indices(element, global_test_indices_);
     ansatz_space_->mapper().global_indices(element, global_ansatz_indices_);
-    for (size_t ii = 0; ii < test_basis_->size(param_); ++ii)
-      for (size_t jj = 0; jj < ansatz_basis_->size(param_); ++jj)
-        global_matrix_.add_to_entry(
-            global_test_indices_[ii], global_ansatz_indices_[jj], scaling_ * local_matrix_[ii][jj]);
+    global_matrix_.add_to_entries(global_test_indices_,
+                                  global_ansatz_indices_,
+                                  local_matrix_,
+                                  scaling_,
+                                  test_basis_->size(param_),
+                                  ansatz_basis_->size(param_));
   } // ... apply_local(...)
 
 private:
@@ -16,9 +16,11 @@
 #ifndef DUNE_GDT_LOCAL_ASSEMBLER_OPERATOR_FD_JACOBIAN_ASSEMBLERS_HH
 #define DUNE_GDT_LOCAL_ASSEMBLER_OPERATOR_FD_JACOBIAN_ASSEMBLERS_HH
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
+#include <dune/common/dynmatrix.hh>
 #include <dune/common/dynvector.hh>
 
 #include <dune/xt/common/float_cmp.hh>
@@ -43,6 +45,9 @@ namespace GDT {
  * \note This implementation is not optimal, since it requires a full source and range vector. This can only be fixed
  *       after refactoring local discrete functions and local dof vectors.
  *
+ * \note If param contains the key "analytical-jacobians" and the local operator provides a jacobian for the source
+ *       space, the local jacobian is obtained from LocalElementOperatorInterface::jacobian in a single pass instead.
+ *
  * See also LocalElementOperatorInterface for a description of the template arguments.
  *
  * \sa LocalElementOperatorInterface
@@ -96,6 +101,7 @@ public:
     , local_source_(source_.local_discrete_function())
     , local_range_(range_.local_discrete_function())
     , local_op_(local_operator.with_source(source_))
+    , analytical_(param_.has_key("analytical-jacobians") && local_op_->provides_jacobian(*source_space_))
   {
     source_.dofs().vector() = source_vector_;
   }
@@ -114,6 +120,7 @@ public:
     , local_source_(source_.local_discrete_function())
     , local_range_(range_.local_discrete_function())
     , local_op_(other.local_op_->with_source(source_))
+    , analytical_(other.analytical_)
   {
     source_.dofs().vector() = source_vector_;
   }
@@ -135,7 +142,20 @@ public:
     const size_t local_range_size = range_space_->mapper().local_size(element);
     if (range_DoFs_.size() < local_range_size)
       range_DoFs_.resize(local_range_size, 0);
+    if (local_jacobian_.rows() < local_range_size || local_jacobian_.cols() < local_source_size)
+      local_jacobian_.resize(std::max(local_jacobian_.rows(), local_range_size),
+                             std::max(local_jacobian_.cols(), local_source_size));
     local_range_->dofs().set_all(0);
+    if (analytical_) {
+      local_op_->jacobian(*local_range_, local_jacobian_, param_);
+      matrix_.add_to_entries(global_range_indices_,
+                             global_source_indices_,
+                             local_jacobian_,
+                             scaling_,
+                             local_range_size,
+                             local_source_size);
+      return;
+    }
     // apply op as is, keep the result, clear local range
     local_op_->apply(*local_range_, param_);
     for (size_t ii = 0; ii < local_range_size; ++ii)
@@ -154,11 +174,13 @@ public:
         auto derivative = (local_range_->dofs()[ii] - range_DoFs_[ii]) / eps;
         if (XT::Common::FloatCmp::eq(derivative, eps))
           derivative = 0;
-        matrix_.add_to_entry(global_range_indices_[ii], global_source_indices_[jj], scaling_ * derivative);
+        local_jacobian_[ii][jj] = derivative;
       }
       // restore source
       local_source_->dofs()[jj] = jjth_source_DoF;
     }
+    matrix_.add_to_entries(
+        global_range_indices_, global_source_indices_, local_jacobian_, scaling_, local_range_size, local_source_size);
   } // ... apply_local(...)
 
 private:
@@ -176,7 +198,9 @@ private:
   DynamicVector<size_t> global_source_indices_;
   DynamicVector<size_t> global_range_indices_;
   DynamicVector<F> range_DoFs_;
+  DynamicMatrix<F> local_jacobian_;
   const std::unique_ptr<LocalElementOperatorType> local_op_;
+  const bool analytical_;
 }; // class LocalElementOperatorFiniteDifferenceJacobianAssembler
 
 
@@ -190,6 +214,10 @@ private:
  * \note This implementation is not optimal, since it requires a full source and range vector. This can only be fixed
  *       after refactoring local discrete functions and local dof vectors.
  *
+ * \note If param contains the key "analytical-jacobians" and the local operator provides a jacobian for the source
+ *       space, the local jacobians are obtained from LocalIntersectionOperatorInterface::jacobian in a single pass
+ *       instead.
+ *
  * See also LocalIntersectionOperatorInterface for a description of the template arguments.
  *
  * \sa LocalIntersectionOperatorInterface
@@ -246,6 +274,7 @@ public:
     , local_range_inside_(range_.local_discrete_function())
     , local_range_outside_(range_.local_discrete_function())
     , local_op_(local_operator.with_source(source_))
+    , analytical_(param_.has_key("analytical-jacobians") && local_op_->provides_jacobian(*source_space_))
   {
     source_.dofs().vector() = source_vector_;
   }
@@ -266,6 +295,7 @@ public:
     , local_range_inside_(range_.local_discrete_function())
     , local_range_outside_(range_.local_discrete_function())
     , local_op_(other.local_op_->with_source(source_))
+    , analytical_(other.analytical_)
   {
     source_.dofs().vector() = source_vector_;
   }
@@ -292,6 +322,7 @@ public:
     const size_t local_range_outside_size = treat_outside ? range_space_->mapper().local_size(outside_element) : 0;
     if (range_DoFs_inside_.size() < local_range_inside_size)
       range_DoFs_inside_.resize(local_range_inside_size, 0);
+    ensure_size(local_jacobian_in_in_, local_range_inside_size, local_source_inside_size);
     local_range_inside_->dofs().set_all(0);
     if (treat_outside) {
       local_source_outside_->bind(outside_element);
@@ -300,8 +331,63 @@ public:
       range_space_->mapper().global_indices(outside_element, global_range_indices_outside_);
       if (range_DoFs_outside_.size() < local_range_outside_size)
         range_DoFs_outside_.resize(local_range_outside_size, 0);
+      ensure_size(local_jacobian_in_out_, local_range_inside_size, local_source_outside_size);
+      ensure_size(local_jacobian_out_in_, local_range_outside_size, local_source_inside_size);
+      ensure_size(local_jacobian_out_out_, local_range_outside_size, local_source_outside_size);
       local_range_outside_->dofs().set_all(0);
     }
+    if (analytical_) {
+      local_op_->jacobian(*local_range_inside_,
+                          *local_range_outside_,
+                          local_jacobian_in_in_,
+                          local_jacobian_in_out_,
+                          local_jacobian_out_in_,
+                          local_jacobian_out_out_,
+                          param_);
+    } else {
+      compute_local_jacobians_by_finite_differences(treat_outside,
+                                                    local_source_inside_size,
+                                                    local_source_outside_size,
+                                                    local_range_inside_size,
+                                                    local_range_outside_size);
+    }
+    // copy local jacobians to global matrix
+    matrix_.add_to_entries(global_range_indices_inside_,
+                           global_source_indices_inside_,
+                           local_jacobian_in_in_,
+                           scaling_,
+                           local_range_inside_size,
+                           local_source_inside_size);
+    if (treat_outside) {
+      matrix_.add_to_entries(global_range_indices_outside_,
+                             global_source_indices_inside_,
+                             local_jacobian_out_in_,
+                             scaling_,
+                             local_range_outside_size,
+                             local_source_inside_size);
+      matrix_.add_to_entries(global_range_indices_inside_,
+                             global_source_indices_outside_,
+                             local_jacobian_in_out_,
+                             scaling_,
+                             local_range_inside_size,
+                             local_source_outside_size);
+      matrix_.add_to_entries(global_range_indices_outside_,
+                             global_source_indices_outside_,
+                             local_jacobian_out_out_,
+                             scaling_,
+                             local_range_outside_size,
+                             local_source_outside_size);
+    }
+  } // ... apply_local(...)
+
+private:
+  // loops over all local source DoFs, perturbs them and observes the perturbation in the local range DoFs
+  void compute_local_jacobians_by_finite_differences(const bool treat_outside,
+                                                     const size_t local_source_inside_size,
+                                                     const size_t local_source_outside_size,
+                                                     const size_t local_range_inside_size,
+                                                     const size_t local_range_outside_size)
+  {
     // apply op as is, keep the result, clear local range
     local_op_->apply(*local_range_inside_, *local_range_outside_, param_);
     for (size_t ii = 0; ii < local_range_inside_size; ++ii)
@@ -321,22 +407,12 @@ public:
       // apply op with perturbed source DoF
       local_op_->apply(*local_range_inside_, *local_range_outside_, param_);
       // observe perturbation in inside range DoFs
-      add_perturbation_to_matrix(*local_range_inside_,
-                                 range_DoFs_inside_,
-                                 global_range_indices_inside_,
-                                 global_source_indices_inside_,
-                                 local_range_inside_size,
-                                 jj,
-                                 eps);
+      add_perturbation_to_local_jacobian(
+          *local_range_inside_, range_DoFs_inside_, local_jacobian_in_in_, local_range_inside_size, jj, eps);
       // observe perturbation in outside range DoFs
       if (treat_outside)
-        add_perturbation_to_matrix(*local_range_outside_,
-                                   range_DoFs_outside_,
-                                   global_range_indices_outside_,
-                                   global_source_indices_inside_,
-                                   local_range_outside_size,
-                                   jj,
-                                   eps);
+        add_perturbation_to_local_jacobian(
+            *local_range_outside_, range_DoFs_outside_, local_jacobian_out_in_, local_range_outside_size, jj, eps);
       // restore source
       local_source_inside_->dofs()[jj] = jjth_source_DoF;
     }
@@ -353,43 +429,38 @@ public:
         // apply op with perturbed source DoF
         local_op_->apply(*local_range_inside_, *local_range_outside_, param_);
         // observe perturbation in inside range DoFs
-        add_perturbation_to_matrix(*local_range_inside_,
-                                   range_DoFs_inside_,
-                                   global_range_indices_inside_,
-                                   global_source_indices_outside_,
-                                   local_range_inside_size,
-                                   jj,
-                                   eps);
+        add_perturbation_to_local_jacobian(
+            *local_range_inside_, range_DoFs_inside_, local_jacobian_in_out_, local_range_inside_size, jj, eps);
         // observe perturbation in outside range DoFs
-        add_perturbation_to_matrix(*local_range_outside_,
-                                   range_DoFs_outside_,
-                                   global_range_indices_outside_,
-                                   global_source_indices_outside_,
-                                   local_range_outside_size,
-                                   jj,
-                                   eps);
+        add_perturbation_to_local_jacobian(
+            *local_range_outside_, range_DoFs_outside_, local_jacobian_out_out_, local_range_outside_size, jj, eps);
         // restore source
         local_source_outside_->dofs()[jj] = jjth_source_DoF;
       }
     }
-  } // ... apply_local(...)
-
-private:
-  void add_perturbation_to_matrix(LocalDiscreteFunction<V, RGV, r_r, r_rC, F>& local_range,
-                                  const DynamicVector<F>& range_DoFs,
-                                  const DynamicVector<size_t>& global_range_indices,
-                                  const DynamicVector<size_t>& global_source_indices,
-                                  const size_t local_range_size,
-                                  const size_t jj,
-                                  const real_t<F> eps)
+  } // ... compute_local_jacobians_by_finite_differences(...)
+
+  // stores the derivatives of the range DoFs w.r.t. the jj-th source DoF in the jj-th column of local_jacobian
+  void add_perturbation_to_local_jacobian(LocalDiscreteFunction<V, RGV, r_r, r_rC, F>& local_range,
+                                          const DynamicVector<F>& range_DoFs,
+                                          DynamicMatrix<F>& local_jacobian,
+                                          const size_t local_range_size,
+                                          const size_t jj,
+                                          const real_t<F> eps)
   {
     for (size_t ii = 0; ii < local_range_size; ++ii) {
       auto derivative = (local_range.dofs()[ii] - range_DoFs[ii]) / eps;
       if (XT::Common::FloatCmp::eq(derivative, eps))
         derivative = 0;
-      matrix_.add_to_entry(global_range_indices[ii], global_source_indices[jj], scaling_ * derivative);
+      local_jacobian[ii][jj] = derivative;
     }
-  } // ... add_perturbation_to_matrix(...)
+  } // ... add_perturbation_to_local_jacobian(...)
+
+  static void ensure_size(DynamicMatrix<F>& local_jacobian, const size_t rows, const size_t cols)
+  {
+    if (local_jacobian.rows() < rows || local_jacobian.cols() < cols)
+      local_jacobian.resize(std::max(local_jacobian.rows(), rows), std::max(local_jacobian.cols(), cols));
+  }
 
   std::unique_ptr<const SourceSpaceType> source_space_;
   std::unique_ptr<const RangeSpaceType> range_space_;
@@ -410,7 +481,12 @@ private:
   DynamicVector<size_t> global_range_indices_outside_;
   DynamicVector<F> range_DoFs_inside_;
   DynamicVector<F> range_DoFs_outside_;
+  DynamicMatrix<F> local_jacobian_in_in_;
+  DynamicMatrix<F> local_jacobian_in_out_;
+  DynamicMatrix<F> local_jacobian_out_in_;
+  DynamicMatrix<F> local_jacobian_out_out_;
   const std::unique_ptr<LocalIntersectionOperatorType> local_op_;
+  const bool analytical_;
 }; // class LocalIntersectionOperatorFiniteDifferenceJacobianAssembler
 
 
@@ -16,11 +16,15 @@
 #ifndef DUNE_GDT_LOCAL_BILINEAR_FORMS_INTEGRALS_HH
 #define DUNE_GDT_LOCAL_BILINEAR_FORMS_INTEGRALS_HH
 
+#include <vector>
+
 #include <dune/geometry/quadraturerules.hh>
 
+#include <dune/gdt/local/finite-elements/tensor-product.hh>
 #include <dune/gdt/local/integrands/interfaces.hh>
 #include <dune/gdt/local/integrands/generic.hh>
 #include <dune/gdt/print.hh>
+#include <dune/gdt/spaces/basis/interface.hh>
 
 #include "interfaces.hh"
 
@@ -112,38 +116,166 @@ public:
     const auto& element = ansatz_basis.element();
     assert(test_basis.element() == element && "This must not happen!");
     integrand_->bind(element);
-    // prepare storage
-    const size_t rows = test_basis.size(param);
-    const size_t cols = ansatz_basis.size(param);
-    if (result.rows() < rows || result.cols() < cols)
-      result.resize(rows, cols);
-    result *= 0;
-    // loop over all quadrature points
+    // the rules are persistent, which allows the bases to reuse values tabulated for this rule
     const auto integrand_order = integrand_->order(test_basis, ansatz_basis) + over_integrate_;
-    const auto quadrature_rule = QuadratureRules<D, d>::rule(element.type(), integrand_order);
-    for (auto [point_in_reference_element, quadrature_weight] : quadrature_rule) {
-      // integration factors
-      const auto factor = element.geometry().integrationElement(point_in_reference_element) * quadrature_weight;
-      // evaluate the integrand
+    const auto& quadrature_rule = QuadratureRules<D, d>::rule(element.type(), integrand_order);
+    // integration factors
+    weights_.resize(quadrature_rule.size());
+    for (size_t qq = 0; qq < quadrature_rule.size(); ++qq) {
+      const auto& point_in_reference_element = quadrature_rule[qq].position();
+      weights_[qq] = element.geometry().integrationElement(point_in_reference_element) * quadrature_rule[qq].weight();
       LOG_(debug) << "   point_in_{reference_element|physical_space} = {" << print(point_in_reference_element) << "|"
                   << print(element.geometry().global(point_in_reference_element))
-                  << "},\n   integration_factor = " << factor << ", quadrature_weight = " << quadrature_weight
-                  << std::endl;
-      integrand_->evaluate(test_basis, ansatz_basis, point_in_reference_element, integrand_values_, param);
-      assert(integrand_values_.rows() >= rows && "This must not happen!");
-      assert(integrand_values_.cols() >= cols && "This must not happen!");
-      // compute integral
-      for (size_t ii = 0; ii < rows; ++ii)
-        for (size_t jj = 0; jj < cols; ++jj)
-          result[ii][jj] += integrand_values_[ii][jj] * factor;
-    } // loop over all quadrature points
+                  << "},\n   integration_factor * quadrature_weight = " << weights_[qq] << std::endl;
+    }
+    // compute integral (sizes and clears result)
+    integrand_->evaluate_all(test_basis, ansatz_basis, quadrature_rule, weights_, result, param);
     LOG_(debug) << "  result = " << result << std::endl;
   } // ... apply(...)
 
+  /**
+   * On cubes, the application is sum-factorized if both bases are localized global bases whose local finite elements
+   * factorize into one-dimensional Lagrange polynomials (see LocalTensorProductLagrangeBasis) and if the integrand
+   * supports the pointwise application (see LocalBinaryElementIntegrandInterface::pointwise_application). This costs
+   * O(p^{d + 1}) per element for polynomial degree p, compared to O(p^{3d}) for forming the local matrix by apply2().
+   * Otherwise, the local matrix is formed.
+   */
+  void apply(const LocalTestBasisType& test_basis,
+             const LocalAnsatzBasisType& ansatz_basis,
+             const DynamicVector<F>& ansatz_dofs,
+             DynamicVector<F>& result,
+             const XT::Common::Parameter& param = {}) const override final
+  {
+    LOG_(debug) << "apply(test_basis.size()=" << test_basis.size(param)
+                << ", ansatz_basis.size()=" << ansatz_basis.size(param) << ", param=" << print(param) << ")"
+                << std::endl;
+    if (!apply_sum_factorized(test_basis, ansatz_basis, ansatz_dofs, result, param))
+      BaseType::apply(test_basis, ansatz_basis, ansatz_dofs, result, param);
+  }
+
 private:
+  // returns false if sum factorization is not applicable
+  bool apply_sum_factorized(const LocalTestBasisType& test_basis,
+                            const LocalAnsatzBasisType& ansatz_basis,
+                            const DynamicVector<F>& ansatz_dofs,
+                            DynamicVector<F>& result,
+                            const XT::Common::Parameter& param) const
+  {
+    if constexpr (t_rC != 1 || a_rC != 1) {
+      return false;
+    } else {
+      const auto& element = ansatz_basis.element();
+      assert(test_basis.element() == element && "This must not happen!");
+      if (!element.type().isCube())
+        return false;
+      const auto pointwise = integrand_->pointwise_application();
+      if (!pointwise.available())
+        return false;
+      const auto* test_fe = dynamic_cast<const LocalizedGlobalFiniteElementInterface<E, t_r, 1, TR>*>(&test_basis);
+      const auto* ansatz_fe = dynamic_cast<const LocalizedGlobalFiniteElementInterface<E, a_r, 1, AR>*>(&ansatz_basis);
+      if (test_fe == nullptr || ansatz_fe == nullptr)
+        return false;
+      const auto* test_factorization = test_fe->finite_element().tensor_product_basis();
+      const auto* ansatz_factorization = ansatz_fe->finite_element().tensor_product_basis();
+      if (test_factorization == nullptr || ansatz_factorization == nullptr)
+        return false;
+      // prepare integrand and kernels, the kernels use the same points as the quadrature rule in apply2()
+      integrand_->bind(element);
+      const auto integrand_order = integrand_->order(test_basis, ansatz_basis, param) + over_integrate_;
+      const auto& test_kernel = test_factorization->kernel_for_order(integrand_order);
+      const auto& ansatz_kernel = ansatz_factorization->kernel_for_order(integrand_order);
+      const auto& points = ansatz_kernel.points();
+      const auto& quadrature_weights = ansatz_kernel.weights();
+      const size_t num_points = points.size();
+      const size_t test_size = test_factorization->size();
+      const size_t ansatz_size = ansatz_factorization->size();
+      // the ansatz function and its jacobian (w.r.t. the reference element) at all points
+      ansatz_values_.assign(num_points, typename LocalAnsatzBasisType::RangeType(0.));
+      ansatz_jacobians_.assign(num_points, typename LocalAnsatzBasisType::DerivativeRangeType(0.));
+      for (size_t rr = 0; rr < a_r; ++rr) {
+        if (pointwise.ansatz_values) {
+          ansatz_kernel.evaluate(ansatz_dofs, ansatz_scalar_values_, ansatz_workspace_, rr * ansatz_size);
+          for (size_t qq = 0; qq < num_points; ++qq)
+            ansatz_values_[qq][rr] = ansatz_scalar_values_[qq];
+        }
+        if (pointwise.ansatz_jacobians) {
+          ansatz_kernel.evaluate_reference_gradients(
+              ansatz_dofs, ansatz_reference_gradients_, ansatz_workspace_, rr * ansatz_size);
+          for (size_t qq = 0; qq < num_points; ++qq)
+            ansatz_jacobians_[qq][rr] = ansatz_reference_gradients_[qq];
+        }
+      }
+      // the integrand at all points, times the integration factors
+      test_values_.assign(num_points, typename LocalTestBasisType::RangeType(0.));
+      test_jacobians_.assign(num_points, typename LocalTestBasisType::DerivativeRangeType(0.));
+      const auto& geometry = element.geometry();
+      auto jacobian_inverse_transposed = geometry.jacobianInverseTransposed(points[0]);
+      auto integration_element = geometry.integrationElement(points[0]);
+      for (size_t qq = 0; qq < num_points; ++qq) {
+        if (qq > 0 && !geometry.affine()) {
+          jacobian_inverse_transposed = geometry.jacobianInverseTransposed(points[qq]);
+          integration_element = geometry.integrationElement(points[qq]);
+        }
+        // the gradients w.r.t. physical coordinates are J^{-T} times the reference gradients (see DefaultGlobalBasis)
+        if (pointwise.ansatz_jacobians)
+          for (size_t rr = 0; rr < a_r; ++rr) {
+            ansatz_reference_gradient_ = ansatz_jacobians_[qq][rr];
+            jacobian_inverse_transposed.mv(ansatz_reference_gradient_, ansatz_jacobians_[qq][rr]);
+          }
+        integrand_->apply_pointwise(
+            points[qq], ansatz_values_[qq], ansatz_jacobians_[qq], test_values_[qq], test_jacobians_[qq], param);
+        const F factor = integration_element * quadrature_weights[qq];
+        test_values_[qq] *= factor;
+        // since G : (J_phi_ref J^{-1}) = (G J^{-T}) : J_phi_ref, the rows of G are mapped by J^{-1}
+        if (pointwise.test_jacobians)
+          for (size_t rr = 0; rr < t_r; ++rr) {
+            jacobian_inverse_transposed.mtv(test_jacobians_[qq][rr], test_reference_gradient_);
+            test_jacobians_[qq][rr] = test_reference_gradient_;
+            test_jacobians_[qq][rr] *= factor;
+          }
+      }
+      // integrate against the test basis
+      const size_t rows = test_basis.size(param);
+      if (result.size() < rows)
+        result.resize(rows);
+      for (size_t ii = 0; ii < rows; ++ii)
+        result[ii] = 0.;
+      for (size_t rr = 0; rr < t_r; ++rr) {
+        if (pointwise.test_values) {
+          test_scalar_values_.resize(num_points);
+          for (size_t qq = 0; qq < num_points; ++qq)
+            test_scalar_values_[qq] = test_values_[qq][rr];
+          test_kernel.integrate(test_scalar_values_, result, test_workspace_, rr * test_size);
+        }
+        if (pointwise.test_jacobians) {
+          test_reference_gradients_.resize(num_points);
+          for (size_t qq = 0; qq < num_points; ++qq)
+            test_reference_gradients_[qq] = test_jacobians_[qq][rr];
+          test_kernel.integrate_reference_gradients(test_reference_gradients_, result, test_workspace_, rr * test_size);
+        }
+      }
+      return true;
+    }
+  } // ... apply_sum_factorized(...)
+
+  using TestKernelType = LocalSumFactorizationKernel<D, d, TR>;
+  using AnsatzKernelType = LocalSumFactorizationKernel<D, d, AR>;
+
   mutable std::unique_ptr<IntegrandType> integrand_;
   const int over_integrate_;
-  mutable DynamicMatrix<F> integrand_values_;
+  mutable std::vector<F> weights_;
+  mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_values_;
+  mutable std::vector<typename LocalAnsatzBasisType::DerivativeRangeType> ansatz_jacobians_;
+  mutable std::vector<typename LocalTestBasisType::RangeType> test_values_;
+  mutable std::vector<typename LocalTestBasisType::DerivativeRangeType> test_jacobians_;
+  mutable std::vector<AR> ansatz_scalar_values_;
+  mutable std::vector<typename AnsatzKernelType::GradientType> ansatz_reference_gradients_;
+  mutable std::vector<TR> test_scalar_values_;
+  mutable std::vector<typename TestKernelType::GradientType> test_reference_gradients_;
+  mutable typename AnsatzKernelType::GradientType ansatz_reference_gradient_;
+  mutable typename TestKernelType::GradientType test_reference_gradient_;
+  mutable typename AnsatzKernelType::Workspace ansatz_workspace_;
+  mutable typename TestKernelType::Workspace test_workspace_;
 }; // class LocalElementIntegralBilinearForm
 
 
@@ -217,72 +349,34 @@ public:
   {
     // prepare integand
     integrand_->bind(intersection);
-    // prepare storage
-    const size_t rows_in = test_basis_inside.size(param);
-    const size_t rows_out = test_basis_outside.size(param);
-    const size_t cols_in = ansatz_basis_inside.size(param);
-    const size_t cols_out = ansatz_basis_outside.size(param);
-    const auto ensure_size_and_clear = [](auto& m, const auto& r, const auto& c) {
-      if (m.rows() < r || m.cols() < c)
-        m.resize(r, c);
-      m *= 0;
-    };
-    ensure_size_and_clear(result_in_in, rows_in, cols_in);
-    ensure_size_and_clear(result_in_out, rows_in, cols_out);
-    ensure_size_and_clear(result_out_in, rows_out, cols_in);
-    ensure_size_and_clear(result_out_out, rows_out, cols_out);
-    // loop over all quadrature points
+    // integration factors
     const size_t integrand_order =
         integrand_->order(test_basis_inside, ansatz_basis_inside, test_basis_outside, ansatz_basis_outside)
         + over_integrate_;
-    for (const auto& quadrature_point :
-         QuadratureRules<D, d - 1>::rule(intersection.type(), XT::Common::numeric_cast<int>(integrand_order))) {
-      const auto point_in_reference_intersection = quadrature_point.position();
-      // integration factors
-      const auto integration_factor = intersection.geometry().integrationElement(point_in_reference_intersection);
-      const auto quadrature_weight = quadrature_point.weight();
-      // evaluate the integrand
-      integrand_->evaluate(test_basis_inside,
-                           ansatz_basis_inside,
-                           test_basis_outside,
-                           ansatz_basis_outside,
-                           point_in_reference_intersection,
-                           integrand_values_in_in_,
-                           integrand_values_in_out_,
-                           integrand_values_out_in_,
-                           integrand_values_out_out_,
-                           param);
-      assert(integrand_values_in_in_.rows() >= rows_in && "This must not happen!");
-      assert(integrand_values_in_in_.cols() >= cols_in && "This must not happen!");
-      assert(integrand_values_in_out_.rows() >= rows_in && "This must not happen!");
-      assert(integrand_values_in_out_.cols() >= cols_out && "This must not happen!");
-      assert(integrand_values_out_in_.rows() >= rows_out && "This must not happen!");
-      assert(integrand_values_out_in_.cols() >= cols_in && "This must not happen!");
-      assert(integrand_values_out_out_.rows() >= rows_out && "This must not happen!");
-      assert(integrand_values_out_out_.cols() >= cols_out && "This must not happen!");
-      // compute integral
-      for (size_t ii = 0; ii < rows_in; ++ii) {
-        for (size_t jj = 0; jj < cols_in; ++jj)
-          result_in_in[ii][jj] += integrand_values_in_in_[ii][jj] * integration_factor * quadrature_weight;
-        for (size_t jj = 0; jj < cols_out; ++jj)
-          result_in_out[ii][jj] += integrand_values_in_out_[ii][jj] * integration_factor * quadrature_weight;
-      }
-      for (size_t ii = 0; ii < rows_out; ++ii) {
-        for (size_t jj = 0; jj < cols_in; ++jj)
-          result_out_in[ii][jj] += integrand_values_out_in_[ii][jj] * integration_factor * quadrature_weight;
-        for (size_t jj = 0; jj < cols_out; ++jj)
-          result_out_out[ii][jj] += integrand_values_out_out_[ii][jj] * integration_factor * quadrature_weight;
-      }
-    } // loop over all quadrature points
+    const auto& quadrature_rule =
+        QuadratureRules<D, d - 1>::rule(intersection.type(), XT::Common::numeric_cast<int>(integrand_order));
+    weights_.resize(quadrature_rule.size());
+    for (size_t qq = 0; qq < quadrature_rule.size(); ++qq)
+      weights_[qq] = intersection.geometry().integrationElement(quadrature_rule[qq].position())
+                     * quadrature_rule[qq].weight();
+    // compute integral (sizes and clears the results)
+    integrand_->evaluate_all(test_basis_inside,
+                             ansatz_basis_inside,
+                             test_basis_outside,
+                             ansatz_basis_outside,
+                             quadrature_rule,
+                             weights_,
+                             result_in_in,
+                             result_in_out,
+                             result_out_in,
+                             result_out_out,
+                             param);
   } // ... apply2(...)
 
 private:
   mutable std::unique_ptr<IntegrandType> integrand_;
   const int over_integrate_;
-  mutable DynamicMatrix<F> integrand_values_in_in_;
-  mutable DynamicMatrix<F> integrand_values_in_out_;
-  mutable DynamicMatrix<F> integrand_values_out_in_;
-  mutable DynamicMatrix<F> integrand_values_out_out_;
+  mutable std::vector<F> weights_;
 }; // class LocalCouplingIntersectionIntegralBilinearForm
 
 
@@ -356,36 +450,22 @@ public:
   {
     // prepare integand
     integrand_->bind(intersection);
-    // prepare storage
-    const size_t rows = test_basis.size(param);
-    const size_t cols = ansatz_basis.size(param);
-    if (result.rows() < rows || result.cols() < cols)
-      result.resize(rows, cols);
-    result *= 0;
-    // loop over all quadrature points
+    // integration factors
     const size_t integrand_order = integrand_->order(test_basis, ansatz_basis) + over_integrate_;
-    const auto quadrature_rule =
+    const auto& quadrature_rule =
         QuadratureRules<D, d - 1>::rule(intersection.geometry().type(), XT::Common::numeric_cast<int>(integrand_order));
-    for (const auto& quadrature_point : quadrature_rule) {
-      const auto point_in_reference_intersection = quadrature_point.position();
-      // integration factors
-      const auto integration_factor = intersection.geometry().integrationElement(point_in_reference_intersection);
-      const auto quadrature_weight = quadrature_point.weight();
-      // evaluate the integrand
-      integrand_->evaluate(test_basis, ansatz_basis, point_in_reference_intersection, integrand_values_, param);
-      assert(integrand_values_.rows() >= rows && "This must not happen!");
-      assert(integrand_values_.cols() >= cols && "This must not happen!");
-      // compute integral
-      for (size_t ii = 0; ii < rows; ++ii)
-        for (size_t jj = 0; jj < cols; ++jj)
-          result[ii][jj] += integrand_values_[ii][jj] * integration_factor * quadrature_weight;
-    }
+    weights_.resize(quadrature_rule.size());
+    for (size_t qq = 0; qq < quadrature_rule.size(); ++qq)
+      weights_[qq] = intersection.geometry().integrationElement(quadrature_rule[qq].position())
+                     * quadrature_rule[qq].weight();
+    // compute integral (sizes and clears result)
+    integrand_->evaluate_all(test_basis, ansatz_basis, quadrature_rule, weights_, result, param);
   } // ... apply2(...)
 
 private:
   mutable std::unique_ptr<IntegrandType> integrand_;
   const int over_integrate_;
-  mutable DynamicMatrix<F> integrand_values_;
+  mutable std::vector<F> weights_;
 }; // class LocalIntersectionIntegralBilinearForm
 
 
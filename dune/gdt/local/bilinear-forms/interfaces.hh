@@ -15,10 +15,12 @@
 #ifndef DUNE_GDT_LOCAL_BILINEAR_FORMS_INTERFACES_HH
 #define DUNE_GDT_LOCAL_BILINEAR_FORMS_INTERFACES_HH
 
+#include <cassert>
 #include <memory>
 #include <vector>
 
 #include <dune/common/dynmatrix.hh>
+#include <dune/common/dynvector.hh>
 
 #include <dune/xt/common/parameter.hh>
 #include <dune/xt/common/timedlogging.hh>
@@ -124,6 +126,35 @@ public:
     this->apply2(test_basis, ansatz_basis, result, param);
     return result;
   }
+
+  /**
+   * Computes the application of this bilinear form to the local function given by ansatz_dofs (w.r.t. the ansatz
+   * basis) for all functions from the test basis, i.e. `result = apply2(test_basis, ansatz_basis) * ansatz_dofs`.
+   *
+   * The default implementation forms the local matrix by calling apply2(), implementations may override this to avoid
+   * that (see LocalElementIntegralBilinearForm).
+   */
+  virtual void apply(const LocalTestBasisType& test_basis,
+                     const LocalAnsatzBasisType& ansatz_basis,
+                     const DynamicVector<F>& ansatz_dofs,
+                     DynamicVector<F>& result,
+                     const XT::Common::Parameter& param = {}) const
+  {
+    this->apply2(test_basis, ansatz_basis, local_matrix_, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    assert(ansatz_dofs.size() >= cols);
+    if (result.size() < rows)
+      result.resize(rows);
+    for (size_t ii = 0; ii < rows; ++ii) {
+      result[ii] = 0.;
+      for (size_t jj = 0; jj < cols; ++jj)
+        result[ii] += local_matrix_[ii][jj] * ansatz_dofs[jj];
+    }
+  } // ... apply(...)
+
+private:
+  mutable DynamicMatrix<F> local_matrix_;
 }; // class LocalElementBilinearFormInterface
 
 
@@ -131,6 +131,16 @@ public:
     return global_vector_;
   }
 
+  /**
+   * \brief The global indices of the local DoFs on the element this vector is bound to.
+   * \note  Only the first size() entries are valid.
+   */
+  const DynamicVector<size_t>& global_indices() const
+  {
+    DUNE_THROW_IF(!this->is_bound_, Exceptions::not_bound_to_an_element_yet, "");
+    return global_DoF_indices_;
+  }
+
   size_t size() const
   {
     DUNE_THROW_IF(!this->is_bound_, Exceptions::not_bound_to_an_element_yet, "");
@@ -293,13 +303,17 @@ protected:
 
 public:
   /**
-   * \note This is not thread-safe without the mutex because operator[] is not thread-safe for the vectors from
-   *dune-xt-la. \todo The mutex here is just a quick fix, properly fix thread safety.
+   * \brief Direct (unsynchronized) access to the global DoF associated with the ii-th local DoF.
+   *
+   * \note No locking takes place here: the returned reference points into the global vector, so concurrent writes to
+   *       the same global DoF from several threads (e.g., to DoFs shared between neighbouring elements of a continuous
+   *       space) are a data race. Parallel element functors writing into a LocalDofVector thus have to ensure that
+   *       each global DoF is only written by one thread, e.g. by only writing the DoFs an element owns (see
+   *       DofOwnership in dune/gdt/tools/dof-ownership.hh). Accumulating writes may use add_to_entry() instead, which
+   *       is synchronized by the global vector.
    **/
   ScalarType& operator[](const size_t ii)
   {
-    static std::mutex mutex;
-    [[maybe_unused]] std::lock_guard<std::mutex> guard{mutex};
     DUNE_THROW_IF(!this->is_bound_, Exceptions::not_bound_to_an_element_yet, "");
     assert(ii < size_);
     return global_vector_[global_DoF_indices_[ii]];
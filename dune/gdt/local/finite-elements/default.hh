@@ -15,12 +15,17 @@
 #ifndef DUNE_GDT_LOCAL_FINITE_ELEMENTS_DEFAULT_HH
 #define DUNE_GDT_LOCAL_FINITE_ELEMENTS_DEFAULT_HH
 
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
 #include <dune/geometry/quadraturerules.hh>
 
 #include <dune/xt/common/memory.hh>
 #include <dune/xt/grid/integrals.hh>
 
 #include "interfaces.hh"
+#include "tensor-product.hh"
 
 namespace Dune {
 namespace GDT {
@@ -54,6 +59,7 @@ public:
     , lagrange_points_(lps)
   {
     check_input();
+    detect_tensor_product_basis();
   }
 
   /**
@@ -74,6 +80,7 @@ public:
     , powered_(pwrd)
   {
     check_input();
+    detect_tensor_product_basis();
   }
 
   LocalFiniteElementDefault(const int ord,
@@ -91,6 +98,7 @@ public:
     , powered_(pwrd)
   {
     check_input();
+    detect_tensor_product_basis();
   }
 
   const GeometryType& geometry_type() const override
@@ -140,6 +148,11 @@ public:
     return powered_;
   }
 
+  const LocalTensorProductLagrangeBasis<D, d, R>* tensor_product_basis() const override final
+  {
+    return tensor_product_basis_.get();
+  }
+
 private:
   void check_input()
   {
@@ -166,6 +179,13 @@ private:
                                                     << basis_.access().size() / (r * rC));
   } // ... check_input(...)
 
+  void detect_tensor_product_basis()
+  {
+    if constexpr (d > 0 && rC == 1)
+      tensor_product_basis_ =
+          LocalTensorProductLagrangeBasis<D, d, R>::detect(geometry_type_, basis_.access(), lagrange_points_);
+  }
+
   const GeometryType geometry_type_;
   const int order_;
   const XT::Common::ConstStorageProvider<BasisType> basis_;
@@ -173,13 +193,15 @@ private:
   const XT::Common::ConstStorageProvider<InterpolationType> interpolation_;
   const std::vector<DomainType> lagrange_points_;
   const bool powered_;
+  std::shared_ptr<const LocalTensorProductLagrangeBasis<D, d, R>> tensor_product_basis_;
 }; // class LocalFiniteElementDefault
 
 
 /**
  * \brief Implements LocalFiniteElementFamilyInterface by lazily creating and caching local finite elements from a
  *        user-provided factory, with creation guarded by a mutex.
- * \note  See the implementation of get() for a caveat regarding the double-checked locking pattern used here.
+ * \note  Lookups of existing FEs only take a shared (reader) lock, so concurrent get() calls from several threads do
+ *        not serialize once all required FEs have been created.
  */
 template <class D, size_t d, class R = double, size_t r = 1, size_t rC = 1>
 class ThreadSafeDefaultLocalFiniteElementFamily : public LocalFiniteElementFamilyInterface<D, d, R, r, rC>
@@ -211,23 +233,27 @@ public:
   const LocalFiniteElementType& get(const GeometryType& geometry_type, const int order) const override final
   {
     const auto key = std::make_pair(geometry_type, order);
-    // if the FE already exists, no need to lock since at() is thread safe and we are returning the object reference,
-    // not a map iterator which might get invalidated
-    // TODO: Double checked locking pattern is not thread-safe without memory barriers.
-    if (fes_.count(key) == 0) {
-      // the FE needs to be created, we need to lock
-      [[maybe_unused]] std::lock_guard<std::mutex> guard(mutex_);
-      // and to check again if someone else created the FE while we were waiting to acquire the lock
-      if (fes_.count(key) == 0)
-        fes_[key] = factory_(geometry_type, order);
+    {
+      // if the FE already exists, a shared lock suffices: readers do not block each other and we are returning the
+      // object reference, not a map iterator which might get invalidated by a later insertion
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> read_guard(mutex_);
+      const auto search_result = fes_.find(key);
+      if (search_result != fes_.end())
+        return *search_result->second;
     }
-    return *fes_.at(key);
+    // the FE needs to be created, we need to lock exclusively
+    [[maybe_unused]] std::unique_lock<std::shared_mutex> write_guard(mutex_);
+    // and to check again if someone else created the FE while we were waiting to acquire the lock
+    auto& fe = fes_[key];
+    if (!fe)
+      fe = factory_(geometry_type, order);
+    return *fe;
   } // ... get(...)
 
 private:
   const std::function<std::unique_ptr<LocalFiniteElementType>(const GeometryType&, const int&)> factory_;
   mutable std::map<std::pair<GeometryType, int>, std::unique_ptr<LocalFiniteElementType>> fes_;
-  mutable std::mutex mutex_;
+  mutable std::shared_mutex mutex_;
 }; // class ThreadSafeDefaultLocalFiniteElementFamily
 
 
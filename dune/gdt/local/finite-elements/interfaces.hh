@@ -29,6 +29,7 @@
 
 #include <dune/localfunctions/common/localkey.hh>
 
+#include <dune/xt/common/parallel/threadstorage.hh>
 #include <dune/xt/functions/type_traits.hh>
 
 #include <dune/gdt/exceptions.hh>
@@ -136,11 +137,13 @@ public:
                    LocalDofVector<V, GV>& dofs) const
   {
     const size_t sz = this->size();
-    if (dofs_.size() < sz)
-      dofs_.resize(sz);
-    this->interpolate(local_function, order, dofs_);
+    // local finite elements are shared between threads, so each thread requires its own scratch vector
+    auto& local_dofs = *dofs_;
+    if (local_dofs.size() < sz)
+      local_dofs.resize(sz);
+    this->interpolate(local_function, order, local_dofs);
     for (size_t ii = 0; ii < sz; ++ii)
-      dofs[ii] = dofs_[ii];
+      dofs[ii] = local_dofs[ii];
   } // ... interpolate(...)
 
   /// \name ``These methods are provided for convenience and should not be used within library code.''
@@ -156,7 +159,7 @@ public:
 
   /// \}
 private:
-  mutable DynamicVector<R> dofs_;
+  mutable XT::Common::PerThreadValue<DynamicVector<R>> dofs_;
 }; // class LocalFiniteElementInterpolationInterface
 
 
@@ -264,6 +267,11 @@ for (size_t codim = 0; codim < codim_to_subentity_index_to_key_indices_map.size(
 }; // class LocalFiniteElementCoefficientsInterface
 
 
+// forward, required in LocalFiniteElementInterface
+template <class D, size_t d, class R>
+class LocalTensorProductLagrangeBasis;
+
+
 /**
  * \brief Interface for a local finite element, combining its basis, coefficients and interpolation.
  */
@@ -357,6 +365,17 @@ for (size_t ii = 0; ii < lagrange_points.size(); ++ii)
     else
       DUNE_THROW(Exceptions::finite_element_error, "do not call lagrange_points() if is_lagrangian() is false!");
   }
+
+  /**
+   * \brief The factorization of the basis into one-dimensional Lagrange polynomials, if available (nullptr otherwise).
+   *
+   * Allows to use sum-factorization kernels on cubes, see LocalTensorProductLagrangeBasis for the meaning in the
+   * vector-valued case.
+   */
+  virtual const LocalTensorProductLagrangeBasis<D, d, R>* tensor_product_basis() const
+  {
+    return nullptr;
+  }
 }; // class LocalFiniteElementInterface
 
 
@@ -27,6 +27,7 @@
 #include <dune/common/typetraits.hh>
 
 #include <dune/xt/common/memory.hh>
+#include <dune/xt/common/parallel/threadstorage.hh>
 
 #include "interfaces.hh"
 #include "default.hh"
@@ -98,8 +99,9 @@ public:
   void evaluate(const DomainType& point_in_reference_element, std::vector<RangeType>& result) const override final
   {
     const size_t unpowered_sz = unpowered_->size();
-    unpowered_->evaluate(point_in_reference_element, unpowered_values_);
-    assert(unpowered_values_.size() >= unpowered_sz);
+    auto& unpowered_values = *unpowered_values_;
+    unpowered_->evaluate(point_in_reference_element, unpowered_values);
+    assert(unpowered_values.size() >= unpowered_sz);
     const size_t sz = this->size();
     if (result.size() < sz)
       result.resize(sz);
@@ -107,7 +109,7 @@ public:
       for (size_t ii = 0; ii < unpowered_sz; ++ii) {
         result[pp * unpowered_sz + ii] *= 0.;
         for (size_t rr = 0; rr < r; ++rr)
-          result[pp * unpowered_sz + ii][pp * r + rr] = unpowered_values_[ii][rr];
+          result[pp * unpowered_sz + ii][pp * r + rr] = unpowered_values[ii][rr];
       }
   } // ... evaluate(...)
 
@@ -117,8 +119,9 @@ public:
                 std::vector<DerivativeRangeType>& result) const override final
   {
     const size_t unpowered_sz = unpowered_->size();
-    unpowered_->jacobian(point_in_reference_element, unpowered_jacobians_);
-    assert(unpowered_jacobians_.size() >= unpowered_sz);
+    auto& unpowered_jacobians = *unpowered_jacobians_;
+    unpowered_->jacobian(point_in_reference_element, unpowered_jacobians);
+    assert(unpowered_jacobians.size() >= unpowered_sz);
     const size_t sz = this->size();
     if (result.size() < sz)
       result.resize(sz);
@@ -126,14 +129,15 @@ public:
       for (size_t ii = 0; ii < unpowered_sz; ++ii) {
         result[pp * unpowered_sz + ii] *= 0.;
         for (size_t rr = 0; rr < r; ++rr)
-          result[pp * unpowered_sz + ii][pp * r + rr] = unpowered_jacobians_[ii][rr];
+          result[pp * unpowered_sz + ii][pp * r + rr] = unpowered_jacobians[ii][rr];
       }
   } // ... jacobian(...)
 
 private:
   const std::unique_ptr<const UnpoweredType> unpowered_;
-  mutable std::vector<typename UnpoweredType::RangeType> unpowered_values_;
-  mutable std::vector<typename UnpoweredType::DerivativeRangeType> unpowered_jacobians_;
+  // the basis is shared between threads, so each thread requires its own scratch storage
+  mutable XT::Common::PerThreadValue<std::vector<typename UnpoweredType::RangeType>> unpowered_values_;
+  mutable XT::Common::PerThreadValue<std::vector<typename UnpoweredType::DerivativeRangeType>> unpowered_jacobians_;
 }; // class LocalPowerFiniteElementBasis
 
 
@@ -197,19 +201,21 @@ public:
                    DynamicVector<R>& dofs) const override final
   {
     const size_t unpowered_sz = unpowered_->size();
-    if (unpowered_dofs_.size() < unpowered_sz)
-      unpowered_dofs_.resize(unpowered_sz);
+    auto& unpowered_dofs = *unpowered_dofs_;
+    auto& eval_cache = *eval_cache_;
+    if (unpowered_dofs.size() < unpowered_sz)
+      unpowered_dofs.resize(unpowered_sz);
     const size_t sz = this->size();
     if (dofs.size() < sz)
       dofs.resize(sz);
-    eval_cache_.clear();
+    eval_cache.clear();
     for (size_t pp = 0; pp < power; ++pp) {
       unpowered_->interpolate(
           [&](const auto& point_in_reference_element) {
-            auto cache_it = eval_cache_.find(point_in_reference_element);
-            if (cache_it == eval_cache_.end())
+            auto cache_it = eval_cache.find(point_in_reference_element);
+            if (cache_it == eval_cache.end())
               cache_it =
-                  eval_cache_
+                  eval_cache
                       .insert(std::make_pair(point_in_reference_element, local_function(point_in_reference_element)))
                       .first;
             const RangeType& tmp = cache_it->second;
@@ -219,17 +225,18 @@ public:
             return ret;
           },
           order,
-          unpowered_dofs_);
-      assert(unpowered_dofs_.size() >= unpowered_sz);
+          unpowered_dofs);
+      assert(unpowered_dofs.size() >= unpowered_sz);
       for (size_t ii = 0; ii < unpowered_sz; ++ii)
-        dofs[pp * unpowered_sz + ii] = unpowered_dofs_[ii];
+        dofs[pp * unpowered_sz + ii] = unpowered_dofs[ii];
     }
   } // ... interpolate(...)
 
 private:
   const std::unique_ptr<const UnpoweredType> unpowered_;
-  mutable DynamicVector<R> unpowered_dofs_;
-  mutable std::map<DomainType, RangeType, XT::Common::FieldVectorLess> eval_cache_;
+  // the interpolation is shared between threads, so each thread requires its own scratch storage
+  mutable XT::Common::PerThreadValue<DynamicVector<R>> unpowered_dofs_;
+  mutable XT::Common::PerThreadValue<std::map<DomainType, RangeType, XT::Common::FieldVectorLess>> eval_cache_;
 }; // class LocalPowerFiniteElementInterpolation
 
 
@@ -0,0 +1,186 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/**
+ * \file  tabulation.hh
+ * \brief Tabulated values and reference jacobians of local finite element bases at the points of quadrature rules.
+ **/
+#ifndef DUNE_GDT_LOCAL_FINITE_ELEMENTS_TABULATION_HH
+#define DUNE_GDT_LOCAL_FINITE_ELEMENTS_TABULATION_HH
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/type.hh>
+
+#include "interfaces.hh"
+
+namespace Dune {
+namespace GDT {
+
+
+/**
+ * \brief The values and jacobians (w.r.t. the reference element) of all functions of a local finite element basis at
+ *        all points of a quadrature rule.
+ *
+ * Computed once on construction and immutable afterwards, so a single instance may be shared between all threads.
+ */
+template <class D, size_t d, class R, size_t r, size_t rC = 1>
+class LocalFiniteElementBasisTabulation
+{
+public:
+  using BasisType = LocalFiniteElementBasisInterface<D, d, R, r, rC>;
+  using DomainType = typename BasisType::DomainType;
+  using RangeType = typename BasisType::RangeType;
+  using DerivativeRangeType = typename BasisType::DerivativeRangeType;
+  using QuadratureType = QuadratureRule<D, d>;
+
+  LocalFiniteElementBasisTabulation(const BasisType& basis, const QuadratureType& quadrature)
+    : basis_size_(basis.size())
+    , points_(quadrature.size())
+    , values_(quadrature.size())
+    , reference_jacobians_(quadrature.size())
+  {
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      points_[qq] = quadrature[qq].position();
+      basis.evaluate(points_[qq], values_[qq]);
+      basis.jacobian(points_[qq], reference_jacobians_[qq]);
+    }
+  }
+
+  /// \brief The number of tabulated quadrature points.
+  size_t size() const
+  {
+    return points_.size();
+  }
+
+  size_t basis_size() const
+  {
+    return basis_size_;
+  }
+
+  /// \brief Returns true if this tabulation may serve evaluations at the point_index-th point of quadrature.
+  bool matches(const QuadratureType& quadrature, const size_t point_index) const
+  {
+    return quadrature.size() == points_.size() && point_index < points_.size()
+           && quadrature[point_index].position() == points_[point_index];
+  }
+
+  const DomainType& point(const size_t point_index) const
+  {
+    return points_[point_index];
+  }
+
+  const std::vector<RangeType>& values(const size_t point_index) const
+  {
+    return values_[point_index];
+  }
+
+  const std::vector<DerivativeRangeType>& reference_jacobians(const size_t point_index) const
+  {
+    return reference_jacobians_[point_index];
+  }
+
+private:
+  const size_t basis_size_;
+  std::vector<DomainType> points_;
+  std::vector<std::vector<RangeType>> values_;
+  std::vector<std::vector<DerivativeRangeType>> reference_jacobians_;
+}; // class LocalFiniteElementBasisTabulation
+
+
+/**
+ * \brief Thread-safe cache of tabulations of the bases of a single family of local finite elements.
+ *
+ * Tabulations are identified by value, i.e., by the geometry type, order and size of the basis (which identify it
+ * within a family) and by the points of the quadrature rule. Rules with the same points thus share a tabulation, be
+ * they obtained from QuadratureRules or created temporarily, and an entry can never be hit through the reused address
+ * of a destroyed basis or rule.
+ *
+ * At most max_size tabulations are kept, the cache is cleared once it is full (temporary rules with ever new points,
+ * e.g. on nonconforming intersections, would let it grow without bound otherwise). The returned tabulations are
+ * shared, so they stay valid as long as they are used.
+ */
+template <class D, size_t d, class R, size_t r, size_t rC = 1>
+class LocalFiniteElementBasisTabulationCache
+{
+public:
+  using TabulationType = LocalFiniteElementBasisTabulation<D, d, R, r, rC>;
+  using BasisType = typename TabulationType::BasisType;
+  using QuadratureType = typename TabulationType::QuadratureType;
+
+  explicit LocalFiniteElementBasisTabulationCache(const size_t max_size = 256)
+    : max_size_(max_size)
+  {
+  }
+
+  std::shared_ptr<const TabulationType> get(const BasisType& basis, const QuadratureType& quadrature) const
+  {
+    KeyType key(basis, quadrature);
+    {
+      std::shared_lock<std::shared_mutex> shared_lock(mutex_);
+      const auto search_result = tabulations_.find(key);
+      if (search_result != tabulations_.end())
+        return search_result->second;
+    }
+    auto tabulation = std::make_shared<const TabulationType>(basis, quadrature);
+    std::unique_lock<std::shared_mutex> unique_lock(mutex_);
+    if (tabulations_.size() >= max_size_)
+      tabulations_.clear();
+    // another thread may have been faster, its tabulation is used then
+    return tabulations_.emplace(std::move(key), std::move(tabulation)).first->second;
+  } // ... get(...)
+
+  /// \brief The number of cached tabulations.
+  size_t size() const
+  {
+    std::shared_lock<std::shared_mutex> shared_lock(mutex_);
+    return tabulations_.size();
+  }
+
+private:
+  struct KeyType
+  {
+    KeyType(const BasisType& basis, const QuadratureType& quadrature)
+      : geometry_type(basis.geometry_type())
+      , order(basis.order())
+      , basis_size(basis.size())
+    {
+      coordinates.reserve(quadrature.size() * d);
+      for (const auto& quadrature_point : quadrature)
+        for (size_t ii = 0; ii < d; ++ii)
+          coordinates.push_back(quadrature_point.position()[ii]);
+    }
+
+    bool operator<(const KeyType& other) const
+    {
+      return std::tie(geometry_type, order, basis_size, coordinates)
+             < std::tie(other.geometry_type, other.order, other.basis_size, other.coordinates);
+    }
+
+    GeometryType geometry_type;
+    int order;
+    size_t basis_size;
+    std::vector<D> coordinates;
+  }; // struct KeyType
+
+  const size_t max_size_;
+  mutable std::shared_mutex mutex_;
+  mutable std::map<KeyType, std::shared_ptr<const TabulationType>> tabulations_;
+}; // class LocalFiniteElementBasisTabulationCache
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_LOCAL_FINITE_ELEMENTS_TABULATION_HH
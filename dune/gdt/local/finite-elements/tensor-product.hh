@@ -0,0 +1,505 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/**
+ * \file  tensor-product.hh
+ * \brief Tensor-product factorization of local Lagrange bases on cubes and the corresponding sum-factorization kernels.
+ **/
+#ifndef DUNE_GDT_LOCAL_FINITE_ELEMENTS_TENSOR_PRODUCT_HH
+#define DUNE_GDT_LOCAL_FINITE_ELEMENTS_TENSOR_PRODUCT_HH
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/type.hh>
+
+#include <dune/gdt/exceptions.hh>
+
+#include "interfaces.hh"
+
+namespace Dune {
+namespace GDT {
+
+
+// forward, required in LocalTensorProductLagrangeBasis
+template <class D, size_t d, class R>
+class LocalSumFactorizationKernel;
+
+
+/**
+ * \brief Factorization of a local Lagrange basis of Q_k on the reference cube into one-dimensional Lagrange
+ *        polynomials.
+ *
+ * The ii-th scalar basis function is given by phi_ii(x) = \prod_{dd = 0}^{d - 1} l_{a_dd}(x_dd), where l_0, ..., l_k
+ * are the Lagrange polynomials w.r.t. the k + 1 equidistant nodes in [0, 1] and a = (a_0, ..., a_{d - 1}) is the
+ * multi-index of ii, encoded in lexicographic_index(ii) = \sum_dd a_dd (k + 1)^dd.
+ *
+ * For vector-valued (powered, see LocalPowerFiniteElement) bases, the basis function pp * size() + ii is the ii-th
+ * scalar basis function in the pp-th component.
+ *
+ * Use detect() to obtain the factorization of a local finite element, if it has one. The kernels (see kernel()) are
+ * created on demand and cached thread-safely, so a single instance may be shared between all threads.
+ */
+template <class D, size_t d, class R = double>
+class LocalTensorProductLagrangeBasis
+{
+  using ThisType = LocalTensorProductLagrangeBasis;
+
+public:
+  using DomainType = FieldVector<D, d>;
+  using KernelType = LocalSumFactorizationKernel<D, d, R>;
+
+  LocalTensorProductLagrangeBasis(const size_t ord, std::vector<size_t>&& lexicographic_indices)
+    : order_(ord)
+    , nodes_(ord + 1)
+    , lexicographic_indices_(std::move(lexicographic_indices))
+  {
+    for (size_t aa = 0; aa <= order_; ++aa)
+      nodes_[aa] = (order_ == 0) ? 0.5 : D(aa) / D(order_);
+    DUNE_THROW_IF(lexicographic_indices_.size() != size(),
+                  Exceptions::finite_element_error,
+                  "lexicographic_indices.size() = " << lexicographic_indices_.size() << "\n   size() = " << size());
+  }
+
+  LocalTensorProductLagrangeBasis(const ThisType&) = delete;
+  LocalTensorProductLagrangeBasis(ThisType&&) = delete;
+
+  /**
+   * \brief Returns the factorization of the given basis of a local finite element, or nullptr if it does not have one.
+   *
+   * The multi-indices are recovered from the Lagrange points, which have to lie on the equidistant tensor grid. The
+   * factorization is then verified by comparing the basis with the products of the one-dimensional polynomials at some
+   * points in the interior of the reference element.
+   */
+  template <size_t r>
+  static std::shared_ptr<const ThisType> detect(const GeometryType& geometry_type,
+                                                const LocalFiniteElementBasisInterface<D, d, R, r, 1>& basis,
+                                                const std::vector<DomainType>& lagrange_points)
+  {
+    if (d == 0 || !geometry_type.isCube() || lagrange_points.empty() || basis.size() != r * lagrange_points.size())
+      return nullptr;
+    const size_t sz = lagrange_points.size();
+    const auto sz_1d = static_cast<size_t>(std::lround(std::pow(double(sz), 1. / double(std::max(d, size_t(1))))));
+    size_t expected_sz = 1;
+    for (size_t dd = 0; dd < d; ++dd)
+      expected_sz *= sz_1d;
+    if (sz_1d == 0 || expected_sz != sz)
+      return nullptr;
+    const size_t ord = sz_1d - 1;
+    // recover the multi-indices from the Lagrange points
+    std::vector<size_t> lexicographic_indices(sz);
+    std::vector<bool> taken(sz, false);
+    for (size_t ii = 0; ii < sz; ++ii) {
+      size_t index = 0;
+      size_t stride = 1;
+      for (size_t dd = 0; dd < d; ++dd) {
+        const D coordinate = (ord == 0) ? lagrange_points[ii][dd] - 0.5 : lagrange_points[ii][dd] * D(ord);
+        const auto aa = std::lround(coordinate);
+        if (std::abs(coordinate - D(aa)) > 1e-8 || aa < 0 || aa > static_cast<long>(ord))
+          return nullptr;
+        index += static_cast<size_t>(aa) * stride;
+        stride *= sz_1d;
+      }
+      if (taken[index])
+        return nullptr;
+      taken[index] = true;
+      lexicographic_indices[ii] = index;
+    }
+    auto factorization = std::make_shared<const ThisType>(ord, std::move(lexicographic_indices));
+    // verify the factorization
+    std::vector<typename LocalFiniteElementBasisInterface<D, d, R, r, 1>::RangeType> values;
+    for (const auto& offset : {0.13, 0.58, 0.87}) {
+      DomainType point;
+      for (size_t dd = 0; dd < d; ++dd)
+        point[dd] = std::fmod(offset + 0.29 * D(dd), 1.);
+      basis.evaluate(point, values);
+      for (size_t ii = 0; ii < sz; ++ii) {
+        const R expected = factorization->evaluate(ii, point);
+        for (size_t pp = 0; pp < r; ++pp)
+          for (size_t rr = 0; rr < r; ++rr) {
+            const R expected_value = (rr == pp) ? expected : R(0);
+            if (std::abs(values[pp * sz + ii][rr] - expected_value) > 1e-10 * std::max(R(1), std::abs(expected_value)))
+              return nullptr;
+          }
+      }
+    }
+    return factorization;
+  } // ... detect(...)
+
+  /// \brief The polynomial degree k in each direction.
+  size_t order() const
+  {
+    return order_;
+  }
+
+  /// \brief The number of one-dimensional Lagrange polynomials, k + 1.
+  size_t size_1d() const
+  {
+    return order_ + 1;
+  }
+
+  /// \brief The number of scalar basis functions, (k + 1)^d.
+  size_t size() const
+  {
+    size_t ret = 1;
+    for (size_t dd = 0; dd < d; ++dd)
+      ret *= size_1d();
+    return ret;
+  }
+
+  size_t lexicographic_index(const size_t ii) const
+  {
+    assert(ii < lexicographic_indices_.size());
+    return lexicographic_indices_[ii];
+  }
+
+  /// \brief Value of the aa-th one-dimensional Lagrange polynomial at x.
+  R evaluate_1d(const size_t aa, const D& x) const
+  {
+    R ret = 1;
+    for (size_t bb = 0; bb <= order_; ++bb)
+      if (bb != aa)
+        ret *= (x - nodes_[bb]) / (nodes_[aa] - nodes_[bb]);
+    return ret;
+  }
+
+  /// \brief Derivative of the aa-th one-dimensional Lagrange polynomial at x.
+  R derivative_1d(const size_t aa, const D& x) const
+  {
+    R ret = 0;
+    for (size_t cc = 0; cc <= order_; ++cc) {
+      if (cc == aa)
+        continue;
+      R summand = 1. / (nodes_[aa] - nodes_[cc]);
+      for (size_t bb = 0; bb <= order_; ++bb)
+        if (bb != aa && bb != cc)
+          summand *= (x - nodes_[bb]) / (nodes_[aa] - nodes_[bb]);
+      ret += summand;
+    }
+    return ret;
+  } // ... derivative_1d(...)
+
+  /// \brief Value of the ii-th scalar basis function at point_in_reference_element.
+  R evaluate(const size_t ii, const DomainType& point_in_reference_element) const
+  {
+    size_t index = lexicographic_index(ii);
+    R ret = 1;
+    for (size_t dd = 0; dd < d; ++dd) {
+      ret *= evaluate_1d(index % size_1d(), point_in_reference_element[dd]);
+      index /= size_1d();
+    }
+    return ret;
+  }
+
+  /**
+   * \brief The kernel for the tensor-product Gauss-Legendre rule with num_points_1d points in each direction.
+   *
+   * \note The kernel lives as long as this factorization.
+   */
+  const KernelType& kernel(const size_t num_points_1d) const
+  {
+    {
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> read_guard(mutex_);
+      const auto search_result = kernels_.find(num_points_1d);
+      if (search_result != kernels_.end())
+        return *search_result->second;
+    }
+    [[maybe_unused]] std::unique_lock<std::shared_mutex> write_guard(mutex_);
+    auto& kern = kernels_[num_points_1d];
+    if (!kern)
+      kern = std::make_unique<const KernelType>(*this, num_points_1d);
+    return *kern;
+  } // ... kernel(...)
+
+  /**
+   * \brief The kernel for the points of QuadratureRules<D, d>::rule(GeometryTypes::cube(d), integrand_order).
+   *
+   * \note The points are ordered lexicographically (see LocalSumFactorizationKernel), which may differ from the
+   *       ordering of the points in the quadrature rule from dune-geometry.
+   */
+  const KernelType& kernel_for_order(const int integrand_order) const
+  {
+    // a Gauss-Legendre rule with n points integrates polynomials of order 2n - 1 exactly
+    return kernel(static_cast<size_t>(std::max(integrand_order, 0)) / 2 + 1);
+  }
+
+private:
+  const size_t order_;
+  std::vector<D> nodes_;
+  const std::vector<size_t> lexicographic_indices_;
+  mutable std::map<size_t, std::unique_ptr<const KernelType>> kernels_;
+  mutable std::shared_mutex mutex_;
+}; // class LocalTensorProductLagrangeBasis
+
+
+/**
+ * \brief Sum-factorized evaluation and integration of a LocalTensorProductLagrangeBasis at the points of a
+ *        tensor-product Gauss-Legendre rule.
+ *
+ * With n = k + 1 basis functions and m quadrature points per direction, evaluating a local function at all m^d points
+ * (or integrating against all n^d basis functions) is carried out as d successive one-dimensional contractions, which
+ * costs O(d n m^d) instead of O(n^d m^d).
+ *
+ * The quadrature points are ordered lexicographically, i.e. the point with the one-dimensional indices
+ * (q_0, ..., q_{d - 1}) has the index \sum_dd q_dd m^dd. All methods work on local DoF vectors w.r.t. the ordering of
+ * the local finite element, the DoFs of the scalar basis are expected at dofs[offset], ..., dofs[offset + n^d - 1] (see
+ * LocalTensorProductLagrangeBasis for powered bases).
+ *
+ * The kernel is immutable, all temporaries live in a Workspace provided by the caller. Thus, a single instance may be
+ * shared between all threads.
+ */
+template <class D, size_t d, class R = double>
+class LocalSumFactorizationKernel
+{
+public:
+  using DomainType = FieldVector<D, d>;
+  using GradientType = FieldVector<R, d>;
+  using BasisType = LocalTensorProductLagrangeBasis<D, d, R>;
+
+  /// \brief Temporaries of a kernel, one per thread.
+  struct Workspace
+  {
+    std::vector<R> first;
+    std::vector<R> second;
+    std::vector<R> accumulated;
+  };
+
+  LocalSumFactorizationKernel(const BasisType& basis, const size_t num_points_1d)
+    : basis_(basis)
+    , n_(basis.size_1d())
+    , m_(num_points_1d)
+    , values_1d_(m_ * n_)
+    , derivatives_1d_(m_ * n_)
+  {
+    DUNE_THROW_IF(m_ == 0, Exceptions::finite_element_error, "num_points_1d has to be positive!");
+    const auto& rule_1d = QuadratureRules<D, 1>::rule(GeometryTypes::line, static_cast<int>(2 * m_ - 1));
+    DUNE_THROW_IF(rule_1d.size() != m_,
+                  Exceptions::finite_element_error,
+                  "rule_1d.size() = " << rule_1d.size() << "\n   num_points_1d = " << m_);
+    std::vector<D> points_1d(m_);
+    std::vector<D> weights_1d(m_);
+    for (size_t qq = 0; qq < m_; ++qq) {
+      points_1d[qq] = rule_1d[qq].position()[0];
+      weights_1d[qq] = rule_1d[qq].weight();
+      for (size_t aa = 0; aa < n_; ++aa) {
+        values_1d_[qq * n_ + aa] = basis_.evaluate_1d(aa, points_1d[qq]);
+        derivatives_1d_[qq * n_ + aa] = basis_.derivative_1d(aa, points_1d[qq]);
+      }
+    }
+    // the tensor-product rule
+    points_.resize(power(m_));
+    weights_.resize(power(m_));
+    for (size_t qq = 0; qq < points_.size(); ++qq) {
+      size_t index = qq;
+      weights_[qq] = 1.;
+      for (size_t dd = 0; dd < d; ++dd) {
+        points_[qq][dd] = points_1d[index % m_];
+        weights_[qq] *= weights_1d[index % m_];
+        index /= m_;
+      }
+    }
+  } // LocalSumFactorizationKernel(...)
+
+  LocalSumFactorizationKernel(const LocalSumFactorizationKernel&) = delete;
+  LocalSumFactorizationKernel(LocalSumFactorizationKernel&&) = delete;
+
+  size_t num_points_1d() const
+  {
+    return m_;
+  }
+
+  size_t num_points() const
+  {
+    return points_.size();
+  }
+
+  /// \brief The quadrature points in the reference element.
+  const std::vector<DomainType>& points() const
+  {
+    return points_;
+  }
+
+  /// \brief The quadrature weights (w.r.t. the reference element).
+  const std::vector<D>& weights() const
+  {
+    return weights_;
+  }
+
+  /// \brief values[qq] = \sum_ii dofs[offset + ii] phi_ii(points()[qq])
+  template <class DofVectorType>
+  void evaluate(const DofVectorType& dofs, std::vector<R>& values, Workspace& workspace, const size_t offset = 0) const
+  {
+    gather(dofs, offset, workspace.first);
+    const R* result = interpolate(workspace, /*derivative_direction=*/d);
+    values.resize(num_points());
+    std::copy(result, result + num_points(), values.begin());
+  }
+
+  /// \brief gradients[qq] = \sum_ii dofs[offset + ii] \nabla phi_ii(points()[qq]), the gradient w.r.t. the reference
+  ///        element
+  template <class DofVectorType>
+  void evaluate_reference_gradients(const DofVectorType& dofs,
+                                    std::vector<GradientType>& gradients,
+                                    Workspace& workspace,
+                                    const size_t offset = 0) const
+  {
+    gradients.resize(num_points());
+    gather(dofs, offset, workspace.accumulated);
+    for (size_t kk = 0; kk < d; ++kk) {
+      workspace.first = workspace.accumulated;
+      const R* result = interpolate(workspace, kk);
+      for (size_t qq = 0; qq < num_points(); ++qq)
+        gradients[qq][kk] = result[qq];
+    }
+  } // ... evaluate_reference_gradients(...)
+
+  /// \brief dofs[offset + ii] += \sum_qq values[qq] phi_ii(points()[qq])
+  template <class DofVectorType>
+  void integrate(const std::vector<R>& values, DofVectorType& dofs, Workspace& workspace, const size_t offset = 0) const
+  {
+    assert(values.size() >= num_points());
+    workspace.first.resize(std::max(num_points(), basis_.size()));
+    std::copy(values.begin(), values.begin() + num_points(), workspace.first.begin());
+    const R* result = restrict(workspace, /*derivative_direction=*/d);
+    scatter(result, offset, dofs);
+  }
+
+  /// \brief dofs[offset + ii] += \sum_qq gradients[qq] * \nabla phi_ii(points()[qq]), the gradient w.r.t. the
+  ///        reference element
+  template <class DofVectorType>
+  void integrate_reference_gradients(const std::vector<GradientType>& gradients,
+                                     DofVectorType& dofs,
+                                     Workspace& workspace,
+                                     const size_t offset = 0) const
+  {
+    assert(gradients.size() >= num_points());
+    workspace.accumulated.assign(basis_.size(), 0.);
+    for (size_t kk = 0; kk < d; ++kk) {
+      workspace.first.resize(std::max(num_points(), basis_.size()));
+      for (size_t qq = 0; qq < num_points(); ++qq)
+        workspace.first[qq] = gradients[qq][kk];
+      const R* result = restrict(workspace, kk);
+      for (size_t ii = 0; ii < basis_.size(); ++ii)
+        workspace.accumulated[ii] += result[ii];
+    }
+    scatter(workspace.accumulated.data(), offset, dofs);
+  } // ... integrate_reference_gradients(...)
+
+private:
+  size_t power(const size_t base) const
+  {
+    size_t ret = 1;
+    for (size_t dd = 0; dd < d; ++dd)
+      ret *= base;
+    return ret;
+  }
+
+  template <class DofVectorType>
+  void gather(const DofVectorType& dofs, const size_t offset, std::vector<R>& tensor) const
+  {
+    tensor.resize(std::max(num_points(), basis_.size()));
+    for (size_t ii = 0; ii < basis_.size(); ++ii)
+      tensor[basis_.lexicographic_index(ii)] = dofs[offset + ii];
+  }
+
+  template <class DofVectorType>
+  void scatter(const R* tensor, const size_t offset, DofVectorType& dofs) const
+  {
+    for (size_t ii = 0; ii < basis_.size(); ++ii)
+      dofs[offset + ii] += tensor[basis_.lexicographic_index(ii)];
+  }
+
+  // Applies the one-dimensional matrix (of size m_ x n_, or its transposed) along the given direction of the tensor in,
+  // where inner is the product of the sizes of the directions < direction (which vary fastest) and outer of those >
+  // direction.
+  void contract(const std::vector<R>& matrix,
+                const bool transposed,
+                const size_t inner,
+                const size_t outer,
+                const R* in,
+                R* out) const
+  {
+    const size_t rows = transposed ? n_ : m_;
+    const size_t cols = transposed ? m_ : n_;
+    for (size_t oo = 0; oo < outer; ++oo)
+      for (size_t ii = 0; ii < rows; ++ii) {
+        R* out_row = out + (oo * rows + ii) * inner;
+        std::fill(out_row, out_row + inner, R(0));
+        for (size_t jj = 0; jj < cols; ++jj) {
+          const R factor = transposed ? matrix[jj * n_ + ii] : matrix[ii * n_ + jj];
+          const R* in_row = in + (oo * cols + jj) * inner;
+          for (size_t kk = 0; kk < inner; ++kk)
+            out_row[kk] += factor * in_row[kk];
+        }
+      }
+  } // ... contract(...)
+
+  // Maps the coefficients in workspace.first (lexicographic, n_^d) to the values at the quadrature points, using the
+  // derivatives in the given direction (none if derivative_direction == d). Returns a pointer into the workspace.
+  const R* interpolate(Workspace& workspace, const size_t derivative_direction) const
+  {
+    const size_t sz = std::max(num_points(), basis_.size());
+    workspace.first.resize(sz);
+    workspace.second.resize(sz);
+    R* in = workspace.first.data();
+    R* out = workspace.second.data();
+    size_t inner = 1;
+    size_t outer = basis_.size() / n_;
+    for (size_t dd = 0; dd < d; ++dd) {
+      const auto& matrix = (dd == derivative_direction) ? derivatives_1d_ : values_1d_;
+      contract(matrix, /*transposed=*/false, inner, outer, in, out);
+      std::swap(in, out);
+      inner *= m_;
+      outer /= n_;
+    }
+    return in;
+  } // ... interpolate(...)
+
+  // Maps the values at the quadrature points in workspace.first (lexicographic, m_^d) to the integrals against the
+  // basis functions (lexicographic), see interpolate().
+  const R* restrict(Workspace& workspace, const size_t derivative_direction) const
+  {
+    const size_t sz = std::max(num_points(), basis_.size());
+    workspace.first.resize(sz);
+    workspace.second.resize(sz);
+    R* in = workspace.first.data();
+    R* out = workspace.second.data();
+    size_t inner = 1;
+    size_t outer = num_points() / m_;
+    for (size_t dd = 0; dd < d; ++dd) {
+      const auto& matrix = (dd == derivative_direction) ? derivatives_1d_ : values_1d_;
+      contract(matrix, /*transposed=*/true, inner, outer, in, out);
+      std::swap(in, out);
+      inner *= n_;
+      outer /= m_;
+    }
+    return in;
+  } // ... restrict(...)
+
+  const BasisType& basis_;
+  const size_t n_;
+  const size_t m_;
+  std::vector<R> values_1d_;
+  std::vector<R> derivatives_1d_;
+  std::vector<DomainType> points_;
+  std::vector<D> weights_;
+}; // class LocalSumFactorizationKernel
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_LOCAL_FINITE_ELEMENTS_TENSOR_PRODUCT_HH
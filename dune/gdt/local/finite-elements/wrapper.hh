@@ -20,6 +20,7 @@
 
 #include <dune/xt/common/memory.hh>
 #include <dune/xt/common/numeric_cast.hh>
+#include <dune/xt/common/parallel/threadstorage.hh>
 #include <dune/xt/common/type_traits.hh>
 
 #include "default.hh"
@@ -242,18 +243,20 @@ public:
                    DynamicVector<R>& dofs) const override final
   {
     //! TODO this manually instantied a FunctionWrapper, which is not (no longer?) necessary
-    imp_->localInterpolation().interpolate(local_function, dofs_);
+    // this wrapper is shared between threads, so each thread requires its own scratch vector
+    auto& local_dofs = *dofs_;
+    imp_->localInterpolation().interpolate(local_function, local_dofs);
     const size_t sz = this->size();
     if (dofs.size() != sz)
       dofs.resize(sz);
     for (size_t ii = 0; ii < sz; ++ii)
-      dofs[ii] = dofs_[ii];
+      dofs[ii] = local_dofs[ii];
   }
 
 private:
   const std::shared_ptr<const Implementation> imp_;
   const GeometryType geometry_type_;
-  mutable std::vector<R> dofs_;
+  mutable XT::Common::PerThreadValue<std::vector<R>> dofs_;
 }; // class LocalFiniteElementInterpolationWrapper
 
 
@@ -0,0 +1,158 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/**
+ * \file  batched.hh
+ * \brief Contiguous buffers and kernels for integrands which are evaluated at all quadrature points at once.
+ **/
+#ifndef DUNE_GDT_LOCAL_INTEGRANDS_BATCHED_HH
+#define DUNE_GDT_LOCAL_INTEGRANDS_BATCHED_HH
+
+#include <cassert>
+#include <vector>
+
+#include <dune/common/dynmatrix.hh>
+
+namespace Dune {
+namespace GDT {
+namespace internal {
+
+
+/**
+ * \brief Values of a set of functions at all points of a quadrature rule, stored contiguously per function.
+ *
+ * Each function is described by length() values (e.g., all components of its gradient at all points). This is the
+ * layout of the test side of add_batched_products().
+ */
+template <class F>
+class FunctionMajorQuadratureBuffer
+{
+public:
+  void resize(const size_t num_functions, const size_t length)
+  {
+    num_functions_ = num_functions;
+    length_ = length;
+    if (data_.size() < num_functions_ * length_)
+      data_.resize(num_functions_ * length_);
+  }
+
+  size_t size() const
+  {
+    return num_functions_;
+  }
+
+  size_t length() const
+  {
+    return length_;
+  }
+
+  F& operator()(const size_t ii, const size_t kk)
+  {
+    assert(ii < num_functions_ && kk < length_);
+    return data_[ii * length_ + kk];
+  }
+
+  const F* function(const size_t ii) const
+  {
+    assert(ii < num_functions_);
+    return data_.data() + ii * length_;
+  }
+
+private:
+  size_t num_functions_ = 0;
+  size_t length_ = 0;
+  std::vector<F> data_;
+}; // class FunctionMajorQuadratureBuffer
+
+
+/**
+ * \brief Values of a set of functions at all points of a quadrature rule, stored contiguously per point.
+ *
+ * Same indexing as FunctionMajorQuadratureBuffer, but the values of all functions belonging to the same kk are
+ * adjacent. This is the layout of the ansatz side of add_batched_products().
+ */
+template <class F>
+class PointMajorQuadratureBuffer
+{
+public:
+  void resize(const size_t num_functions, const size_t length)
+  {
+    num_functions_ = num_functions;
+    length_ = length;
+    if (data_.size() < num_functions_ * length_)
+      data_.resize(num_functions_ * length_);
+  }
+
+  size_t size() const
+  {
+    return num_functions_;
+  }
+
+  size_t length() const
+  {
+    return length_;
+  }
+
+  F& operator()(const size_t jj, const size_t kk)
+  {
+    assert(jj < num_functions_ && kk < length_);
+    return data_[kk * num_functions_ + jj];
+  }
+
+  const F* point(const size_t kk) const
+  {
+    assert(kk < length_);
+    return data_.data() + kk * num_functions_;
+  }
+
+private:
+  size_t num_functions_ = 0;
+  size_t length_ = 0;
+  std::vector<F> data_;
+}; // class PointMajorQuadratureBuffer
+
+
+/**
+ * \brief Computes result[ii][jj] += scaling * \sum_kk test(ii, kk) * ansatz(jj, kk) for all test functions ii and
+ *        ansatz functions jj.
+ *
+ * The innermost loop runs over the ansatz functions with unit stride and independent sums, so it can be vectorized
+ * without reassociating floating point operations.
+ *
+ * \note result has to be large enough, it is not resized.
+ */
+template <class F>
+void add_batched_products(const FunctionMajorQuadratureBuffer<F>& test,
+                          const PointMajorQuadratureBuffer<F>& ansatz,
+                          DynamicMatrix<F>& result,
+                          const F& scaling = F(1))
+{
+  assert(test.length() == ansatz.length());
+  assert(result.rows() >= test.size() && result.cols() >= ansatz.size());
+  const size_t rows = test.size();
+  const size_t cols = ansatz.size();
+  const size_t length = test.length();
+  if (rows == 0 || cols == 0)
+    return;
+  for (size_t ii = 0; ii < rows; ++ii) {
+    F* result_row = &(result[ii][0]);
+    const F* test_values = test.function(ii);
+    for (size_t kk = 0; kk < length; ++kk) {
+      const F test_value = scaling * test_values[kk];
+      const F* ansatz_values = ansatz.point(kk);
+      for (size_t jj = 0; jj < cols; ++jj)
+        result_row[jj] += test_value * ansatz_values[jj];
+    }
+  }
+} // ... add_batched_products(...)
+
+
+} // namespace internal
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_LOCAL_INTEGRANDS_BATCHED_HH
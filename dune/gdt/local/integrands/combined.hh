@@ -249,6 +249,78 @@ public:
         result[ii][jj] += right_result_[ii][jj];
   } // ... evaluate(...)
 
+  void evaluate_at_quadrature_point(const LocalTestBasisType& test_basis,
+                                    const LocalAnsatzBasisType& ansatz_basis,
+                                    const QuadratureRule<typename BaseType::D, BaseType::d>& quadrature,
+                                    const size_t point_index,
+                                    DynamicMatrix<F>& result,
+                                    const XT::Common::Parameter& param = {}) const final
+  {
+    // see evaluate()
+    left_.access().evaluate_at_quadrature_point(test_basis, ansatz_basis, quadrature, point_index, result, param);
+    right_.access().evaluate_at_quadrature_point(
+        test_basis, ansatz_basis, quadrature, point_index, right_result_, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    for (size_t ii = 0; ii < rows; ++ii)
+      for (size_t jj = 0; jj < cols; ++jj)
+        result[ii][jj] += right_result_[ii][jj];
+  } // ... evaluate_at_quadrature_point(...)
+
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseType::D, BaseType::d>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    // see evaluate()
+    left_.access().evaluate_all(test_basis, ansatz_basis, quadrature, weights, result, param);
+    right_.access().evaluate_all(test_basis, ansatz_basis, quadrature, weights, right_result_, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    for (size_t ii = 0; ii < rows; ++ii)
+      for (size_t jj = 0; jj < cols; ++jj)
+        result[ii][jj] += right_result_[ii][jj];
+  } // ... evaluate_all(...)
+
+  /// Only available if available for both integrands.
+  typename BaseType::PointwiseApplication pointwise_application() const final
+  {
+    const auto left = left_.access().pointwise_application();
+    const auto right = right_.access().pointwise_application();
+    if (!left.available() || !right.available())
+      return typename BaseType::PointwiseApplication();
+    typename BaseType::PointwiseApplication ret;
+    ret.ansatz_values = left.ansatz_values || right.ansatz_values;
+    ret.ansatz_jacobians = left.ansatz_jacobians || right.ansatz_jacobians;
+    ret.test_values = left.test_values || right.test_values;
+    ret.test_jacobians = left.test_jacobians || right.test_jacobians;
+    return ret;
+  } // ... pointwise_application(...)
+
+  void apply_pointwise(const DomainType& point_in_reference_element,
+                       const typename LocalAnsatzBasisType::RangeType& ansatz_value,
+                       const typename LocalAnsatzBasisType::DerivativeRangeType& ansatz_jacobian,
+                       typename LocalTestBasisType::RangeType& test_value_coefficient,
+                       typename LocalTestBasisType::DerivativeRangeType& test_jacobian_coefficient,
+                       const XT::Common::Parameter& param = {}) const final
+  {
+    // both add to the coefficients
+    left_.access().apply_pointwise(point_in_reference_element,
+                                   ansatz_value,
+                                   ansatz_jacobian,
+                                   test_value_coefficient,
+                                   test_jacobian_coefficient,
+                                   param);
+    right_.access().apply_pointwise(point_in_reference_element,
+                                    ansatz_value,
+                                    ansatz_jacobian,
+                                    test_value_coefficient,
+                                    test_jacobian_coefficient,
+                                    param);
+  }
+
 private:
   XT::Common::StorageProvider<BaseType> left_;
   XT::Common::StorageProvider<BaseType> right_;
@@ -340,6 +412,23 @@ public:
         result[ii][jj] += right_result_[ii][jj];
   } // ... evaluate(...)
 
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseType::D, BaseType::d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    // see evaluate()
+    left_.access().evaluate_all(test_basis, ansatz_basis, quadrature, weights, result, param);
+    right_.access().evaluate_all(test_basis, ansatz_basis, quadrature, weights, right_result_, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    for (size_t ii = 0; ii < rows; ++ii)
+      for (size_t jj = 0; jj < cols; ++jj)
+        result[ii][jj] += right_result_[ii][jj];
+  } // ... evaluate_all(...)
+
 private:
   XT::Common::StorageProvider<BaseType> left_;
   XT::Common::StorageProvider<BaseType> right_;
@@ -439,6 +528,74 @@ public:
                              result_out_out_,
                              param);
     // ... and simply add them up (cannot use += here, matrices might be larger).
+    add_right_results(test_basis_inside,
+                      ansatz_basis_inside,
+                      test_basis_outside,
+                      ansatz_basis_outside,
+                      result_in_in,
+                      result_in_out,
+                      result_out_in,
+                      result_out_out,
+                      param);
+  } // ... evaluate(...)
+
+  void evaluate_all(const LocalTestBasisType& test_basis_inside,
+                    const LocalAnsatzBasisType& ansatz_basis_inside,
+                    const LocalTestBasisType& test_basis_outside,
+                    const LocalAnsatzBasisType& ansatz_basis_outside,
+                    const QuadratureRule<typename BaseType::D, BaseType::d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result_in_in,
+                    DynamicMatrix<F>& result_in_out,
+                    DynamicMatrix<F>& result_out_in,
+                    DynamicMatrix<F>& result_out_out,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    // see evaluate()
+    left_.access().evaluate_all(test_basis_inside,
+                                ansatz_basis_inside,
+                                test_basis_outside,
+                                ansatz_basis_outside,
+                                quadrature,
+                                weights,
+                                result_in_in,
+                                result_in_out,
+                                result_out_in,
+                                result_out_out,
+                                param);
+    right_.access().evaluate_all(test_basis_inside,
+                                 ansatz_basis_inside,
+                                 test_basis_outside,
+                                 ansatz_basis_outside,
+                                 quadrature,
+                                 weights,
+                                 result_in_in_,
+                                 result_in_out_,
+                                 result_out_in_,
+                                 result_out_out_,
+                                 param);
+    add_right_results(test_basis_inside,
+                      ansatz_basis_inside,
+                      test_basis_outside,
+                      ansatz_basis_outside,
+                      result_in_in,
+                      result_in_out,
+                      result_out_in,
+                      result_out_out,
+                      param);
+  } // ... evaluate_all(...)
+
+private:
+  void add_right_results(const LocalTestBasisType& test_basis_inside,
+                         const LocalAnsatzBasisType& ansatz_basis_inside,
+                         const LocalTestBasisType& test_basis_outside,
+                         const LocalAnsatzBasisType& ansatz_basis_outside,
+                         DynamicMatrix<F>& result_in_in,
+                         DynamicMatrix<F>& result_in_out,
+                         DynamicMatrix<F>& result_out_in,
+                         DynamicMatrix<F>& result_out_out,
+                         const XT::Common::Parameter& param) const
+  {
     const size_t rows_in = test_basis_inside.size(param);
     const size_t rows_out = test_basis_outside.size(param);
     const size_t cols_in = ansatz_basis_inside.size(param);
@@ -455,9 +612,8 @@ public:
     for (size_t ii = 0; ii < rows_out; ++ii)
       for (size_t jj = 0; jj < cols_out; ++jj)
         result_out_out[ii][jj] += result_out_out_[ii][jj];
-  } // ... evaluate(...)
+  } // ... add_right_results(...)
 
-private:
   XT::Common::StorageProvider<BaseType> left_;
   XT::Common::StorageProvider<BaseType> right_;
   mutable DynamicMatrix<F> result_in_in_;
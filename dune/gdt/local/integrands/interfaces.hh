@@ -17,8 +17,15 @@
 #ifndef DUNE_GDT_LOCAL_INTEGRANDS_INTERFACES_HH
 #define DUNE_GDT_LOCAL_INTEGRANDS_INTERFACES_HH
 
+#include <array>
+#include <cassert>
+#include <vector>
+
+#include <dune/common/dynmatrix.hh>
 #include <dune/common/dynvector.hh>
 
+#include <dune/geometry/quadraturerules.hh>
+
 #include <dune/xt/common/parameter.hh>
 #include <dune/xt/common/timedlogging.hh>
 #include <dune/xt/grid/bound-object.hh>
@@ -209,6 +216,23 @@ public:
   using LocalTestBasisType = XT::Functions::ElementFunctionSetInterface<E, t_r, t_rC, TR>;
   using LocalAnsatzBasisType = XT::Functions::ElementFunctionSetInterface<E, a_r, a_rC, AR>;
 
+  /**
+   * \brief Describes which values and jacobians the pointwise application (see apply_pointwise()) depends on (on the
+   *        ansatz side) and yields (on the test side). All false if the pointwise application is not available.
+   */
+  struct PointwiseApplication
+  {
+    bool ansatz_values = false;
+    bool ansatz_jacobians = false;
+    bool test_values = false;
+    bool test_jacobians = false;
+
+    bool available() const
+    {
+      return (ansatz_values || ansatz_jacobians) && (test_values || test_jacobians);
+    }
+  }; // struct PointwiseApplication
+
   explicit LocalBinaryElementIntegrandInterface(
       const XT::Common::ParameterType& param_type = {},
       const std::string& logging_prefix = "",
@@ -277,6 +301,105 @@ public:
     return result;
   }
 
+  /**
+   * Computes the evaluation of this integrand at the point_index-th point of the given quadrature rule for each
+   * combination of functions from the two bases.
+   *
+   * Integrands may override this to make use of bases which tabulate their values at the points of a quadrature rule
+   * (see XT::Functions::ElementFunctionSetInterface::evaluate_at_quadrature_point). The default implementation simply
+   * evaluates at the position of the quadrature point.
+   *
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void evaluate_at_quadrature_point(const LocalTestBasisType& test_basis,
+                                            const LocalAnsatzBasisType& ansatz_basis,
+                                            const QuadratureRule<D, d>& quadrature,
+                                            const size_t point_index,
+                                            DynamicMatrix<F>& result,
+                                            const XT::Common::Parameter& param = {}) const
+  {
+    this->evaluate(test_basis, ansatz_basis, quadrature[point_index].position(), result, param);
+  }
+
+  /**
+   * Computes the weighted sum of the evaluations of this integrand at all points of the given quadrature rule for each
+   * combination of functions from the two bases, i.e.
+   * `result[ii][jj] = \sum_qq weights[qq] * evaluate(test_basis, ansatz_basis, quadrature[qq].position())[ii][jj]`,
+   * where weights usually contains the quadrature weights times the integration element.
+   *
+   * Integrands may override this to work on all quadrature points at once (e.g., using the buffers and kernels from
+   * batched.hh). The default implementation is evaluate_all_pointwise().
+   *
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void evaluate_all(const LocalTestBasisType& test_basis,
+                            const LocalAnsatzBasisType& ansatz_basis,
+                            const QuadratureRule<D, d>& quadrature,
+                            const std::vector<F>& weights,
+                            DynamicMatrix<F>& result,
+                            const XT::Common::Parameter& param = {}) const
+  {
+    this->evaluate_all_pointwise(test_basis, ansatz_basis, quadrature, weights, result, param);
+  }
+
+  /**
+   * Computes the same as evaluate_all(), but always by calling evaluate_at_quadrature_point() for each point.
+   **/
+  void evaluate_all_pointwise(const LocalTestBasisType& test_basis,
+                              const LocalAnsatzBasisType& ansatz_basis,
+                              const QuadratureRule<D, d>& quadrature,
+                              const std::vector<F>& weights,
+                              DynamicMatrix<F>& result,
+                              const XT::Common::Parameter& param = {}) const
+  {
+    assert(weights.size() >= quadrature.size());
+    this->ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      this->evaluate_at_quadrature_point(test_basis, ansatz_basis, quadrature, qq, pointwise_values_, param);
+      for (size_t ii = 0; ii < rows; ++ii)
+        for (size_t jj = 0; jj < cols; ++jj)
+          result[ii][jj] += pointwise_values_[ii][jj] * weights[qq];
+    }
+  } // ... evaluate_all_pointwise(...)
+
+  /**
+   * \name Pointwise application, e.g. for sum factorization.
+   *
+   * Integrands which are linear in the test function phi and its jacobian can be written as
+   * `evaluate(phi, psi)(x) = phi(x) : v(x) + J_phi(x) : G(x)`, where ":" denotes the sum over the products of all
+   * entries. If v and G only depend on the value psi(x) and the jacobian J_psi(x) of the ansatz function (and on x),
+   * the integrand may override pointwise_application() and apply_pointwise(). This allows local bilinear forms to apply
+   * the integrand to a single ansatz function without forming the local matrix (see LocalElementIntegralBilinearForm).
+   * \{
+   **/
+
+  virtual PointwiseApplication pointwise_application() const
+  {
+    return PointwiseApplication();
+  }
+
+  /**
+   * Adds v and G (see above) to test_value_coefficient and test_jacobian_coefficient, given the value and the
+   * jacobian (w.r.t. physical coordinates) of the ansatz function at point_in_reference_element. Only those of the
+   * arguments which are flagged in pointwise_application() are meaningful.
+   *
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void apply_pointwise(const DomainType& /*point_in_reference_element*/,
+                               const typename LocalAnsatzBasisType::RangeType& /*ansatz_value*/,
+                               const typename LocalAnsatzBasisType::DerivativeRangeType& /*ansatz_jacobian*/,
+                               typename LocalTestBasisType::RangeType& /*test_value_coefficient*/,
+                               typename LocalTestBasisType::DerivativeRangeType& /*test_jacobian_coefficient*/,
+                               const XT::Common::Parameter& /*param*/ = {}) const
+  {
+    DUNE_THROW(Exceptions::integrand_error,
+               "the pointwise application is not available for this integrand, check pointwise_application()!");
+  }
+
+  /// \}
+
 protected:
   void ensure_size_and_clear_results(const LocalTestBasisType& test_basis,
                                      const LocalAnsatzBasisType& ansatz_basis,
@@ -289,6 +412,9 @@ protected:
       result.resize(rows, cols);
     result *= 0;
   } // ... ensure_size_and_clear_results(...)
+
+private:
+  mutable DynamicMatrix<F> pointwise_values_;
 }; // class LocalBinaryElementIntegrandInterface
 
 
@@ -536,6 +662,45 @@ public:
     return result;
   }
 
+  /**
+   * Computes the weighted sum of the evaluations of this integrand at all points of the given quadrature rule for each
+   * combination of functions from the two bases.
+   *
+   * \sa LocalBinaryElementIntegrandInterface::evaluate_all
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void evaluate_all(const LocalTestBasisType& test_basis,
+                            const LocalAnsatzBasisType& ansatz_basis,
+                            const QuadratureRule<D, d - 1>& quadrature,
+                            const std::vector<F>& weights,
+                            DynamicMatrix<F>& result,
+                            const XT::Common::Parameter& param = {}) const
+  {
+    this->evaluate_all_pointwise(test_basis, ansatz_basis, quadrature, weights, result, param);
+  }
+
+  /**
+   * Computes the same as evaluate_all(), but always by calling evaluate() for each point.
+   **/
+  void evaluate_all_pointwise(const LocalTestBasisType& test_basis,
+                              const LocalAnsatzBasisType& ansatz_basis,
+                              const QuadratureRule<D, d - 1>& quadrature,
+                              const std::vector<F>& weights,
+                              DynamicMatrix<F>& result,
+                              const XT::Common::Parameter& param = {}) const
+  {
+    assert(weights.size() >= quadrature.size());
+    this->ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      this->evaluate(test_basis, ansatz_basis, quadrature[qq].position(), pointwise_values_, param);
+      for (size_t ii = 0; ii < rows; ++ii)
+        for (size_t jj = 0; jj < cols; ++jj)
+          result[ii][jj] += pointwise_values_[ii][jj] * weights[qq];
+    }
+  } // ... evaluate_all_pointwise(...)
+
 protected:
   void ensure_size_and_clear_results(const LocalTestBasisType& test_basis,
                                      const LocalAnsatzBasisType& ansatz_basis,
@@ -548,6 +713,9 @@ protected:
       result.resize(rows, cols);
     result *= 0;
   } // ... ensure_size_and_clear_results(...)
+
+private:
+  mutable DynamicMatrix<F> pointwise_values_;
 }; // class LocalBinaryIntersectionIntegrandInterface
 
 
@@ -688,6 +856,90 @@ public:
     return {{result_in_in, result_in_out, result_out_in, result_out_out}};
   } // ... apply(...)
 
+  /**
+   * Computes the weighted sum of the evaluations of this integrand at all points of the given quadrature rule for each
+   * combination of functions from the bases.
+   *
+   * \sa LocalBinaryElementIntegrandInterface::evaluate_all
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void evaluate_all(const LocalTestBasisType& test_basis_inside,
+                            const LocalAnsatzBasisType& ansatz_basis_inside,
+                            const LocalTestBasisType& test_basis_outside,
+                            const LocalAnsatzBasisType& ansatz_basis_outside,
+                            const QuadratureRule<D, d - 1>& quadrature,
+                            const std::vector<F>& weights,
+                            DynamicMatrix<F>& result_in_in,
+                            DynamicMatrix<F>& result_in_out,
+                            DynamicMatrix<F>& result_out_in,
+                            DynamicMatrix<F>& result_out_out,
+                            const XT::Common::Parameter& param = {}) const
+  {
+    this->evaluate_all_pointwise(test_basis_inside,
+                                 ansatz_basis_inside,
+                                 test_basis_outside,
+                                 ansatz_basis_outside,
+                                 quadrature,
+                                 weights,
+                                 result_in_in,
+                                 result_in_out,
+                                 result_out_in,
+                                 result_out_out,
+                                 param);
+  } // ... evaluate_all(...)
+
+  /**
+   * Computes the same as evaluate_all(), but always by calling evaluate() for each point.
+   **/
+  void evaluate_all_pointwise(const LocalTestBasisType& test_basis_inside,
+                              const LocalAnsatzBasisType& ansatz_basis_inside,
+                              const LocalTestBasisType& test_basis_outside,
+                              const LocalAnsatzBasisType& ansatz_basis_outside,
+                              const QuadratureRule<D, d - 1>& quadrature,
+                              const std::vector<F>& weights,
+                              DynamicMatrix<F>& result_in_in,
+                              DynamicMatrix<F>& result_in_out,
+                              DynamicMatrix<F>& result_out_in,
+                              DynamicMatrix<F>& result_out_out,
+                              const XT::Common::Parameter& param = {}) const
+  {
+    assert(weights.size() >= quadrature.size());
+    this->ensure_size_and_clear_results(test_basis_inside,
+                                        ansatz_basis_inside,
+                                        test_basis_outside,
+                                        ansatz_basis_outside,
+                                        result_in_in,
+                                        result_in_out,
+                                        result_out_in,
+                                        result_out_out,
+                                        param);
+    const size_t rows_in = test_basis_inside.size(param);
+    const size_t rows_out = test_basis_outside.size(param);
+    const size_t cols_in = ansatz_basis_inside.size(param);
+    const size_t cols_out = ansatz_basis_outside.size(param);
+    const auto add_weighted = [](const auto& values, const auto& weight, const auto& rows, const auto& cols, auto& res) {
+      for (size_t ii = 0; ii < rows; ++ii)
+        for (size_t jj = 0; jj < cols; ++jj)
+          res[ii][jj] += values[ii][jj] * weight;
+    };
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      this->evaluate(test_basis_inside,
+                     ansatz_basis_inside,
+                     test_basis_outside,
+                     ansatz_basis_outside,
+                     quadrature[qq].position(),
+                     pointwise_values_[0],
+                     pointwise_values_[1],
+                     pointwise_values_[2],
+                     pointwise_values_[3],
+                     param);
+      add_weighted(pointwise_values_[0], weights[qq], rows_in, cols_in, result_in_in);
+      add_weighted(pointwise_values_[1], weights[qq], rows_in, cols_out, result_in_out);
+      add_weighted(pointwise_values_[2], weights[qq], rows_out, cols_in, result_out_in);
+      add_weighted(pointwise_values_[3], weights[qq], rows_out, cols_out, result_out_out);
+    }
+  } // ... evaluate_all_pointwise(...)
+
 protected:
   void ensure_size_and_clear_results(const LocalTestBasisType& test_basis_inside,
                                      const LocalAnsatzBasisType& ansatz_basis_inside,
@@ -713,6 +965,9 @@ protected:
     ensure_size_and_clear(result_out_in, rows_out, cols_in);
     ensure_size_and_clear(result_out_out, rows_out, cols_out);
   } // ... ensure_size_and_clear_results(...)
+
+private:
+  mutable std::array<DynamicMatrix<F>, 4> pointwise_values_;
 }; // class LocalQuaternaryIntersectionIntegrandInterface
 
 
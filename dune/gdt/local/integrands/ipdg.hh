@@ -20,6 +20,7 @@
 #include <dune/xt/grid/entity.hh>
 #include <dune/xt/grid/intersection.hh>
 
+#include "batched.hh"
 #include "interfaces.hh"
 
 namespace Dune {
@@ -152,15 +153,10 @@ public:
     test_basis_outside.evaluate(point_in_outside_reference_element, test_basis_out_values_, param);
     ansatz_basis_inside.evaluate(point_in_inside_reference_element, ansatz_basis_in_values_, param);
     ansatz_basis_outside.evaluate(point_in_outside_reference_element, ansatz_basis_out_values_, param);
-    // ... and data functions, ...
-    const auto weight_in = local_weight_in_->evaluate(point_in_inside_reference_element, param);
-    const auto weight_out = local_weight_out_->evaluate(point_in_outside_reference_element, param);
-    // compute the weighted penalty ...
-    const double delta_plus = normal * (weight_out * normal);
-    const double delta_minus = normal * (weight_in * normal);
-    const auto weight = (delta_plus * delta_minus) / (delta_plus + delta_minus); // half harmonic average
+    // ... and the weighted penalty, ...
     const auto h = intersection_diameter_(this->intersection());
-    const auto penalty = (penalty_ * weight) / h;
+    const auto penalty =
+        weighted_penalty(point_in_inside_reference_element, point_in_outside_reference_element, normal, h, param);
     // and finally compute the integrand.
     const size_t rows_in = test_basis_inside.size(param);
     const size_t rows_out = test_basis_outside.size(param);
@@ -180,7 +176,83 @@ public:
     }
   } // ... evaluate(...)
 
+  void evaluate_all(const LocalTestBasisType& test_basis_inside,
+                    const LocalAnsatzBasisType& ansatz_basis_inside,
+                    const LocalTestBasisType& test_basis_outside,
+                    const LocalAnsatzBasisType& ansatz_basis_outside,
+                    const QuadratureRule<typename BaseType::D, d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result_in_in,
+                    DynamicMatrix<F>& result_in_out,
+                    DynamicMatrix<F>& result_out_in,
+                    DynamicMatrix<F>& result_out_out,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    this->ensure_size_and_clear_results(test_basis_inside,
+                                        ansatz_basis_inside,
+                                        test_basis_outside,
+                                        ansatz_basis_outside,
+                                        result_in_in,
+                                        result_in_out,
+                                        result_out_in,
+                                        result_out_out,
+                                        param);
+    const size_t rows_in = test_basis_inside.size(param);
+    const size_t rows_out = test_basis_outside.size(param);
+    const size_t cols_in = ansatz_basis_inside.size(param);
+    const size_t cols_out = ansatz_basis_outside.size(param);
+    test_in_buffer_.resize(rows_in, quadrature.size());
+    test_out_buffer_.resize(rows_out, quadrature.size());
+    ansatz_in_buffer_.resize(cols_in, quadrature.size());
+    ansatz_out_buffer_.resize(cols_out, quadrature.size());
+    // gather the values at all points, the weights and the penalty go to the ansatz side
+    const auto h = intersection_diameter_(this->intersection());
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      const auto& point_in_reference_intersection = quadrature[qq].position();
+      const auto point_in_inside_reference_element =
+          this->intersection().geometryInInside().global(point_in_reference_intersection);
+      const auto point_in_outside_reference_element =
+          this->intersection().geometryInOutside().global(point_in_reference_intersection);
+      const auto normal = this->intersection().unitOuterNormal(point_in_reference_intersection);
+      test_basis_inside.evaluate(point_in_inside_reference_element, test_basis_in_values_, param);
+      test_basis_outside.evaluate(point_in_outside_reference_element, test_basis_out_values_, param);
+      ansatz_basis_inside.evaluate(point_in_inside_reference_element, ansatz_basis_in_values_, param);
+      ansatz_basis_outside.evaluate(point_in_outside_reference_element, ansatz_basis_out_values_, param);
+      const auto factor =
+          weights[qq]
+          * weighted_penalty(point_in_inside_reference_element, point_in_outside_reference_element, normal, h, param);
+      for (size_t ii = 0; ii < rows_in; ++ii)
+        test_in_buffer_(ii, qq) = test_basis_in_values_[ii][0];
+      for (size_t ii = 0; ii < rows_out; ++ii)
+        test_out_buffer_(ii, qq) = test_basis_out_values_[ii][0];
+      for (size_t jj = 0; jj < cols_in; ++jj)
+        ansatz_in_buffer_(jj, qq) = factor * ansatz_basis_in_values_[jj][0];
+      for (size_t jj = 0; jj < cols_out; ++jj)
+        ansatz_out_buffer_(jj, qq) = factor * ansatz_basis_out_values_[jj][0];
+    }
+    // compute the integrals
+    GDT::internal::add_batched_products(test_in_buffer_, ansatz_in_buffer_, result_in_in);
+    GDT::internal::add_batched_products(test_in_buffer_, ansatz_out_buffer_, result_in_out, F(-1));
+    GDT::internal::add_batched_products(test_out_buffer_, ansatz_in_buffer_, result_out_in, F(-1));
+    GDT::internal::add_batched_products(test_out_buffer_, ansatz_out_buffer_, result_out_out);
+  } // ... evaluate_all(...)
+
 private:
+  template <class PointInElement, class Normal>
+  double weighted_penalty(const PointInElement& point_in_inside_reference_element,
+                          const PointInElement& point_in_outside_reference_element,
+                          const Normal& normal,
+                          const double& h,
+                          const XT::Common::Parameter& param) const
+  {
+    const auto weight_in = local_weight_in_->evaluate(point_in_inside_reference_element, param);
+    const auto weight_out = local_weight_out_->evaluate(point_in_outside_reference_element, param);
+    const double delta_plus = normal * (weight_out * normal);
+    const double delta_minus = normal * (weight_in * normal);
+    const auto weight = (delta_plus * delta_minus) / (delta_plus + delta_minus); // half harmonic average
+    return (penalty_ * weight) / h;
+  } // ... weighted_penalty(...)
+
   const double penalty_;
   const std::unique_ptr<XT::Functions::GridFunctionInterface<E, d, d>> weight_;
   const std::function<double(const I&)> intersection_diameter_;
@@ -190,6 +262,10 @@ private:
   mutable std::vector<typename LocalTestBasisType::RangeType> test_basis_out_values_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_in_values_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_out_values_;
+  mutable GDT::internal::FunctionMajorQuadratureBuffer<F> test_in_buffer_;
+  mutable GDT::internal::FunctionMajorQuadratureBuffer<F> test_out_buffer_;
+  mutable GDT::internal::PointMajorQuadratureBuffer<F> ansatz_in_buffer_;
+  mutable GDT::internal::PointMajorQuadratureBuffer<F> ansatz_out_buffer_;
 }; // InnerPenalty
 
 
@@ -286,24 +362,65 @@ public:
     // ... basis functions ...
     test_basis.evaluate(point_in_inside_reference_element, test_basis_values_, param);
     ansatz_basis.evaluate(point_in_inside_reference_element, ansatz_basis_values_, param);
-    // ... and data functions, ....
-    const auto weight = local_weight_->evaluate(point_in_inside_reference_element, param);
-    // compute the weighted penalty ...
+    // ... and the weighted penalty, ...
     const auto h = intersection_diameter_(this->intersection());
-    const auto penalty = (penalty_ * (normal * (weight * normal))) / h;
+    const auto penalty = weighted_penalty(point_in_inside_reference_element, normal, h, param);
     // and finally compute integrand.
     for (size_t ii = 0; ii < rows; ++ii)
       for (size_t jj = 0; jj < cols; ++jj)
         result[ii][jj] += penalty * ansatz_basis_values_[jj] * test_basis_values_[ii];
   } // ... evaluate(...)
 
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseType::D, d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    this->ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    test_buffer_.resize(rows, quadrature.size());
+    ansatz_buffer_.resize(cols, quadrature.size());
+    // gather the values at all points, the weights and the penalty go to the ansatz side
+    const auto h = intersection_diameter_(this->intersection());
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      const auto& point_in_reference_intersection = quadrature[qq].position();
+      const auto point_in_inside_reference_element =
+          this->intersection().geometryInInside().global(point_in_reference_intersection);
+      const auto normal = this->intersection().unitOuterNormal(point_in_reference_intersection);
+      test_basis.evaluate(point_in_inside_reference_element, test_basis_values_, param);
+      ansatz_basis.evaluate(point_in_inside_reference_element, ansatz_basis_values_, param);
+      const auto factor = weights[qq] * weighted_penalty(point_in_inside_reference_element, normal, h, param);
+      for (size_t ii = 0; ii < rows; ++ii)
+        test_buffer_(ii, qq) = test_basis_values_[ii][0];
+      for (size_t jj = 0; jj < cols; ++jj)
+        ansatz_buffer_(jj, qq) = factor * ansatz_basis_values_[jj][0];
+    }
+    // compute the integral
+    GDT::internal::add_batched_products(test_buffer_, ansatz_buffer_, result);
+  } // ... evaluate_all(...)
+
 private:
+  template <class PointInElement, class Normal>
+  double weighted_penalty(const PointInElement& point_in_inside_reference_element,
+                          const Normal& normal,
+                          const double& h,
+                          const XT::Common::Parameter& param) const
+  {
+    const auto weight = local_weight_->evaluate(point_in_inside_reference_element, param);
+    return (penalty_ * (normal * (weight * normal))) / h;
+  }
+
   const double penalty_;
   const std::unique_ptr<XT::Functions::GridFunctionInterface<E, d, d>> weight_;
   const std::function<double(const I&)> intersection_diameter_;
   std::unique_ptr<typename XT::Functions::GridFunctionInterface<E, d, d>::LocalFunctionType> local_weight_;
   mutable std::vector<typename LocalTestBasisType::RangeType> test_basis_values_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_values_;
+  mutable GDT::internal::FunctionMajorQuadratureBuffer<F> test_buffer_;
+  mutable GDT::internal::PointMajorQuadratureBuffer<F> ansatz_buffer_;
 }; // BoundaryPenalty
 
 
@@ -16,6 +16,7 @@
 
 #include <dune/xt/functions/grid-function.hh>
 
+#include "batched.hh"
 #include "interfaces.hh"
 #include "ipdg.hh"
 
@@ -192,6 +193,98 @@ public:
     }
   } // ... evaluate(...)
 
+  void evaluate_all(const LocalTestBasisType& test_basis_inside,
+                    const LocalAnsatzBasisType& ansatz_basis_inside,
+                    const LocalTestBasisType& test_basis_outside,
+                    const LocalAnsatzBasisType& ansatz_basis_outside,
+                    const QuadratureRule<typename BaseType::D, d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result_in_in,
+                    DynamicMatrix<F>& result_in_out,
+                    DynamicMatrix<F>& result_out_in,
+                    DynamicMatrix<F>& result_out_out,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    this->ensure_size_and_clear_results(test_basis_inside,
+                                        ansatz_basis_inside,
+                                        test_basis_outside,
+                                        ansatz_basis_outside,
+                                        result_in_in,
+                                        result_in_out,
+                                        result_out_in,
+                                        result_out_out,
+                                        param);
+    const size_t rows_in = test_basis_inside.size(param);
+    const size_t rows_out = test_basis_outside.size(param);
+    const size_t cols_in = ansatz_basis_inside.size(param);
+    const size_t cols_out = ansatz_basis_outside.size(param);
+    // Each block of the integrand is a sum of two products, (ansatz flux) * (test value) and (ansatz value) * (test
+    // flux), so we store the values for all points followed by the fluxes for all points for the test functions, and
+    // the matching weighted fluxes followed by the weighted values for the ansatz functions.
+    const size_t num_points = quadrature.size();
+    test_in_buffer_.resize(rows_in, 2 * num_points);
+    test_out_buffer_.resize(rows_out, 2 * num_points);
+    ansatz_in_for_in_buffer_.resize(cols_in, 2 * num_points);
+    ansatz_out_for_in_buffer_.resize(cols_out, 2 * num_points);
+    ansatz_in_for_out_buffer_.resize(cols_in, 2 * num_points);
+    ansatz_out_for_out_buffer_.resize(cols_out, 2 * num_points);
+    for (size_t qq = 0; qq < num_points; ++qq) {
+      // evaluate as in evaluate(), ...
+      const auto& point_in_reference_intersection = quadrature[qq].position();
+      const auto point_in_inside_reference_element =
+          this->intersection().geometryInInside().global(point_in_reference_intersection);
+      const auto point_in_outside_reference_element =
+          this->intersection().geometryInOutside().global(point_in_reference_intersection);
+      const auto normal = this->intersection().unitOuterNormal(point_in_reference_intersection);
+      test_basis_inside.evaluate(point_in_inside_reference_element, test_basis_in_values_, param);
+      test_basis_inside.jacobians(point_in_inside_reference_element, test_basis_in_grads_, param);
+      test_basis_outside.evaluate(point_in_outside_reference_element, test_basis_out_values_, param);
+      test_basis_outside.jacobians(point_in_outside_reference_element, test_basis_out_grads_, param);
+      ansatz_basis_inside.evaluate(point_in_inside_reference_element, ansatz_basis_in_values_, param);
+      ansatz_basis_inside.jacobians(point_in_inside_reference_element, ansatz_basis_in_grads_, param);
+      ansatz_basis_outside.evaluate(point_in_outside_reference_element, ansatz_basis_out_values_, param);
+      ansatz_basis_outside.jacobians(point_in_outside_reference_element, ansatz_basis_out_grads_, param);
+      const auto diffusion_in = local_diffusion_in_->evaluate(point_in_inside_reference_element, param);
+      const auto diffusion_out = local_diffusion_out_->evaluate(point_in_outside_reference_element, param);
+      const auto weight_in = local_weight_in_->evaluate(point_in_inside_reference_element, param);
+      const auto weight_out = local_weight_out_->evaluate(point_in_outside_reference_element, param);
+      const auto delta_plus = normal * (weight_out * normal);
+      const auto delta_minus = normal * (weight_in * normal);
+      const auto weight_minus = weights[qq] * delta_plus / (delta_plus + delta_minus);
+      const auto weight_plus = weights[qq] * delta_minus / (delta_plus + delta_minus);
+      // ... and fill the buffers.
+      for (size_t ii = 0; ii < rows_in; ++ii) {
+        test_in_buffer_(ii, qq) = test_basis_in_values_[ii][0];
+        test_in_buffer_(ii, num_points + qq) = (diffusion_in * test_basis_in_grads_[ii][0]) * normal;
+      }
+      for (size_t ii = 0; ii < rows_out; ++ii) {
+        test_out_buffer_(ii, qq) = test_basis_out_values_[ii][0];
+        test_out_buffer_(ii, num_points + qq) = (diffusion_out * test_basis_out_grads_[ii][0]) * normal;
+      }
+      for (size_t jj = 0; jj < cols_in; ++jj) {
+        const auto flux = (diffusion_in * ansatz_basis_in_grads_[jj][0]) * normal;
+        const auto value = ansatz_basis_in_values_[jj][0];
+        ansatz_in_for_in_buffer_(jj, qq) = -1.0 * weight_minus * flux;
+        ansatz_in_for_in_buffer_(jj, num_points + qq) = -1.0 * symmetry_prefactor_ * weight_minus * value;
+        ansatz_in_for_out_buffer_(jj, qq) = weight_minus * flux;
+        ansatz_in_for_out_buffer_(jj, num_points + qq) = -1.0 * symmetry_prefactor_ * weight_plus * value;
+      }
+      for (size_t jj = 0; jj < cols_out; ++jj) {
+        const auto flux = (diffusion_out * ansatz_basis_out_grads_[jj][0]) * normal;
+        const auto value = ansatz_basis_out_values_[jj][0];
+        ansatz_out_for_in_buffer_(jj, qq) = -1.0 * weight_plus * flux;
+        ansatz_out_for_in_buffer_(jj, num_points + qq) = symmetry_prefactor_ * weight_minus * value;
+        ansatz_out_for_out_buffer_(jj, qq) = weight_plus * flux;
+        ansatz_out_for_out_buffer_(jj, num_points + qq) = symmetry_prefactor_ * weight_plus * value;
+      }
+    }
+    // compute the integrals
+    internal::add_batched_products(test_in_buffer_, ansatz_in_for_in_buffer_, result_in_in);
+    internal::add_batched_products(test_in_buffer_, ansatz_out_for_in_buffer_, result_in_out);
+    internal::add_batched_products(test_out_buffer_, ansatz_in_for_out_buffer_, result_out_in);
+    internal::add_batched_products(test_out_buffer_, ansatz_out_for_out_buffer_, result_out_out);
+  } // ... evaluate_all(...)
+
 private:
   const double symmetry_prefactor_;
   const std::unique_ptr<XT::Functions::GridFunctionInterface<E, d, d>> diffusion_;
@@ -208,6 +301,12 @@ private:
   mutable std::vector<typename LocalAnsatzBasisType::DerivativeRangeType> ansatz_basis_in_grads_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_out_values_;
   mutable std::vector<typename LocalAnsatzBasisType::DerivativeRangeType> ansatz_basis_out_grads_;
+  mutable internal::FunctionMajorQuadratureBuffer<F> test_in_buffer_;
+  mutable internal::FunctionMajorQuadratureBuffer<F> test_out_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_in_for_in_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_out_for_in_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_in_for_out_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_out_for_out_buffer_;
 }; // InnerCoupling
 
 
@@ -377,6 +476,44 @@ public:
       }
   } // ... evaluate(...)
 
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseBinaryType::D, d - 1>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    BaseBinaryType::ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    // values followed by fluxes for the test functions, matching weighted fluxes followed by weighted values for the
+    // ansatz functions (see InnerCoupling::evaluate_all())
+    const size_t num_points = quadrature.size();
+    test_buffer_.resize(rows, 2 * num_points);
+    ansatz_buffer_.resize(cols, 2 * num_points);
+    for (size_t qq = 0; qq < num_points; ++qq) {
+      const auto& point_in_reference_intersection = quadrature[qq].position();
+      const auto point_in_inside_reference_element =
+          BaseBinaryType::intersection().geometryInInside().global(point_in_reference_intersection);
+      const auto normal = BaseBinaryType::intersection().unitOuterNormal(point_in_reference_intersection);
+      test_basis.evaluate(point_in_inside_reference_element, test_basis_values_, param);
+      test_basis.jacobians(point_in_inside_reference_element, test_basis_grads_, param);
+      ansatz_basis.evaluate(point_in_inside_reference_element, ansatz_basis_values_, param);
+      ansatz_basis.jacobians(point_in_inside_reference_element, ansatz_basis_grads_, param);
+      const auto diffusion = local_diffusion_->evaluate(point_in_inside_reference_element, param);
+      for (size_t ii = 0; ii < rows; ++ii) {
+        test_buffer_(ii, qq) = test_basis_values_[ii][0];
+        test_buffer_(ii, num_points + qq) = (diffusion * test_basis_grads_[ii][0]) * normal;
+      }
+      for (size_t jj = 0; jj < cols; ++jj) {
+        ansatz_buffer_(jj, qq) = -1.0 * weights[qq] * ((diffusion * ansatz_basis_grads_[jj][0]) * normal);
+        ansatz_buffer_(jj, num_points + qq) = -1.0 * symmetry_prefactor_ * weights[qq] * ansatz_basis_values_[jj][0];
+      }
+    }
+    // compute the integral
+    internal::add_batched_products(test_buffer_, ansatz_buffer_, result);
+  } // ... evaluate_all(...)
+
   /// \}
 
 private:
@@ -389,6 +526,8 @@ private:
   mutable std::vector<typename LocalTestBasisType::DerivativeRangeType> test_basis_grads_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_values_;
   mutable std::vector<typename LocalAnsatzBasisType::DerivativeRangeType> ansatz_basis_grads_;
+  mutable internal::FunctionMajorQuadratureBuffer<F> test_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_buffer_;
 }; // class DirichletCoupling
 
 
@@ -18,6 +18,7 @@
 #include <dune/xt/la/container/eye-matrix.hh>
 #include <dune/xt/functions/grid-function.hh>
 
+#include "batched.hh"
 #include "interfaces.hh"
 
 namespace Dune {
@@ -89,6 +90,90 @@ public:
                 const DomainType& point_in_reference_element,
                 DynamicMatrix<F>& result,
                 const XT::Common::Parameter& param = {}) const override final
+  {
+    test_basis.jacobians(point_in_reference_element, test_basis_grads_, param);
+    ansatz_basis.jacobians(point_in_reference_element, ansatz_basis_grads_, param);
+    compute(test_basis, ansatz_basis, point_in_reference_element, result, param);
+  } // ... evaluate(...)
+
+  void evaluate_at_quadrature_point(const LocalTestBasisType& test_basis,
+                                    const LocalAnsatzBasisType& ansatz_basis,
+                                    const QuadratureRule<typename BaseType::D, d>& quadrature,
+                                    const size_t point_index,
+                                    DynamicMatrix<F>& result,
+                                    const XT::Common::Parameter& param = {}) const override final
+  {
+    test_basis.jacobians_at_quadrature_point(quadrature, point_index, test_basis_grads_, param);
+    ansatz_basis.jacobians_at_quadrature_point(quadrature, point_index, ansatz_basis_grads_, param);
+    compute(test_basis, ansatz_basis, quadrature[point_index].position(), result, param);
+  } // ... evaluate_at_quadrature_point(...)
+
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseType::D, d>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const override final
+  {
+    this->ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    // gather the gradients at all points, the weights and the diffusion go to the ansatz side
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    test_buffer_.resize(rows, quadrature.size() * r * d);
+    ansatz_buffer_.resize(cols, quadrature.size() * r * d);
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      test_basis.jacobians_at_quadrature_point(quadrature, qq, test_basis_grads_, param);
+      ansatz_basis.jacobians_at_quadrature_point(quadrature, qq, ansatz_basis_grads_, param);
+      const auto weight = local_weight_->evaluate(quadrature[qq].position(), param);
+      for (size_t rr = 0; rr < r; ++rr) {
+        const size_t offset = (qq * r + rr) * d;
+        for (size_t ii = 0; ii < rows; ++ii)
+          for (size_t kk = 0; kk < d; ++kk)
+            test_buffer_(ii, offset + kk) = test_basis_grads_[ii][rr][kk];
+        for (size_t jj = 0; jj < cols; ++jj) {
+          const auto weighted_grad = weight * ansatz_basis_grads_[jj][rr];
+          for (size_t kk = 0; kk < d; ++kk)
+            ansatz_buffer_(jj, offset + kk) = weights[qq] * weighted_grad[kk];
+        }
+      }
+    }
+    // compute integral
+    internal::add_batched_products(test_buffer_, ansatz_buffer_, result);
+  } // ... evaluate_all(...)
+
+  typename BaseType::PointwiseApplication pointwise_application() const override final
+  {
+    typename BaseType::PointwiseApplication ret;
+    ret.ansatz_jacobians = true;
+    ret.test_jacobians = true;
+    return ret;
+  }
+
+  /// (A(x) * grad psi) * grad phi, for each component
+  void apply_pointwise(const DomainType& point_in_reference_element,
+                       const typename LocalAnsatzBasisType::RangeType& /*ansatz_value*/,
+                       const typename LocalAnsatzBasisType::DerivativeRangeType& ansatz_jacobian,
+                       typename LocalTestBasisType::RangeType& /*test_value_coefficient*/,
+                       typename LocalTestBasisType::DerivativeRangeType& test_jacobian_coefficient,
+                       const XT::Common::Parameter& param = {}) const override final
+  {
+    const auto weight = local_weight_->evaluate(point_in_reference_element, param);
+    for (size_t rr = 0; rr < r; ++rr) {
+      if constexpr (d == 1)
+        test_jacobian_coefficient[rr][0] += weight[0] * ansatz_jacobian[rr][0];
+      else
+        weight.umv(ansatz_jacobian[rr], test_jacobian_coefficient[rr]);
+    }
+  } // ... apply_pointwise(...)
+
+private:
+  // requires the basis jacobians at point_in_reference_element to be stored in test_basis_grads_ and
+  // ansatz_basis_grads_
+  void compute(const LocalTestBasisType& test_basis,
+               const LocalAnsatzBasisType& ansatz_basis,
+               const DomainType& point_in_reference_element,
+               DynamicMatrix<F>& result,
+               const XT::Common::Parameter& param) const
   {
     // prepare storage
     const size_t rows = test_basis.size(param);
@@ -97,21 +182,21 @@ public:
       result.resize(rows, cols);
     result *= 0;
     // evaluate
-    test_basis.jacobians(point_in_reference_element, test_basis_grads_, param);
-    ansatz_basis.jacobians(point_in_reference_element, ansatz_basis_grads_, param);
     const auto weight = local_weight_->evaluate(point_in_reference_element, param);
     // compute integrand
     for (size_t ii = 0; ii < rows; ++ii)
       for (size_t jj = 0; jj < cols; ++jj)
         for (size_t rr = 0; rr < r; ++rr)
           result[ii][jj] += (weight * ansatz_basis_grads_[jj][rr]) * test_basis_grads_[ii][rr];
-  } // ... evaluate(...)
+  } // ... compute(...)
 
 private:
   const std::unique_ptr<XT::Functions::GridFunctionInterface<E, d, d, F>> weight_;
   std::unique_ptr<typename XT::Functions::GridFunctionInterface<E, d, d, F>::LocalFunctionType> local_weight_;
   mutable std::vector<typename LocalTestBasisType::DerivativeRangeType> test_basis_grads_;
   mutable std::vector<typename LocalAnsatzBasisType::DerivativeRangeType> ansatz_basis_grads_;
+  mutable internal::FunctionMajorQuadratureBuffer<F> test_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_buffer_;
 }; // class LocalLaplaceIntegrand
 
 
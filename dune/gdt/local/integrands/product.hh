@@ -29,6 +29,7 @@
 
 #include <dune/gdt/print.hh>
 
+#include "batched.hh"
 #include "interfaces.hh"
 
 namespace Dune {
@@ -116,14 +117,99 @@ public:
                 << "}, point_in_{reference_element|physical_space} = {" << print(point_in_reference_element) << "|"
                 << print(this->element().geometry().global(point_in_reference_element)) << "}, param=" << print(param)
                 << ")" << std::endl;
+    test_basis.evaluate(point_in_reference_element, test_basis_values_, param);
+    ansatz_basis.evaluate(point_in_reference_element, ansatz_basis_values_, param);
+    compute(test_basis, ansatz_basis, point_in_reference_element, result, param);
+  } // ... evaluate(...)
+
+  void evaluate_at_quadrature_point(const LocalTestBasisType& test_basis,
+                                    const LocalAnsatzBasisType& ansatz_basis,
+                                    const QuadratureRule<typename BaseType::D, d>& quadrature,
+                                    const size_t point_index,
+                                    DynamicMatrix<F>& result,
+                                    const XT::Common::Parameter& param = {}) const final
+  {
+    LOG_(debug) << "evaluate_at_quadrature_point({test|ansatz}_basis.size()={" << test_basis.size(param) << "|"
+                << ansatz_basis.size(param) << "}, point_index=" << point_index << ", param=" << print(param) << ")"
+                << std::endl;
+    test_basis.evaluate_at_quadrature_point(quadrature, point_index, test_basis_values_, param);
+    ansatz_basis.evaluate_at_quadrature_point(quadrature, point_index, ansatz_basis_values_, param);
+    compute(test_basis, ansatz_basis, quadrature[point_index].position(), result, param);
+  } // ... evaluate_at_quadrature_point(...)
+
+  void evaluate_all(const LocalTestBasisType& test_basis,
+                    const LocalAnsatzBasisType& ansatz_basis,
+                    const QuadratureRule<typename BaseType::D, d>& quadrature,
+                    const std::vector<F>& weights,
+                    DynamicMatrix<F>& result,
+                    const XT::Common::Parameter& param = {}) const final
+  {
+    LOG_(debug) << "evaluate_all({test|ansatz}_basis.size()={" << test_basis.size(param) << "|"
+                << ansatz_basis.size(param) << "}, quadrature.size()=" << quadrature.size()
+                << ", param=" << print(param) << ")" << std::endl;
+    this->ensure_size_and_clear_results(test_basis, ansatz_basis, result, param);
+    // gather the values at all points, the weight function goes to the test side (see compute()), the weights to the
+    // ansatz side
+    const size_t rows = test_basis.size(param);
+    const size_t cols = ansatz_basis.size(param);
+    test_buffer_.resize(rows, quadrature.size() * r);
+    ansatz_buffer_.resize(cols, quadrature.size() * r);
+    for (size_t qq = 0; qq < quadrature.size(); ++qq) {
+      test_basis.evaluate_at_quadrature_point(quadrature, qq, test_basis_values_, param);
+      ansatz_basis.evaluate_at_quadrature_point(quadrature, qq, ansatz_basis_values_, param);
+      const auto weight = local_weight_->evaluate(quadrature[qq].position(), param);
+      for (size_t ii = 0; ii < rows; ++ii) {
+        const auto weighted_value = weight * test_basis_values_[ii];
+        for (size_t rr = 0; rr < r; ++rr)
+          test_buffer_(ii, qq * r + rr) = weighted_value[rr];
+      }
+      for (size_t jj = 0; jj < cols; ++jj)
+        for (size_t rr = 0; rr < r; ++rr)
+          ansatz_buffer_(jj, qq * r + rr) = weights[qq] * ansatz_basis_values_[jj][rr];
+    }
+    // compute integral
+    internal::add_batched_products(test_buffer_, ansatz_buffer_, result);
+    LOG_(debug) << "  result = " << print(result, {{"oneline", "true"}}) << std::endl;
+  } // ... evaluate_all(...)
+
+  typename BaseType::PointwiseApplication pointwise_application() const final
+  {
+    typename BaseType::PointwiseApplication ret;
+    ret.ansatz_values = true;
+    ret.test_values = true;
+    return ret;
+  }
+
+  /// (f(x) * phi) * psi = phi * (f(x)^T * psi)
+  void apply_pointwise(const DomainType& point_in_reference_element,
+                       const typename LocalAnsatzBasisType::RangeType& ansatz_value,
+                       const typename LocalAnsatzBasisType::DerivativeRangeType& /*ansatz_jacobian*/,
+                       typename LocalTestBasisType::RangeType& test_value_coefficient,
+                       typename LocalTestBasisType::DerivativeRangeType& /*test_jacobian_coefficient*/,
+                       const XT::Common::Parameter& param = {}) const final
+  {
+    const auto weight = local_weight_->evaluate(point_in_reference_element, param);
+    if constexpr (r == 1)
+      test_value_coefficient[0] += weight[0] * ansatz_value[0];
+    else
+      weight.umtv(ansatz_value, test_value_coefficient);
+  }
+
+private:
+  // requires the basis values at point_in_reference_element to be stored in test_basis_values_ and
+  // ansatz_basis_values_
+  void compute(const LocalTestBasisType& test_basis,
+               const LocalAnsatzBasisType& ansatz_basis,
+               const DomainType& point_in_reference_element,
+               DynamicMatrix<F>& result,
+               const XT::Common::Parameter& param) const
+  {
     // prepare storage
     const size_t rows = test_basis.size(param);
     const size_t cols = ansatz_basis.size(param);
     if (result.rows() < rows || result.cols() < cols)
       result.resize(rows, cols);
     // evaluate
-    test_basis.evaluate(point_in_reference_element, test_basis_values_, param);
-    ansatz_basis.evaluate(point_in_reference_element, ansatz_basis_values_, param);
     const auto weight = local_weight_->evaluate(point_in_reference_element, param);
     LOG_(debug) << "  test_basis_values_ = " << test_basis_values_
                 << "\n  ansatz_basis_values_ = " << ansatz_basis_values_ << "\n  weight = " << weight << std::endl;
@@ -132,13 +218,15 @@ public:
       for (size_t jj = 0; jj < cols; ++jj)
         result[ii][jj] = (weight * test_basis_values_[ii]) * ansatz_basis_values_[jj];
     LOG_(debug) << "  result = " << print(result, {{"oneline", "true"}}) << std::endl;
-  } // ... evaluate(...)
+  } // ... compute(...)
 
 private:
   const std::unique_ptr<XT::Functions::GridFunctionInterface<E, r, r, F>> weight_;
   std::unique_ptr<typename XT::Functions::GridFunctionInterface<E, r, r, F>::LocalFunctionType> local_weight_;
   mutable std::vector<typename LocalTestBasisType::RangeType> test_basis_values_;
   mutable std::vector<typename LocalAnsatzBasisType::RangeType> ansatz_basis_values_;
+  mutable internal::FunctionMajorQuadratureBuffer<F> test_buffer_;
+  mutable internal::PointMajorQuadratureBuffer<F> ansatz_buffer_;
 }; // class LocalElementProductIntegrand
 
 
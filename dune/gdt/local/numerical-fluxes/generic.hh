@@ -65,6 +65,12 @@ public:
     return std::make_unique<ThisType>(*this);
   }
 
+  // the lambda is given the intersection
+  bool intersection_dependent() const override final
+  {
+    return true;
+  }
+
   using BaseType::apply;
 
   StateType apply(const LocalIntersectionCoords& x,
@@ -15,6 +15,8 @@
 #ifndef DUNE_GDT_LOCAL_NUMERICAL_FLUXES_INTERFACE_HH
 #define DUNE_GDT_LOCAL_NUMERICAL_FLUXES_INTERFACE_HH
 
+#include <dune/common/dynmatrix.hh>
+
 #include <dune/xt/common/parameter.hh>
 #include <dune/xt/common/memory.hh>
 #include <dune/xt/la/container/vector-interface.hh>
@@ -110,6 +112,17 @@ public:
     return flux_.access().x_dependent();
   }
 
+  /**
+   * \brief Whether apply() depends on the intersection the numerical flux is bound to (other than via the normal).
+   *
+   * If not, the numerical flux may be bound once (to any intersection with a neighbor) and then be applied to the data
+   * of all intersections, as in the face table fast path of the AdvectionFvOperator.
+   */
+  virtual bool intersection_dependent() const
+  {
+    return this->x_dependent();
+  }
+
   const FluxType& flux() const
   {
     return flux_.access();
@@ -137,6 +150,30 @@ public:
     ret = XT::Common::convert_to<DynamicStateType>(apply(x_in_local_intersection_coords, u, v, n, param));
   }
 
+  /// \brief Whether jacobians() is implemented.
+  virtual bool provides_jacobians() const
+  {
+    return false;
+  }
+
+  /**
+   * \brief Computes the derivatives of apply(x, u, v, n) w.r.t. u and v, i.e., jacobian_u[ii][jj] = d g_ii / d u_jj.
+   *
+   * \note Both matrices have to be at least of size m x m.
+   * \note Where the numerical flux is only piecewise differentiable (e.g., at an upwind switch), one of the one-sided
+   *       derivatives is returned.
+   */
+  virtual void jacobians(const LocalIntersectionCoords& /*x_in_local_intersection_coords*/,
+                         const StateType& /*u*/,
+                         const StateType& /*v*/,
+                         const PhysicalDomainType& /*n*/,
+                         DynamicMatrix<R>& /*jacobian_u*/,
+                         DynamicMatrix<R>& /*jacobian_v*/,
+                         const XT::Common::Parameter& /*param*/ = {}) const
+  {
+    DUNE_THROW(Exceptions::numerical_flux_error, "This numerical flux does not provide jacobians!");
+  }
+
   // Convenience apply methods
   template <class V>
   StateType apply(const LocalIntersectionCoords x_in_local_intersection_coords,
@@ -210,6 +247,28 @@ protected:
     }
   }
 
+  // ret[ii][jj] = sum_dd n[dd] * d f_{dd, ii} / d w_jj, the derivative of f(w) * n w.r.t. w
+  void compute_normal_flux_jacobian(const LocalFluxType& local_flux,
+                                    const PhysicalDomainType& x_in_entity_coords,
+                                    const StateType& w,
+                                    const PhysicalDomainType& n,
+                                    DynamicMatrix<R>& ret,
+                                    const XT::Common::Parameter& param) const
+  {
+    const auto df = local_flux.jacobian(x_in_entity_coords, w, param);
+    for (size_t ii = 0; ii < m; ++ii)
+      for (size_t jj = 0; jj < m; ++jj) {
+        ret[ii][jj] = 0.;
+        for (size_t dd = 0; dd < d; ++dd) {
+          // the flux jacobian is (d x 1)-shaped in the scalar case, see the flux function interface
+          if constexpr (m == 1)
+            ret[ii][jj] += n[dd] * df[dd][0];
+          else
+            ret[ii][jj] += n[dd] * df[dd][ii][jj];
+        }
+      }
+  } // ... compute_normal_flux_jacobian(...)
+
   mutable std::unique_ptr<LocalFluxType> local_flux_inside_;
   mutable std::unique_ptr<LocalFluxType> local_flux_outside_;
   mutable PhysicalDomainType x_in_inside_coords_;
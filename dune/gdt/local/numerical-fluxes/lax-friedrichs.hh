@@ -93,6 +93,43 @@ public:
     return ret;
   }
 
+  bool provides_jacobians() const override final
+  {
+    return true;
+  }
+
+  /// \note If lambda is computed from u and v, its dependency on u and v is neglected.
+  void jacobians(const LocalIntersectionCoords& x,
+                 const StateType& u,
+                 const StateType& v,
+                 const PhysicalDomainType& n,
+                 DynamicMatrix<R>& jacobian_u,
+                 DynamicMatrix<R>& jacobian_v,
+                 const XT::Common::Parameter& param = {}) const override final
+  {
+    this->compute_entity_coords(x);
+    R lambda = lambda_;
+    if (XT::Common::is_zero(lambda)) {
+      const auto df_u = local_flux_inside_->jacobian(x_in_inside_coords_, u, param);
+      const auto df_v = local_flux_outside_->jacobian(x_in_outside_coords_, v, param);
+      for (size_t dd = 0; dd < d; ++dd) {
+        lambda = std::max(lambda, df_u[dd].infinity_norm());
+        lambda = std::max(lambda, df_v[dd].infinity_norm());
+      }
+      lambda = 1. / lambda;
+    }
+    this->compute_normal_flux_jacobian(*local_flux_inside_, x_in_inside_coords_, u, n, jacobian_u, param);
+    this->compute_normal_flux_jacobian(*local_flux_outside_, x_in_outside_coords_, v, n, jacobian_v, param);
+    for (size_t ii = 0; ii < m; ++ii) {
+      for (size_t jj = 0; jj < m; ++jj) {
+        jacobian_u[ii][jj] *= 0.5;
+        jacobian_v[ii][jj] *= 0.5;
+      }
+      jacobian_u[ii][ii] += 0.5 / lambda;
+      jacobian_v[ii][ii] -= 0.5 / lambda;
+    }
+  } // ... jacobians(...)
+
 private:
   using BaseType::local_flux_inside_;
   using BaseType::local_flux_outside_;
@@ -92,6 +92,31 @@ public:
       return local_flux_outside_->evaluate(x_in_outside_coords_, v, param) * n;
   }
 
+  bool provides_jacobians() const override final
+  {
+    return true;
+  }
+
+  void jacobians(const LocalIntersectionCoords& x,
+                 const StateType& u,
+                 const StateType& v,
+                 const PhysicalDomainType& n,
+                 DynamicMatrix<R>& jacobian_u,
+                 DynamicMatrix<R>& jacobian_v,
+                 const XT::Common::Parameter& param = {}) const override final
+  {
+    this->compute_entity_coords(x);
+    // same upwind direction as in apply(), the flux only depends on one of the states
+    this->compute_normal_flux_jacobian(*local_flux_inside_, x_in_inside_coords_, (u + v) / 2., n, jacobian_u, param);
+    if (jacobian_u[0][0] > 0) {
+      this->compute_normal_flux_jacobian(*local_flux_inside_, x_in_inside_coords_, u, n, jacobian_u, param);
+      jacobian_v[0][0] = 0.;
+    } else {
+      this->compute_normal_flux_jacobian(*local_flux_outside_, x_in_outside_coords_, v, n, jacobian_v, param);
+      jacobian_u[0][0] = 0.;
+    }
+  } // ... jacobians(...)
+
 private:
   using BaseType::local_flux_inside_;
   using BaseType::local_flux_outside_;
@@ -25,7 +25,9 @@
 #include <dune/xt/grid/intersection.hh>
 
 #include <dune/gdt/exceptions.hh>
+#include <dune/gdt/local/discretefunction.hh>
 #include <dune/gdt/local/dof-vector.hh>
+#include <dune/gdt/local/finite-elements/tensor-product.hh>
 #include <dune/gdt/type_traits.hh>
 
 #include <dune/gdt/local/numerical-fluxes/interface.hh>
@@ -138,7 +140,36 @@ public:
     const auto u_order = u_->order(param);
     const auto local_basis_order = basis.order(param);
     const auto integrand_order = local_flux_->order(param) * u_order + std::max(local_basis_order - 1, 0);
-    const auto quadrature_rule_vol = QuadratureRules<D, d>::rule(element().type(), integrand_order);
+    if (!integrate_sum_factorized(basis, integrand_order, param)) {
+      const auto quadrature_rule_vol = QuadratureRules<D, d>::rule(element().type(), integrand_order);
+      integrate(basis, quadrature_rule_vol, param);
+    }
+    // add to local range, applying the inverse local mass matrix, if required
+    if (local_mass_matrices_.valid())
+      local_mass_matrices_.access().apply_inverse(element(), local_dofs_, local_range.dofs());
+    else
+      for (size_t ii = 0; ii < basis.size(param); ++ii)
+        local_range.dofs().add_to_entry(ii, local_dofs_[ii]);
+  } // ... apply(...)
+
+protected:
+  void post_bind(const E& ele) override final
+  {
+    BaseType::post_bind(ele);
+    local_flux_->bind(ele);
+  }
+
+private:
+  using LocalBasisType = typename LocalRangeType::LocalBasisType;
+  using KernelType = LocalSumFactorizationKernel<D, d, RF>;
+  using LocalDiscreteSourceType = ConstLocalDiscreteFunction<SV, SGV, m, 1, SF>;
+
+  // adds the volume integral to local_dofs_, evaluating basis and source pointwise
+  void integrate(const LocalBasisType& basis,
+                 const QuadratureRule<D, d>& quadrature_rule_vol,
+                 const XT::Common::Parameter& param) const
+  {
+    const auto& u_ = local_sources_[0];
     for (auto&& quadrature_point : quadrature_rule_vol) {
       // prepare
       const auto point_in_reference_element = quadrature_point.position();
@@ -167,28 +198,90 @@ public:
         local_dofs_[ii] += integration_factor * quadrature_weight * -1. * flux_dot_jacobian;
       }
     }
-    // apply local mass matrix, if required (not optimal, uses a temporary)
-    if (local_mass_matrices_.valid())
-      local_dofs_ = local_mass_matrices_.access().local_mass_matrix_inverse(element()) * local_dofs_;
-    // add to local range
-    for (size_t ii = 0; ii < basis.size(param); ++ii)
-      local_range.dofs().add_to_entry(ii, local_dofs_[ii]);
-  } // ... apply(...)
-
-protected:
-  void post_bind(const E& ele) override final
+  } // ... integrate(...)
+
+  /**
+   * Adds the volume integral to local_dofs_ using sum factorization, if the element is a cube and the local finite
+   * element of the range factorizes into one-dimensional Lagrange polynomials (see LocalTensorProductLagrangeBasis).
+   * The source is evaluated sum-factorized as well, if it is a discrete function with such a local finite element.
+   * Returns false if not applicable.
+   *
+   * The flux contracted with the basis jacobians is integrated as \sum_qq (J^{-1} G_qq) * \nabla phi_ref(x_qq), where
+   * the rows of G_qq are given by -f(u(x_qq))^T times the integration factor.
+   */
+  bool integrate_sum_factorized(const LocalBasisType& basis,
+                                const int integrand_order,
+                                const XT::Common::Parameter& param) const
   {
-    BaseType::post_bind(ele);
-    local_flux_->bind(ele);
-  }
+    const auto& u_ = local_sources_[0];
+    if (!element().type().isCube())
+      return false;
+    const auto* factorization = basis.finite_element().tensor_product_basis();
+    if (factorization == nullptr)
+      return false;
+    const auto& kernel = factorization->kernel_for_order(integrand_order);
+    const auto& points = kernel.points();
+    const size_t num_points = points.size();
+    // the source at all points
+    source_values_.resize(num_points);
+    const auto* discrete_source = dynamic_cast<const LocalDiscreteSourceType*>(u_.get());
+    const auto* source_factorization =
+        (discrete_source != nullptr) ? discrete_source->basis().finite_element().tensor_product_basis() : nullptr;
+    if (source_factorization != nullptr) {
+      const auto& source_kernel = source_factorization->kernel(kernel.num_points_1d());
+      for (size_t rr = 0; rr < m; ++rr) {
+        source_kernel.evaluate(
+            discrete_source->dofs(), source_scalar_values_, source_workspace_, rr * source_factorization->size());
+        for (size_t qq = 0; qq < num_points; ++qq)
+          source_values_[qq][rr] = source_scalar_values_[qq];
+      }
+    } else {
+      for (size_t qq = 0; qq < num_points; ++qq)
+        source_values_[qq] = u_->evaluate(points[qq], param);
+    }
+    // the flux at all points, mapped to the reference element
+    reference_gradients_.resize(m);
+    for (size_t rr = 0; rr < m; ++rr)
+      reference_gradients_[rr].resize(num_points);
+    const auto& geometry = element().geometry();
+    auto jacobian_inverse_transposed = geometry.jacobianInverseTransposed(points[0]);
+    auto integration_element = geometry.integrationElement(points[0]);
+    for (size_t qq = 0; qq < num_points; ++qq) {
+      if (qq > 0 && !geometry.affine()) {
+        jacobian_inverse_transposed = geometry.jacobianInverseTransposed(points[qq]);
+        integration_element = geometry.integrationElement(points[qq]);
+      }
+      const auto flux_value = local_flux_->evaluate(points[qq], source_values_[qq], param);
+      const RF factor = -1. * integration_element * kernel.weights()[qq];
+      for (size_t rr = 0; rr < m; ++rr) {
+        for (size_t ss = 0; ss < d; ++ss) {
+          if constexpr (m == 1)
+            flux_row_[ss] = factor * flux_value[ss];
+          else
+            flux_row_[ss] = factor * flux_value[ss][rr];
+        }
+        jacobian_inverse_transposed.mtv(flux_row_, reference_gradients_[rr][qq]);
+      }
+    }
+    // integrate against the basis, component by component (see LocalTensorProductLagrangeBasis)
+    for (size_t rr = 0; rr < m; ++rr)
+      kernel.integrate_reference_gradients(
+          reference_gradients_[rr], local_dofs_, workspace_, rr * factorization->size());
+    return true;
+  } // ... integrate_sum_factorized(...)
 
-private:
   using BaseType::local_sources_;
   const FluxType& flux_;
   std::unique_ptr<typename FluxType::LocalFunctionType> local_flux_;
   const XT::Common::ConstStorageProvider<LocalMassMatrixProviderType> local_mass_matrices_;
   mutable std::vector<typename LocalRangeType::LocalBasisType::DerivativeRangeType> basis_jacobians_;
   mutable XT::LA::CommonDenseVector<RF> local_dofs_;
+  mutable std::vector<typename LocalSourceType::RangeReturnType> source_values_;
+  mutable std::vector<SF> source_scalar_values_;
+  mutable FieldVector<RF, d> flux_row_;
+  mutable std::vector<std::vector<typename KernelType::GradientType>> reference_gradients_;
+  mutable typename KernelType::Workspace workspace_;
+  mutable typename LocalSumFactorizationKernel<D, d, SF>::Workspace source_workspace_;
 }; // class LocalAdvectionDgVolumeOperator
 
 
@@ -357,19 +450,21 @@ public:
         for (size_t ii = 0; ii < outside_basis.size(param); ++ii)
           outside_local_dofs_[ii] -= integration_factor * quadrature_weight * (g * outside_basis_values_[ii]);
     }
-    // apply local mass matrix, if required (not optimal, uses a temporary)
+    // add to local range, applying the inverse local mass matrices, if required
     if (local_mass_matrices_.valid())
-      inside_local_dofs_ =
-          local_mass_matrices_.access().local_mass_matrix_inverse(intersection().inside()) * inside_local_dofs_;
-    if (compute_outside_ && local_mass_matrices_.valid())
-      outside_local_dofs_ =
-          local_mass_matrices_.access().local_mass_matrix_inverse(local_range_outside.element()) * outside_local_dofs_;
-    // add to local range
-    for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
-      local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
-    if (compute_outside_)
-      for (size_t ii = 0; ii < outside_basis.size(param); ++ii)
-        local_range_outside.dofs().add_to_entry(ii, outside_local_dofs_[ii]);
+      local_mass_matrices_.access().apply_inverse(
+          intersection().inside(), inside_local_dofs_, local_range_inside.dofs());
+    else
+      for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
+        local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
+    if (compute_outside_) {
+      if (local_mass_matrices_.valid())
+        local_mass_matrices_.access().apply_inverse(
+            local_range_outside.element(), outside_local_dofs_, local_range_outside.dofs());
+      else
+        for (size_t ii = 0; ii < outside_basis.size(param); ++ii)
+          local_range_outside.dofs().add_to_entry(ii, outside_local_dofs_[ii]);
+    }
   } // ... apply(...)
 
 protected:
@@ -526,12 +621,12 @@ public:
       for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
         inside_local_dofs_[ii] += integration_factor * quadrature_weight * (g * inside_basis_values_[ii]);
     }
-    // apply local mass matrix, if required (not optimal, uses a temporary)
+    // add to local range, applying the inverse local mass matrix, if required
     if (local_mass_matrices_.valid())
-      inside_local_dofs_ = local_mass_matrices_.access().local_mass_matrix_inverse(element) * inside_local_dofs_;
-    // add to local range
-    for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
-      local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
+      local_mass_matrices_.access().apply_inverse(element, inside_local_dofs_, local_range_inside.dofs());
+    else
+      for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
+        local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
   } // ... apply(...)
 
 private:
@@ -685,12 +780,12 @@ public:
       for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
         inside_local_dofs_[ii] += integration_factor * quadrature_weight * (g * inside_basis_values_[ii]);
     }
-    // apply local mass matrix, if required (not optimal, uses a temporary)
+    // add to local range, applying the inverse local mass matrix, if required
     if (local_mass_matrices_.valid())
-      inside_local_dofs_ = local_mass_matrices_.access().local_mass_matrix_inverse(element) * inside_local_dofs_;
-    // add to local range
-    for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
-      local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
+      local_mass_matrices_.access().apply_inverse(element, inside_local_dofs_, local_range_inside.dofs());
+    else
+      for (size_t ii = 0; ii < inside_basis.size(param); ++ii)
+        local_range_inside.dofs().add_to_entry(ii, inside_local_dofs_[ii]);
   } // ... apply(...)
 
 protected:
@@ -889,12 +984,12 @@ public:
                              * smoothed_discrete_jump_indicator * (source_jacobian[0] * basis_jacobians_[ii][0]);
       }
     }
-    // apply local mass matrix, if required (not optimal, uses a temporary)
+    // add to local range, applying the inverse local mass matrix, if required
     if (local_mass_matrices_.valid())
-      local_dofs_ = local_mass_matrices_.access().local_mass_matrix_inverse(element()) * local_dofs_;
-    // add to local range
-    for (size_t ii = 0; ii < basis.size(param); ++ii)
-      local_range.dofs().add_to_entry(ii, local_dofs_[ii]);
+      local_mass_matrices_.access().apply_inverse(element(), local_dofs_, local_range.dofs());
+    else
+      for (size_t ii = 0; ii < basis.size(param); ++ii)
+        local_range.dofs().add_to_entry(ii, local_dofs_[ii]);
   } // ... apply(...)
 
 private:
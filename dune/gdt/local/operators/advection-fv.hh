@@ -78,6 +78,8 @@ public:
     , u_(m)
     , v_(m)
     , g_(m)
+    , dg_du_(m, m, 0.)
+    , dg_dv_(m, m, 0.)
   {
   }
 
@@ -90,6 +92,8 @@ public:
     , u_(m)
     , v_(m)
     , g_(m)
+    , dg_du_(m, m, 0.)
+    , dg_dv_(m, m, 0.)
   {
   }
 
@@ -103,6 +107,8 @@ public:
     , u_(m)
     , v_(m)
     , g_(m)
+    , dg_du_(m, m, 0.)
+    , dg_dv_(m, m, 0.)
   {
   }
 
@@ -118,6 +124,8 @@ public:
     , u_(m)
     , v_(m)
     , g_(m)
+    , dg_du_(m, m, 0.)
+    , dg_dv_(m, m, 0.)
   {
   }
 
@@ -161,6 +169,44 @@ public:
     }
   } // ... apply(...)
 
+  /// \brief The local DoFs of a finite volume source are its values, so we only need the numerical flux jacobians.
+  bool provides_jacobian(const SourceSpaceType& source_space) const override final
+  {
+    return source_space.type() == SpaceType::finite_volume && numerical_flux_->provides_jacobians();
+  }
+
+  void jacobian(const LocalInsideRangeType& /*local_range_inside*/,
+                const LocalOutsideRangeType& /*local_range_outside*/,
+                DynamicMatrix<RR>& jacobian_in_in,
+                DynamicMatrix<RR>& jacobian_in_out,
+                DynamicMatrix<RR>& jacobian_out_in,
+                DynamicMatrix<RR>& jacobian_out_out,
+                const XT::Common::Parameter& param = {}) const override final
+  {
+    local_sources_[0]->evaluate(intersection().geometryInInside().center(), u_, param);
+    local_sources_[1]->evaluate(intersection().geometryInOutside().center(), v_, param);
+    if (numerical_flux_->x_dependent())
+      x_in_intersection_coords_ = intersection().geometry().local(intersection().geometry().center());
+    numerical_flux_->jacobians(x_in_intersection_coords_,
+                               XT::Common::convert_to<typename NumericalFluxType::StateType>(u_),
+                               XT::Common::convert_to<typename NumericalFluxType::StateType>(v_),
+                               intersection().centerUnitOuterNormal(),
+                               dg_du_,
+                               dg_dv_,
+                               param);
+    // same scaling as in apply()
+    const auto h_intersection = intersection().geometry().volume();
+    const auto hinv_inside_element = 1. / intersection().inside().geometry().volume();
+    const auto hinv_outside_element = 1. / intersection().outside().geometry().volume();
+    for (size_t ii = 0; ii < m; ++ii)
+      for (size_t jj = 0; jj < m; ++jj) {
+        jacobian_in_in[ii][jj] = dg_du_[ii][jj] * h_intersection * hinv_inside_element;
+        jacobian_in_out[ii][jj] = dg_dv_[ii][jj] * h_intersection * hinv_inside_element;
+        jacobian_out_in[ii][jj] = -dg_du_[ii][jj] * h_intersection * hinv_outside_element;
+        jacobian_out_out[ii][jj] = -dg_dv_[ii][jj] * h_intersection * hinv_outside_element;
+      }
+  } // ... jacobian(...)
+
 protected:
   void post_bind(const I& inter) override
   {
@@ -176,6 +222,8 @@ private:
   mutable DynamicStateType u_;
   mutable DynamicStateType v_;
   mutable DynamicStateType g_;
+  mutable DynamicMatrix<RR> dg_du_;
+  mutable DynamicMatrix<RR> dg_dv_;
 }; // class LocalAdvectionFvCouplingOperator
 
 template <class I,
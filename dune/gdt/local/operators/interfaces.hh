@@ -29,6 +29,7 @@
 #include <dune/xt/grid/type_traits.hh>
 #include <dune/xt/grid/bound-object.hh>
 
+#include <dune/gdt/exceptions.hh>
 #include <dune/gdt/local/discretefunction.hh>
 #include <dune/gdt/discretefunction/default.hh>
 
@@ -137,6 +138,27 @@ public:
 
   virtual void apply(LocalRangeType& local_range, const XT::Common::Parameter& param = {}) const = 0;
 
+  /// \brief Whether jacobian() is implemented for discrete sources from source_space.
+  virtual bool provides_jacobian(const SourceSpaceType& /*source_space*/) const
+  {
+    return false;
+  }
+
+  /**
+   * \brief Computes the derivatives of the local DoFs added by apply() w.r.t. the local DoFs of the (discrete) source,
+   *        local_jacobian[ii][jj] = d local_range.dofs()[ii] / d local_source.dofs()[jj], in one pass.
+   *
+   * \note Presumes that provides_jacobian() is true for the space of the source, that local_range is bound like in
+   *       apply() and that local_jacobian is at least of size local_range.dofs().size() x local_source.dofs().size().
+   * \sa   LocalElementOperatorFiniteDifferenceJacobianAssembler
+   **/
+  virtual void jacobian(const LocalRangeType& /*local_range*/,
+                        DynamicMatrix<RR>& /*local_jacobian*/,
+                        const XT::Common::Parameter& /*param*/ = {}) const
+  {
+    DUNE_THROW(Exceptions::operator_error, "This local operator does not provide a jacobian!");
+  }
+
   virtual std::unique_ptr<ThisType> with_source(const SourceType& src) const
   {
     auto ret = copy();
@@ -287,6 +309,33 @@ public:
                      LocalOutsideRangeType& local_range_outside,
                      const XT::Common::Parameter& param = {}) const = 0;
 
+  /// \brief Whether jacobian() is implemented for discrete sources from source_space.
+  virtual bool provides_jacobian(const SourceSpaceType& /*source_space*/) const
+  {
+    return false;
+  }
+
+  /**
+   * \brief Computes the derivatives of the local DoFs added by apply() w.r.t. the inside and outside local DoFs of the
+   *        (discrete) source in one pass, e.g. jacobian_in_out[ii][jj] = d local_range_inside.dofs()[ii] / d (outside
+   *        local source DoF jj).
+   *
+   * \note Presumes that provides_jacobian() is true for the space of the source, that the local ranges are bound like
+   *       in apply() and that the local jacobians are large enough. Only jacobian_in_in is touched if the intersection
+   *       has no neighbor.
+   * \sa   LocalIntersectionOperatorFiniteDifferenceJacobianAssembler
+   **/
+  virtual void jacobian(const LocalInsideRangeType& /*local_range_inside*/,
+                        const LocalOutsideRangeType& /*local_range_outside*/,
+                        DynamicMatrix<RF>& /*jacobian_in_in*/,
+                        DynamicMatrix<RF>& /*jacobian_in_out*/,
+                        DynamicMatrix<RF>& /*jacobian_out_in*/,
+                        DynamicMatrix<RF>& /*jacobian_out_out*/,
+                        const XT::Common::Parameter& /*param*/ = {}) const
+  {
+    DUNE_THROW(Exceptions::operator_error, "This local operator does not provide a jacobian!");
+  }
+
   virtual std::unique_ptr<ThisType> with_source(const SourceType& src) const
   {
     auto ret = copy();
@@ -165,6 +165,20 @@ public:
   } // ... assemble(...)
 
   /// \}
+
+  /**
+   * \brief Stores the local mass matrices of affine elements as scaled reference matrices, which saves most of their
+   *        memory, see LocalMassMatrixProvider for the requirements on the range space.
+   */
+  ThisType& compress_local_mass_matrices(const bool compressed = true)
+  {
+    if (compressed != local_mass_matrix_provider_.compressed()) {
+      local_mass_matrix_provider_.compress(compressed);
+      this->requires_assembly_ = true;
+    }
+    return *this;
+  }
+
   /// \name These methods can be used to define non-periodic boundary treatment
   /// \{
 
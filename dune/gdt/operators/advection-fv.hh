@@ -16,8 +16,20 @@
 #ifndef DUNE_GDT_OPERATORS_ADVECTION_FV_HH
 #define DUNE_GDT_OPERATORS_ADVECTION_FV_HH
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <dune/grid/common/partitionset.hh>
+#include <dune/grid/common/rangegenerators.hh>
 
+#include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/parallel/conflict-free-scope.hh>
+#include <dune/xt/common/parallel/threadmanager.hh>
 #include <dune/xt/common/type_traits.hh>
 #include <dune/xt/grid/type_traits.hh>
 #include <dune/xt/grid/filters.hh>
@@ -25,6 +37,7 @@
 
 #include <dune/gdt/local/assembler/operator-fd-jacobian-assemblers.hh>
 #include <dune/gdt/local/operators/advection-fv.hh>
+#include <dune/gdt/tools/finite-volume-face-table.hh>
 
 #include "interfaces.hh"
 #include "operator.hh"
@@ -36,6 +49,8 @@ namespace GDT {
 /**
  * \attention This operator will not work on a grid view with hanging nodes.
  *
+ * \sa use_face_table() for a streaming variant of apply(source_vector, range_vector).
+ *
  * \todo Refactor the coupling op as in the DG case to be applied on each side individually.
  *
  * \note See OperatorInterface for a description of the template arguments.
@@ -70,6 +85,7 @@ public:
   using typename BaseType::RangeSpaceType;
   using typename BaseType::SourceSpaceType;
   using typename BaseType::VectorType;
+  using FaceTableType = FiniteVolumeFaceTable<AGV>;
 
   AdvectionFvOperator(
       const AGV& assembly_grid_view,
@@ -87,6 +103,10 @@ public:
                logging_state)
     , numerical_flux_(numerical_flux.copy())
     , periodicity_exception_(periodicity_exception.copy())
+    , boundary_treatments_(assembly_grid_view, source_space, range_space)
+    , use_face_table_(false)
+    , face_table_mutex_(std::make_unique<std::mutex>())
+    , face_table_unavailable_(false)
   {
     // contributions from inner intersections
     *this += {LocalAdvectionFvCouplingOperator<I, V, AGV, m, F, F, RGV, V>(*numerical_flux_),
@@ -100,9 +120,105 @@ public:
     : BaseType(std::move(source))
     , numerical_flux_(std::move(source.numerical_flux_))
     , periodicity_exception_(std::move(source.periodicity_exception_))
+    , boundary_treatments_(std::move(source.boundary_treatments_))
+    , use_face_table_(source.use_face_table_)
+    , face_table_mutex_(std::move(source.face_table_mutex_))
+    , face_table_unavailable_(source.face_table_unavailable_)
+    , face_table_(std::move(source.face_table_))
+    , face_table_chunks_(std::move(source.face_table_chunks_))
+    , face_fluxes_(std::move(source.face_fluxes_))
   {
   }
 
+  /**
+   * \brief Enables (or disables) the face table variant of apply(source_vector, range_vector).
+   *
+   * If enabled, the contributions of the inner and periodic intersections are computed from a FiniteVolumeFaceTable
+   * (created in the first apply and reused afterwards): the numerical flux is evaluated on all faces in parallel by an
+   * index-based gather from the source vector, storing the fluxes in a contiguous array, which is then gathered (again
+   * in parallel) cell by cell. Boundary treatments are applied as usual. This requires
+   * - a numerical flux which does not depend on the intersection, \sa NumericalFluxInterface::intersection_dependent,
+   * - finite volume source and range spaces numbering their DoFs like the index set numbers the elements,
+   * - that no other local operators were appended,
+   * otherwise the default apply is used.
+   *
+   * \note As for the execution plan, call reset_execution_plan() after the grid changed.
+   */
+  ThisType& use_face_table(const bool enable = true)
+  {
+    use_face_table_ = enable;
+    return *this;
+  }
+
+  using BaseType::apply;
+
+  void apply(const VectorType& source_vector,
+             VectorType& range_vector,
+             const XT::Common::Parameter& param = {}) const override
+  {
+    std::unique_lock<std::mutex> lock(*face_table_mutex_, std::try_to_lock);
+    // concurrent calls may not share the face table
+    if (!use_face_table_ || !lock.owns_lock() || !prepare_face_table()) {
+      BaseType::apply(source_vector, range_vector, param);
+      return;
+    }
+    this->assert_matching_source(source_vector);
+    this->assert_matching_range(range_vector);
+    LOG_(debug) << "apply(source_vector.sup_norm()=" << source_vector.sup_norm()
+                << ", range_vector.sup_norm()=" << range_vector.sup_norm() << ", param=" << print(param)
+                << ") using the face table" << std::endl;
+    if (boundary_treatments_.intersection_data().size() > 0)
+      boundary_treatments_.apply(source_vector, range_vector, param);
+    else
+      range_vector.set_all(0);
+    const auto& table = *face_table_;
+    // evaluate the numerical flux on all faces, ...
+    const typename NumericalFluxType::LocalIntersectionCoords x_in_intersection_coords(0.);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, face_table_chunks_.size()),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        for (size_t cc = range.begin(); cc != range.end(); ++cc) {
+                          auto& chunk = face_table_chunks_[cc];
+                          for (size_t ff = chunk.first_face; ff < chunk.last_face; ++ff) {
+                            const size_t inside_dofs = table.inside_cells()[ff] * m;
+                            const size_t outside_dofs = table.outside_cells()[ff] * m;
+                            for (size_t ii = 0; ii < m; ++ii) {
+                              chunk.u[ii] = source_vector.get_entry(inside_dofs + ii);
+                              chunk.v[ii] = source_vector.get_entry(outside_dofs + ii);
+                            }
+                            chunk.numerical_flux->apply(
+                                x_in_intersection_coords, chunk.u, chunk.v, table.unit_normals()[ff], chunk.g, param);
+                            for (size_t ii = 0; ii < m; ++ii)
+                              face_fluxes_[ff * m + ii] = chunk.g[ii];
+                          }
+                        }
+                      });
+    // ... and gather them cell by cell (each thread writes distinct DoFs, so we may skip the locks)
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, table.num_cells()), [&](const tbb::blocked_range<size_t>& range) {
+      [[maybe_unused]] const XT::Common::ConflictFreeScope conflict_free_scope;
+      const auto& offsets = table.cell_face_offsets();
+      const auto& faces = table.cell_faces();
+      const auto& weights = table.cell_face_weights();
+      for (size_t cc = range.begin(); cc != range.end(); ++cc)
+        for (size_t ii = 0; ii < m; ++ii) {
+          F update = 0.;
+          for (size_t kk = offsets[cc]; kk < offsets[cc + 1]; ++kk)
+            update += weights[kk] * face_fluxes_[faces[kk] * m + ii];
+          range_vector.add_to_entry(cc * m + ii, update);
+        }
+    });
+  } // ... apply(...)
+
+  /// \brief Drops the execution plan and the face table, required after the grid changed.
+  void reset_execution_plan()
+  {
+    BaseType::reset_execution_plan();
+    boundary_treatments_.reset_execution_plan();
+    const std::lock_guard<std::mutex> lock(*face_table_mutex_);
+    face_table_.reset();
+    face_table_chunks_.clear();
+    face_table_unavailable_ = false;
+  }
+
   /// \name These methods can be used to define non-periodic boundary treatment
   /// \{
 
@@ -114,6 +230,9 @@ public:
     *this += {BoundaryTreatmentByCustomNumericalFluxOperatorType(numerical_boundary_treatment_flux,
                                                                  boundary_treatment_parameter_type),
               filter};
+    boundary_treatments_ += {BoundaryTreatmentByCustomNumericalFluxOperatorType(numerical_boundary_treatment_flux,
+                                                                                boundary_treatment_parameter_type),
+                             filter};
     return *this;
   }
 
@@ -125,6 +244,9 @@ public:
     *this += {BoundaryTreatmentByCustomExtrapolationOperatorType(
                   *numerical_flux_, extrapolation, extrapolation_parameter_type),
               filter};
+    boundary_treatments_ += {BoundaryTreatmentByCustomExtrapolationOperatorType(
+                                 *numerical_flux_, extrapolation, extrapolation_parameter_type),
+                             filter};
     return *this;
   }
 
@@ -136,8 +258,81 @@ public:
   /// \}
 
 private:
+  struct FaceTableChunk
+  {
+    size_t first_face;
+    size_t last_face;
+    std::unique_ptr<NumericalFluxType> numerical_flux;
+    typename NumericalFluxType::DynamicStateType u;
+    typename NumericalFluxType::DynamicStateType v;
+    typename NumericalFluxType::DynamicStateType g;
+  };
+
+  // creates the face table if required, returns false if it can not be used
+  bool prepare_face_table() const
+  {
+    // the coupling operators from the constructor are the only local operators apart from the boundary treatments
+    if (this->element_data_.size() != boundary_treatments_.element_data().size()
+        || this->intersection_data_.size() != 2 + boundary_treatments_.intersection_data().size())
+      return false;
+    if (face_table_ && face_table_->valid(this->assembly_grid_view_))
+      return true;
+    face_table_.reset();
+    face_table_chunks_.clear();
+    if (face_table_unavailable_ || numerical_flux_->intersection_dependent()
+        || this->source_space_.type() != SpaceType::finite_volume
+        || this->range_space_.type() != SpaceType::finite_volume)
+      return false;
+    const auto& index_set = this->assembly_grid_view_.indexSet();
+    for (auto&& element : elements(this->assembly_grid_view_)) {
+      const size_t first_dof = index_set.index(element) * m;
+      if (this->source_space_.mapper().global_index(element, 0) != first_dof
+          || this->range_space_.mapper().global_index(element, 0) != first_dof) {
+        face_table_unavailable_ = true;
+        return false;
+      }
+    }
+    LOG_(info) << "creating face table ..." << std::endl;
+    // the same intersections as the coupling operators from the constructor
+    const auto filter = XT::Grid::ApplyOn::InnerIntersectionsOnce<AGV>()
+                        || (XT::Grid::ApplyOn::PeriodicBoundaryIntersectionsOnce<AGV>() && !(*periodicity_exception_));
+    face_table_ = std::make_unique<FaceTableType>(this->assembly_grid_view_, *filter);
+    face_fluxes_.resize(face_table_->num_faces() * m);
+    // one numerical flux per chunk, bound once to any of the faces
+    const size_t num_faces = face_table_->num_faces();
+    const size_t num_chunks =
+        std::min(num_faces,
+                 size_t(DXTC_CONFIG_GET("threading.partition_factor", 1u))
+                     * std::max(size_t(1), size_t(XT::Common::threadManager().current_threads())));
+    for (auto&& element : elements(this->assembly_grid_view_)) {
+      for (auto&& intersection : intersections(this->assembly_grid_view_, element)) {
+        if (num_chunks == 0 || !intersection.neighbor() || !filter->contains(this->assembly_grid_view_, intersection))
+          continue;
+        for (size_t cc = 0; cc < num_chunks; ++cc) {
+          FaceTableChunk chunk{(cc * num_faces) / num_chunks,
+                               ((cc + 1) * num_faces) / num_chunks,
+                               numerical_flux_->copy(),
+                               typename NumericalFluxType::DynamicStateType(m, 0.),
+                               typename NumericalFluxType::DynamicStateType(m, 0.),
+                               typename NumericalFluxType::DynamicStateType(m, 0.)};
+          chunk.numerical_flux->bind(intersection);
+          face_table_chunks_.emplace_back(std::move(chunk));
+        }
+        return true;
+      }
+    }
+    return true; // no faces at all
+  } // ... prepare_face_table(...)
+
   std::unique_ptr<const NumericalFluxType> numerical_flux_;
   std::unique_ptr<XT::Grid::IntersectionFilter<AGV>> periodicity_exception_;
+  BaseType boundary_treatments_;
+  bool use_face_table_;
+  std::unique_ptr<std::mutex> face_table_mutex_;
+  mutable bool face_table_unavailable_;
+  mutable std::unique_ptr<FaceTableType> face_table_;
+  mutable std::vector<FaceTableChunk> face_table_chunks_;
+  mutable std::vector<F> face_fluxes_;
 }; // class AdvectionFvOperator
 
 
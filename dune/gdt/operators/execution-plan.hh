@@ -0,0 +1,236 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+/**
+ * \file  execution-plan.hh
+ * \brief Traversal data and bound local operators, kept to repeatedly apply an Operator without a Walker.
+ **/
+#ifndef DUNE_GDT_OPERATORS_EXECUTION_PLAN_HH
+#define DUNE_GDT_OPERATORS_EXECUTION_PLAN_HH
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/parameter.hh>
+#include <dune/xt/common/parallel/threadmanager.hh>
+#include <dune/xt/grid/type_traits.hh>
+
+namespace Dune {
+namespace GDT {
+
+
+/**
+ * \brief Everything required to repeatedly apply the local operators of an Operator to source vectors.
+ *
+ * When applying an Operator via an XT::Grid::Walker and a ForwardOperatorAssembler, all local operators are copied
+ * and bound to the source, the grid view is partitioned and the filters are evaluated for each element and
+ * intersection, in each call to apply(). When the same operator is applied once per stage of every time step (as in
+ * explicit time stepping), this overhead dominates for cheap local operators (e.g., finite volume fluxes). The plan
+ * instead does all of this once:
+ * - it stores all elements with a contribution, their intersections with a contribution and the outside elements of
+ *   these intersections in traversal order, together with the indices of the local operators to apply to them;
+ * - it binds the local operators to a discrete source function on a DoF vector owned by the plan.
+ * Each apply() thus amounts to copying the source vector, one (parallel) loop over the chunks and copying the result,
+ * where the elements are split into contiguous chunks, each holding its own copies of the local operators and its own
+ * local range functions. The chunks are only recreated if the number of threads changed since the last apply().
+ *
+ * \note The filters are only evaluated once, when creating the plan, which is thus only valid for the grid view it was
+ *       created for and has to be recreated after the grid changed, \sa valid().
+ * \note Not thread-safe, apply() must not be called concurrently.
+ * \note Like the ForwardOperatorAssembler, we use duck-typing for the Operator.
+ */
+template <class OperatorType>
+class OperatorExecutionPlan
+{
+  using AGV = typename OperatorType::AGV;
+  using E = XT::Grid::extract_entity_t<AGV>;
+  using I = XT::Grid::extract_intersection_t<AGV>;
+  using VectorType = typename OperatorType::VectorType;
+  using ConstDiscreteSourceFunctionType = typename OperatorType::ConstDiscreteSourceFunctionType;
+  using DiscreteRangeFunctionType = typename OperatorType::DiscreteRangeFunctionType;
+  using LocalRangeType = typename DiscreteRangeFunctionType::LocalDiscreteFunctionType;
+  using LocalElementOperatorType = typename OperatorType::LocalElementOperatorType;
+  using LocalIntersectionOperatorType = typename OperatorType::LocalIntersectionOperatorType;
+
+  // the local operators to apply are given by [first_operator, last_operator) in element_operator_indices_, the
+  // intersections by [first_intersection, last_intersection) in intersections_
+  struct ElementData
+  {
+    E element;
+    size_t first_operator;
+    size_t last_operator;
+    size_t first_intersection;
+    size_t last_intersection;
+  };
+
+  // the local operators to apply are given by [first_operator, last_operator) in intersection_operator_indices_
+  struct IntersectionData
+  {
+    I intersection;
+    E outside_element;
+    size_t first_operator;
+    size_t last_operator;
+  };
+
+  struct Chunk
+  {
+    size_t first_element;
+    size_t last_element;
+    std::vector<std::unique_ptr<LocalElementOperatorType>> element_operators;
+    std::vector<std::unique_ptr<LocalIntersectionOperatorType>> intersection_operators;
+    std::unique_ptr<LocalRangeType> local_range_inside;
+    std::unique_ptr<LocalRangeType> local_range_outside;
+  };
+
+public:
+  explicit OperatorExecutionPlan(const OperatorType& oprtr)
+    : grid_view_(oprtr.assembly_grid_view())
+    , num_grid_elements_(grid_view_.indexSet().size(0))
+    , source_vector_(oprtr.source_space().mapper().size(), 0.)
+    , source_function_(oprtr.source_space(), source_vector_)
+    , range_vector_(oprtr.range_space().mapper().size(), 0.)
+    , range_function_(oprtr.range_space(), range_vector_)
+  {
+    const auto& element_data = oprtr.element_data();
+    const auto& intersection_data = oprtr.intersection_data();
+    // collect the traversal order and evaluate the filters
+    for (auto&& element : elements(grid_view_)) {
+      ElementData data{element, element_operator_indices_.size(), 0, intersections_.size(), 0};
+      size_t kk = 0;
+      for (const auto& local_operator__filter : element_data) {
+        if (local_operator__filter.second->contains(grid_view_, element))
+          element_operator_indices_.push_back(kk);
+        ++kk;
+      }
+      data.last_operator = element_operator_indices_.size();
+      if (intersection_data.size() > 0) {
+        for (auto&& intersection : intersections(grid_view_, element)) {
+          const size_t first_operator = intersection_operator_indices_.size();
+          kk = 0;
+          for (const auto& local_operator__filter : intersection_data) {
+            if (local_operator__filter.second->contains(grid_view_, intersection))
+              intersection_operator_indices_.push_back(kk);
+            ++kk;
+          }
+          if (intersection_operator_indices_.size() > first_operator)
+            intersections_.push_back({intersection,
+                                      intersection.neighbor() ? intersection.outside() : element,
+                                      first_operator,
+                                      intersection_operator_indices_.size()});
+        }
+      }
+      data.last_intersection = intersections_.size();
+      if (data.last_operator > data.first_operator || data.last_intersection > data.first_intersection)
+        elements_.push_back(std::move(data));
+    }
+    // bind the local operators to the source, the chunks copy these
+    for (const auto& local_operator__filter : element_data)
+      element_operators_.emplace_back(local_operator__filter.first->with_source(source_function_));
+    for (const auto& local_operator__filter : intersection_data)
+      intersection_operators_.emplace_back(local_operator__filter.first->with_source(source_function_));
+  } // OperatorExecutionPlan(...)
+
+  OperatorExecutionPlan(const OperatorExecutionPlan&) = delete;
+  OperatorExecutionPlan(OperatorExecutionPlan&&) = delete;
+
+  /// \brief Cheap check whether the grid view (still) has as many elements as when creating the plan.
+  bool valid() const
+  {
+    return grid_view_.indexSet().size(0) == num_grid_elements_;
+  }
+
+  /// \brief Same as ForwardOperatorAssembler with a Walker, i.e. range_vector is overwritten.
+  void apply(const VectorType& source_vector, VectorType& range_vector, const XT::Common::Parameter& param)
+  {
+    const size_t num_chunks =
+        std::min(elements_.size(),
+                 size_t(DXTC_CONFIG_GET("threading.partition_factor", 1u))
+                     * std::max(size_t(1), size_t(XT::Common::threadManager().current_threads())));
+    if (num_chunks != chunks_.size())
+      partition(num_chunks);
+    source_vector_ = source_vector;
+    range_vector_.set_all(0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks_.size()), [&](const tbb::blocked_range<size_t>& range) {
+      for (size_t cc = range.begin(); cc != range.end(); ++cc)
+        apply(chunks_[cc], param);
+    });
+    range_vector = range_vector_;
+  } // ... apply(...)
+
+private:
+  // splits the elements into num_chunks contiguous chunks with their own local operators
+  void partition(const size_t num_chunks)
+  {
+    chunks_.clear();
+    for (size_t cc = 0; cc < num_chunks; ++cc) {
+      Chunk chunk;
+      chunk.first_element = (cc * elements_.size()) / num_chunks;
+      chunk.last_element = ((cc + 1) * elements_.size()) / num_chunks;
+      for (const auto& local_operator : element_operators_)
+        chunk.element_operators.emplace_back(local_operator->copy());
+      for (const auto& local_operator : intersection_operators_)
+        chunk.intersection_operators.emplace_back(local_operator->copy());
+      chunk.local_range_inside = range_function_.local_discrete_function();
+      chunk.local_range_outside = range_function_.local_discrete_function();
+      chunks_.emplace_back(std::move(chunk));
+    }
+  } // ... partition(...)
+
+  void apply(Chunk& chunk, const XT::Common::Parameter& param) const
+  {
+    auto& local_range_inside = *chunk.local_range_inside;
+    auto& local_range_outside = *chunk.local_range_outside;
+    for (size_t ee = chunk.first_element; ee < chunk.last_element; ++ee) {
+      const auto& element_data = elements_[ee];
+      const auto& element = element_data.element;
+      local_range_inside.bind(element);
+      for (size_t kk = element_data.first_operator; kk < element_data.last_operator; ++kk) {
+        auto& local_operator = *chunk.element_operators[element_operator_indices_[kk]];
+        local_operator.bind(element);
+        local_operator.apply(local_range_inside, param);
+      }
+      for (size_t ii = element_data.first_intersection; ii < element_data.last_intersection; ++ii) {
+        const auto& intersection_data = intersections_[ii];
+        local_range_outside.bind(intersection_data.outside_element);
+        for (size_t kk = intersection_data.first_operator; kk < intersection_data.last_operator; ++kk) {
+          auto& local_operator = *chunk.intersection_operators[intersection_operator_indices_[kk]];
+          local_operator.bind(intersection_data.intersection);
+          local_operator.apply(local_range_inside, local_range_outside, param);
+        }
+      }
+    }
+  } // ... apply(...)
+
+  const AGV grid_view_;
+  const size_t num_grid_elements_;
+  VectorType source_vector_;
+  const ConstDiscreteSourceFunctionType source_function_;
+  VectorType range_vector_;
+  DiscreteRangeFunctionType range_function_;
+  std::vector<ElementData> elements_;
+  std::vector<size_t> element_operator_indices_;
+  std::vector<IntersectionData> intersections_;
+  std::vector<size_t> intersection_operator_indices_;
+  std::vector<std::unique_ptr<LocalElementOperatorType>> element_operators_;
+  std::vector<std::unique_ptr<LocalIntersectionOperatorType>> intersection_operators_;
+  std::vector<Chunk> chunks_;
+}; // class OperatorExecutionPlan
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_OPERATORS_EXECUTION_PLAN_HH
@@ -0,0 +1,531 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/**
+ * \file  matrix-free.hh
+ * \brief Linear operator induced by a BilinearForm, applied without assembling a matrix (MatrixFreeOperator).
+ **/
+#ifndef DUNE_GDT_OPERATORS_MATRIX_FREE_HH
+#define DUNE_GDT_OPERATORS_MATRIX_FREE_HH
+
+#include <cassert>
+#include <memory>
+
+#include <dune/common/dynmatrix.hh>
+#include <dune/common/dynvector.hh>
+
+#include <dune/xt/grid/functors/interfaces.hh>
+#include <dune/xt/grid/parallel/partitioning/colored.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/walker.hh>
+#include <dune/xt/la/container.hh>
+
+#include <dune/gdt/exceptions.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/interfaces.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/print.hh>
+#include <dune/gdt/spaces/interface.hh>
+
+namespace Dune {
+namespace GDT {
+
+
+/**
+ * \brief Grid functor adding the application of the operator induced by a BilinearForm to source to range, local
+ *        matrix by local matrix.
+ *
+ * On each intersection, the local bilinear forms are applied to the local bases and the resulting local matrices are
+ * multiplied with the local source DoFs, the products are then added to the range DoFs. On each element, the local
+ * bilinear forms are applied to the local source DoFs directly (which is sum-factorized on cubes, if possible, see
+ * LocalElementIntegralBilinearForm). The global matrix is never formed.
+ *
+ * Each element writes the range DoFs of itself and, on intersections, of its neighbor. Applying this functor
+ * concurrently is thus only free of write conflicts when walking the grid with Walker::walk_colored() (with a coloring
+ * including face neighbors, if the bilinear form contains intersection contributions), as done in
+ * MatrixFreeOperator::apply(). Otherwise, the locks of the range vector have to be relied on.
+ *
+ * \note In apply_local, the filters are evaluated w.r.t. bilinear_form_.assembly_grid_view(), as in the
+ *       BilinearFormAssembler.
+ */
+template <class AGV,
+          size_t s_r = 1,
+          size_t s_rC = 1,
+          size_t r_r = s_r,
+          size_t r_rC = s_rC,
+          class F = double,
+          class V = XT::LA::IstlDenseVector<F>,
+          class SGV = AGV,
+          class RGV = AGV>
+class MatrixFreeOperatorApplicator : public XT::Grid::ElementAndIntersectionFunctor<AGV>
+{
+  static_assert(XT::LA::is_vector<V>::value, "");
+
+  using ThisType = MatrixFreeOperatorApplicator;
+  using BaseType = XT::Grid::ElementAndIntersectionFunctor<AGV>;
+
+public:
+  using typename BaseType::E;
+  using typename BaseType::I;
+  using BilinearFormType = BilinearForm<AGV, s_r, s_rC, r_r, r_rC, F, SGV, RGV>;
+  using SourceSpaceType = SpaceInterface<SGV, s_r, s_rC, F>;
+  using RangeSpaceType = SpaceInterface<RGV, r_r, r_rC, F>;
+  using VectorType = V;
+
+  MatrixFreeOperatorApplicator(const BilinearFormType& bilinear_form,
+                               const SourceSpaceType& source_space,
+                               const RangeSpaceType& range_space,
+                               const VectorType& source,
+                               VectorType& range,
+                               const XT::Common::Parameter& param = {},
+                               const std::string& logging_prefix = "",
+                               const std::array<bool, 3>& logging_state = XT::Common::default_logger_state())
+    : BaseType(logging_prefix.empty() ? "MatrixFreeOperatorApplicator" : logging_prefix, logging_state)
+    , bilinear_form_(bilinear_form)
+    , source_space_(source_space)
+    , range_space_(range_space)
+    , source_(source)
+    , range_(range)
+    , param_(param)
+    , source_basis_in_(source_space_.basis().localize())
+    , source_basis_out_(source_space_.basis().localize())
+    , range_basis_in_(range_space_.basis().localize())
+    , range_basis_out_(range_space_.basis().localize())
+    , source_indices_in_(source_space_.mapper().max_local_size())
+    , source_indices_out_(source_space_.mapper().max_local_size())
+    , range_indices_in_(range_space_.mapper().max_local_size())
+    , range_indices_out_(range_space_.mapper().max_local_size())
+    , local_source_in_(source_space_.mapper().max_local_size(), 0.)
+    , local_source_out_(source_space_.mapper().max_local_size(), 0.)
+    , local_range_in_(range_space_.mapper().max_local_size(), 0.)
+    , local_range_out_(range_space_.mapper().max_local_size(), 0.)
+    , local_product_(range_space_.mapper().max_local_size(), 0.)
+    , local_matrix_in_in_(range_space_.mapper().max_local_size(), source_space_.mapper().max_local_size(), 0.)
+    , local_matrix_in_out_(range_space_.mapper().max_local_size(), source_space_.mapper().max_local_size(), 0.)
+    , local_matrix_out_in_(range_space_.mapper().max_local_size(), source_space_.mapper().max_local_size(), 0.)
+    , local_matrix_out_out_(range_space_.mapper().max_local_size(), source_space_.mapper().max_local_size(), 0.)
+  {
+  }
+
+  /// \note Each copy holds its own copies of the local bilinear forms, local bases and local buffers.
+  MatrixFreeOperatorApplicator(const ThisType& other)
+    : MatrixFreeOperatorApplicator(other.bilinear_form_,
+                                   other.source_space_,
+                                   other.range_space_,
+                                   other.source_,
+                                   other.range_,
+                                   other.param_,
+                                   other.logger.prefix,
+                                   other.logger.state)
+  {
+  }
+
+  MatrixFreeOperatorApplicator(ThisType&& source) noexcept = default;
+
+  /// \name Required by ElementAndIntersectionFunctor.
+  /// \{
+
+  BaseType* copy() override final
+  {
+    return new ThisType(*this);
+  }
+
+  void apply_local(const E& element) override final
+  {
+    bool bound = false;
+    for (const auto& data : bilinear_form_.element_data()) {
+      const auto& local_bilinear_form = *std::get<0>(data);
+      const auto& filter = *std::get<1>(data);
+      if (!filter.contains(bilinear_form_.assembly_grid_view(), element))
+        continue;
+      if (!bound) {
+        bind(element, *source_basis_in_, *range_basis_in_, source_indices_in_, range_indices_in_, local_source_in_);
+        clear(local_range_in_, *range_basis_in_);
+        bound = true;
+      }
+      // does not necessarily form the local matrix (see LocalElementIntegralBilinearForm)
+      local_bilinear_form.apply(*range_basis_in_, *source_basis_in_, local_source_in_, local_product_, param_);
+      for (size_t ii = 0; ii < range_basis_in_->size(param_); ++ii)
+        local_range_in_[ii] += local_product_[ii];
+    }
+    if (bound)
+      scatter(local_range_in_, range_indices_in_, *range_basis_in_);
+  } // ... apply_local(...)
+
+  /// \attention As in the BilinearFormAssembler, neither intersection.neighbor() nor the validity of outside_element are
+  ///            checked, the filters of the coupling intersection bilinear forms have to take care of that!
+  void apply_local(const I& intersection, const E& inside_element, const E& outside_element) override final
+  {
+    bool bound = false;
+    const auto bind_both_sides = [&]() {
+      if (bound)
+        return;
+      bind(inside_element, *source_basis_in_, *range_basis_in_, source_indices_in_, range_indices_in_, local_source_in_);
+      bind(outside_element,
+           *source_basis_out_,
+           *range_basis_out_,
+           source_indices_out_,
+           range_indices_out_,
+           local_source_out_);
+      clear(local_range_in_, *range_basis_in_);
+      clear(local_range_out_, *range_basis_out_);
+      bound = true;
+    };
+    for (const auto& data : bilinear_form_.coupling_intersection_data()) {
+      const auto& local_bilinear_form = *std::get<0>(data);
+      const auto& filter = *std::get<1>(data);
+      if (!filter.contains(bilinear_form_.assembly_grid_view(), intersection))
+        continue;
+      bind_both_sides();
+      local_bilinear_form.apply2(intersection,
+                                 *range_basis_in_,
+                                 *source_basis_in_,
+                                 *range_basis_out_,
+                                 *source_basis_out_,
+                                 local_matrix_in_in_,
+                                 local_matrix_in_out_,
+                                 local_matrix_out_in_,
+                                 local_matrix_out_out_,
+                                 param_);
+      add_mv(local_matrix_in_in_, local_source_in_, local_range_in_, *range_basis_in_, *source_basis_in_);
+      add_mv(local_matrix_in_out_, local_source_out_, local_range_in_, *range_basis_in_, *source_basis_out_);
+      add_mv(local_matrix_out_in_, local_source_in_, local_range_out_, *range_basis_out_, *source_basis_in_);
+      add_mv(local_matrix_out_out_, local_source_out_, local_range_out_, *range_basis_out_, *source_basis_out_);
+    }
+    for (const auto& data : bilinear_form_.intersection_data()) {
+      const auto& local_bilinear_form = *std::get<0>(data);
+      const auto& filter = *std::get<1>(data);
+      if (!filter.contains(bilinear_form_.assembly_grid_view(), intersection))
+        continue;
+      bind_both_sides();
+      // it does not matter which of the tmp matrices we pick here
+      if (local_bilinear_form.inside()) {
+        local_bilinear_form.apply2(intersection, *range_basis_in_, *source_basis_in_, local_matrix_in_in_, param_);
+        add_mv(local_matrix_in_in_, local_source_in_, local_range_in_, *range_basis_in_, *source_basis_in_);
+      } else {
+        local_bilinear_form.apply2(intersection, *range_basis_out_, *source_basis_out_, local_matrix_out_out_, param_);
+        add_mv(local_matrix_out_out_, local_source_out_, local_range_out_, *range_basis_out_, *source_basis_out_);
+      }
+    }
+    if (bound) {
+      scatter(local_range_in_, range_indices_in_, *range_basis_in_);
+      scatter(local_range_out_, range_indices_out_, *range_basis_out_);
+    }
+  } // ... apply_local(...)
+
+  /// \}
+
+private:
+  template <class SourceBasisType, class RangeBasisType>
+  void bind(const E& element,
+            SourceBasisType& source_basis,
+            RangeBasisType& range_basis,
+            DynamicVector<size_t>& source_indices,
+            DynamicVector<size_t>& range_indices,
+            DynamicVector<F>& local_source)
+  {
+    source_basis.bind(element);
+    range_basis.bind(element);
+    source_space_.mapper().global_indices(element, source_indices);
+    range_space_.mapper().global_indices(element, range_indices);
+    const size_t source_size = source_basis.size(param_);
+    if (local_source.size() < source_size)
+      local_source.resize(source_size);
+    for (size_t jj = 0; jj < source_size; ++jj)
+      local_source[jj] = source_.get_entry(source_indices[jj]);
+  } // ... bind(...)
+
+  template <class RangeBasisType>
+  void clear(DynamicVector<F>& local_range, const RangeBasisType& range_basis) const
+  {
+    const size_t range_size = range_basis.size(param_);
+    if (local_range.size() < range_size)
+      local_range.resize(range_size);
+    for (size_t ii = 0; ii < range_size; ++ii)
+      local_range[ii] = 0.;
+  }
+
+  // local_range += local_matrix * local_source, restricted to the sizes of the bound bases
+  template <class RangeBasisType, class SourceBasisType>
+  void add_mv(const DynamicMatrix<F>& local_matrix,
+              const DynamicVector<F>& local_source,
+              DynamicVector<F>& local_range,
+              const RangeBasisType& range_basis,
+              const SourceBasisType& source_basis) const
+  {
+    const size_t rows = range_basis.size(param_);
+    const size_t cols = source_basis.size(param_);
+    assert(local_matrix.rows() >= rows && local_matrix.cols() >= cols);
+    for (size_t ii = 0; ii < rows; ++ii) {
+      const auto& row = local_matrix[ii];
+      F value = 0.;
+      for (size_t jj = 0; jj < cols; ++jj)
+        value += row[jj] * local_source[jj];
+      local_range[ii] += value;
+    }
+  } // ... add_mv(...)
+
+  template <class RangeBasisType>
+  void scatter(const DynamicVector<F>& local_range,
+               const DynamicVector<size_t>& range_indices,
+               const RangeBasisType& range_basis)
+  {
+    const size_t range_size = range_basis.size(param_);
+    for (size_t ii = 0; ii < range_size; ++ii)
+      range_.add_to_entry(range_indices[ii], local_range[ii]);
+  }
+
+  const BilinearFormType bilinear_form_;
+  const SourceSpaceType& source_space_;
+  const RangeSpaceType& range_space_;
+  const VectorType& source_;
+  VectorType& range_;
+  const XT::Common::Parameter param_;
+  std::unique_ptr<typename SourceSpaceType::GlobalBasisType::LocalizedType> source_basis_in_;
+  std::unique_ptr<typename SourceSpaceType::GlobalBasisType::LocalizedType> source_basis_out_;
+  std::unique_ptr<typename RangeSpaceType::GlobalBasisType::LocalizedType> range_basis_in_;
+  std::unique_ptr<typename RangeSpaceType::GlobalBasisType::LocalizedType> range_basis_out_;
+  DynamicVector<size_t> source_indices_in_;
+  DynamicVector<size_t> source_indices_out_;
+  DynamicVector<size_t> range_indices_in_;
+  DynamicVector<size_t> range_indices_out_;
+  DynamicVector<F> local_source_in_;
+  DynamicVector<F> local_source_out_;
+  DynamicVector<F> local_range_in_;
+  DynamicVector<F> local_range_out_;
+  DynamicVector<F> local_product_;
+  DynamicMatrix<F> local_matrix_in_in_;
+  DynamicMatrix<F> local_matrix_in_out_;
+  DynamicMatrix<F> local_matrix_out_in_;
+  DynamicMatrix<F> local_matrix_out_out_;
+}; // class MatrixFreeOperatorApplicator
+
+
+/**
+ * \brief Linear operator induced by a BilinearForm, which is applied without assembling its matrix.
+ *
+ * In contrast to a MatrixOperator with the same BilinearForm appended, apply() recomputes the local matrices of all
+ * local bilinear forms on the fly and multiplies them with the local source DoFs (see MatrixFreeOperatorApplicator).
+ * This trades the memory (and bandwidth) of the global matrix for repeated evaluations of the local bilinear forms,
+ * which pays off for high polynomial orders, in particular for DG spaces in 3d.
+ *
+ * apply() walks the grid in parallel (using a coloring of the assembly grid view which is computed once on
+ * construction, see XT::Grid::ColoredPartitioning), and is thus free of write conflicts.
+ *
+ * The jacobian is given by the matrix of the bilinear form: jacobian() appends the bilinear form to the given
+ * jacobian_op, to be assembled later on. Thus, iterative solvers only calling apply() as well as newton_solve() (and
+ * apply_inverse() with type "newton") can be used without any modification.
+ *
+ * \note See OperatorInterface for a description of the template arguments, M is only used for the jacobian.
+ * \note As for the coloring, the grid of the assembly grid view must not change during the lifetime of the operator.
+ *
+ * \sa MatrixOperator
+ * \sa BilinearForm
+ */
+template <class AGV,
+          size_t s_r = 1,
+          size_t s_rC = 1,
+          size_t r_r = s_r,
+          size_t r_rC = s_rC,
+          class F = double,
+          class M = XT::LA::IstlRowMajorSparseMatrix<F>,
+          class SGV = AGV,
+          class RGV = AGV>
+class MatrixFreeOperator : public OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV, RGV>
+{
+public:
+  using ThisType = MatrixFreeOperator;
+  using BaseType = OperatorInterface<AGV, s_r, s_rC, r_r, r_rC, F, M, SGV, RGV>;
+
+  using typename BaseType::AssemblyGridViewType;
+  using typename BaseType::MatrixOperatorType;
+  using typename BaseType::RangeSpaceType;
+  using typename BaseType::SourceSpaceType;
+  using typename BaseType::VectorType;
+
+  using BilinearFormType = BilinearForm<AGV, s_r, s_rC, r_r, r_rC, F, SGV, RGV>;
+  using ApplicatorType = MatrixFreeOperatorApplicator<AGV, s_r, s_rC, r_r, r_rC, F, VectorType, SGV, RGV>;
+  using ColoringType = XT::Grid::ColoredPartitioning<AGV>;
+
+  MatrixFreeOperator(const AssemblyGridViewType assembly_grid_vw,
+                     const SourceSpaceType& source_spc,
+                     const RangeSpaceType& range_spc,
+                     const BilinearFormType& bilinear_frm,
+                     const std::string& logging_prefix = "",
+                     const std::array<bool, 3>& logging_state = XT::Common::default_logger_state())
+    : BaseType(bilinear_frm.parameter_type(),
+               logging_prefix.empty() ? "MatrixFreeOperator" : logging_prefix,
+               logging_state)
+    , assembly_grid_view_(assembly_grid_vw)
+    , source_space_(source_spc)
+    , range_space_(range_spc)
+    , bilinear_form_(bilinear_frm)
+    , coloring_(std::make_shared<const ColoringType>(assembly_grid_view_,
+                                                     /*include_face_neighbors=*/
+                                                     !bilinear_form_.coupling_intersection_data().empty()
+                                                         || !bilinear_form_.intersection_data().empty()))
+  {
+    LOG_(debug) << "MatrixFreeOperator(assembly_grid_view=" << &assembly_grid_vw << ", source_space=" << &source_spc
+                << ", range_space=" << &range_spc << ", bilinear_form=" << &bilinear_frm << ")" << std::endl;
+    LOG_(info) << "colored assembly grid view with " << coloring_->colors() << " colors" << std::endl;
+  }
+
+  /// \note The copy shares the (immutable) coloring.
+  MatrixFreeOperator(const ThisType& other) = default;
+
+  MatrixFreeOperator(ThisType&& source) noexcept = default;
+
+  // pull in methods from various base classes
+  using BaseType::apply;
+  using BaseType::apply_inverse;
+  using BaseType::jacobian;
+
+  /// \name Required by ForwardOperatorInterface.
+  /// \{
+
+  const RangeSpaceType& range_space() const override
+  {
+    return range_space_;
+  }
+
+  bool linear() const override final
+  {
+    return true;
+  }
+
+  /// \}
+  /// \name Required by OperatorInterface.
+  /// \{
+
+  const SourceSpaceType& source_space() const override
+  {
+    return source_space_;
+  }
+
+  const AssemblyGridViewType& assembly_grid_view() const override
+  {
+    return assembly_grid_view_;
+  }
+
+  void apply(const VectorType& source, VectorType& range, const XT::Common::Parameter& param = {}) const override
+  {
+    LOG_(debug) << "apply(source.sup_norm()=" << source.sup_norm() << ", range.sup_norm=" << range.sup_norm()
+                << ", param=" << print(param, {{"oneline", "true"}}) << ")" << std::endl;
+    this->assert_matching_source(source);
+    this->assert_matching_range(range);
+    DUNE_THROW_IF(&source == &range,
+                  Exceptions::operator_error,
+                  "source and range must not be the same vector for a matrix-free application!");
+    range.set_all(0.);
+    LOG_(info) << "applying {" << bilinear_form_.element_data().size() << "|"
+               << bilinear_form_.coupling_intersection_data().size() << "|"
+               << bilinear_form_.intersection_data().size()
+               << "} local {element|coupling intersection|intersection} bilinear forms ..." << std::endl;
+    ApplicatorType applicator(
+        bilinear_form_, source_space_, range_space_, source, range, param, this->logger.prefix + "_applicator");
+    XT::Grid::Walker<AGV> walker(assembly_grid_view_);
+    walker.append(applicator);
+    walker.walk_colored(*coloring_);
+  } // ... apply(...)
+
+protected:
+  std::vector<XT::Common::Configuration> all_jacobian_options() const override final
+  {
+    return {{{"type", "matrix"}}};
+  }
+
+public:
+  /// \brief Appends the bilinear form to jacobian_op (scaled by jacobian_op.scaling), call jacobian_op.assemble()!
+  void jacobian(const VectorType& source,
+                MatrixOperatorType& jacobian_op,
+                const XT::Common::Configuration& opts,
+                const XT::Common::Parameter& param = {}) const override
+  {
+    LOG_(debug) << "jacobian(source.sup_norm()=" << source.sup_norm()
+                << ", jacobian_op.matrix().sup_norm()=" << jacobian_op.matrix().sup_norm()
+                << ", opts=" << print(opts, {{"oneline", "true"}}) << ", param=" << print(param) << ")" << std::endl;
+    this->assert_matching_source(source);
+    this->assert_jacobian_opts(opts); // ensures that type matrix is requested
+    LOG_(info) << "appending bilinear form to jacobian_op (jacobian_op.scaling = " << jacobian_op.scaling << ") ..."
+               << std::endl;
+    jacobian_op.append(bilinear_form_, param);
+  } // ... jacobian(...)
+
+  /// \}
+
+  const BilinearFormType& bilinear_form() const
+  {
+    return bilinear_form_;
+  }
+
+  const ColoringType& coloring() const
+  {
+    return *coloring_;
+  }
+
+protected:
+  const AssemblyGridViewType assembly_grid_view_;
+  const SourceSpaceType& source_space_;
+  const RangeSpaceType& range_space_;
+  const BilinearFormType bilinear_form_;
+  std::shared_ptr<const ColoringType> coloring_;
+}; // class MatrixFreeOperator
+
+
+/// \name Variants of make_matrix_free_operator, the matrix type is only used for the jacobian.
+/// \{
+
+template <class AGV, size_t s_r, size_t s_rC, size_t r_r, size_t r_rC, class F, class SGV, class RGV>
+auto make_matrix_free_operator(const BilinearForm<AGV, s_r, s_rC, r_r, r_rC, F, SGV, RGV>& bilinear_form,
+                               const SpaceInterface<SGV, s_r, s_rC, F>& source_space,
+                               const SpaceInterface<RGV, r_r, r_rC, F>& range_space,
+                               const std::string& logging_prefix = "")
+{
+  return MatrixFreeOperator<AGV, s_r, s_rC, r_r, r_rC, F, XT::LA::IstlRowMajorSparseMatrix<F>, SGV, RGV>(
+      bilinear_form.assembly_grid_view(), source_space, range_space, bilinear_form, logging_prefix);
+}
+
+template <class AGV, size_t r, size_t rC, class F>
+auto make_matrix_free_operator(const BilinearForm<AGV, r, rC, r, rC, F, AGV, AGV>& bilinear_form,
+                               const SpaceInterface<AGV, r, rC, F>& space,
+                               const std::string& logging_prefix = "")
+{
+  return make_matrix_free_operator(bilinear_form, space, space, logging_prefix);
+}
+
+/**
+ * \note Use as in
+\code
+ auto op = make_matrix_free_operator<MatrixType>(bilinear_form, source_space, range_space);
+\endcode
+ */
+template <class MatrixType, class AGV, size_t s_r, size_t s_rC, size_t r_r, size_t r_rC, class F, class SGV, class RGV>
+auto make_matrix_free_operator(const BilinearForm<AGV, s_r, s_rC, r_r, r_rC, F, SGV, RGV>& bilinear_form,
+                               const SpaceInterface<SGV, s_r, s_rC, F>& source_space,
+                               const SpaceInterface<RGV, r_r, r_rC, F>& range_space,
+                               const std::string& logging_prefix = "")
+{
+  static_assert(XT::LA::is_matrix<MatrixType>::value, "");
+  return MatrixFreeOperator<AGV, s_r, s_rC, r_r, r_rC, F, MatrixType, SGV, RGV>(
+      bilinear_form.assembly_grid_view(), source_space, range_space, bilinear_form, logging_prefix);
+}
+
+template <class MatrixType, class AGV, size_t r, size_t rC, class F>
+auto make_matrix_free_operator(const BilinearForm<AGV, r, rC, r, rC, F, AGV, AGV>& bilinear_form,
+                               const SpaceInterface<AGV, r, rC, F>& space,
+                               const std::string& logging_prefix = "")
+{
+  return make_matrix_free_operator<MatrixType>(bilinear_form, space, space, logging_prefix);
+}
+
+/// \}
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_OPERATORS_MATRIX_FREE_HH
@@ -14,9 +14,13 @@
 #ifndef DUNE_GDT_OPERATORS_OPERATOR_HH
 #define DUNE_GDT_OPERATORS_OPERATOR_HH
 
+#include <memory>
+#include <mutex>
+
 #include <dune/gdt/local/assembler/operator-fd-jacobian-assemblers.hh>
 
 #include "interfaces.hh"
+#include "execution-plan.hh"
 #include "forward-operator.hh"
 
 namespace Dune {
@@ -25,6 +29,11 @@ namespace GDT {
 
 /**
  * \brief Operator built up from local element and intersection operators, applied by walking the assembly grid view.
+ *
+ * Applying the operator to a vector does not set up a Walker in each call but uses an OperatorExecutionPlan, which is
+ * created in the first call and reused afterwards (unless another thread is currently using it). The plan is dropped
+ * when appending local operators and recreated if the number of elements of the assembly grid view changed, call
+ * reset_execution_plan() after other grid changes.
  */
 template <class AGV,
           size_t s_r = 1,
@@ -61,6 +70,7 @@ public:
   using LocalElementOperatorType = LocalElementOperatorInterface<V, SGV, s_r, s_rC, F, r_r, r_rC, F, RGV, V>;
   using LocalIntersectionOperatorType =
       LocalIntersectionOperatorInterface<I, V, SGV, s_r, s_rC, F, r_r, r_rC, F, RGV, V>;
+  using ExecutionPlanType = OperatorExecutionPlan<ThisType>;
 
   Operator(const AssemblyGridViewType& assembly_grid_vw,
            const SourceSpaceType& source_spc,
@@ -74,6 +84,7 @@ public:
     , range_space_(range_spc)
     , requires_assembly_(requires_assembly)
     , linear_(true)
+    , execution_plan_mutex_(std::make_unique<std::mutex>())
   {
   }
 
@@ -84,6 +95,7 @@ public:
     , range_space_(other.range_space_)
     , requires_assembly_(other.requires_assembly_)
     , linear_(other.linear_)
+    , execution_plan_mutex_(std::make_unique<std::mutex>())
   {
     const auto copy_local_data = [](const auto& origin, auto& target) {
       for (const auto& data : origin) {
@@ -168,21 +180,50 @@ public:
     return source_space_;
   }
 
-  /// \brief Simply redirects to apply(source_function, range_vector) to avoid the base interpolation + redirect
+  /// \brief Uses the execution plan if possible, redirects to apply(source_function, range_vector) otherwise.
   void apply(const VectorType& source_vector,
              VectorType& range_vector,
              const XT::Common::Parameter& param = {}) const override
   {
     this->assert_matching_source(source_vector);
     this->assert_matching_range(range_vector);
-    this->apply(make_discrete_function(source_space_, source_vector), range_vector, param);
+    std::unique_lock<std::mutex> lock(*execution_plan_mutex_, std::try_to_lock);
+    // the function variant throws if assembly is required, and concurrent calls may not share the plan
+    if (requires_assembly_ || !lock.owns_lock()) {
+      this->apply(make_discrete_function(source_space_, source_vector), range_vector, param);
+      return;
+    }
+    LOG_(debug) << "apply(source_vector.sup_norm()=" << source_vector.sup_norm()
+                << ", range_vector.sup_norm()=" << range_vector.sup_norm() << ", param=" << print(param) << ")"
+                << std::endl;
+    if (!execution_plan_ || !execution_plan_->valid()) {
+      LOG_(info) << "creating execution plan ..." << std::endl;
+      execution_plan_ = std::make_unique<ExecutionPlanType>(*this);
+    }
+    execution_plan_->apply(source_vector, range_vector, param);
+  } // ... apply(...)
+
+  /// \brief Drops the execution plan used in apply(source_vector, range_vector), required after the grid changed.
+  void reset_execution_plan()
+  {
+    const std::lock_guard<std::mutex> lock(*execution_plan_mutex_);
+    execution_plan_.reset();
   }
 
 protected:
+  // prefers analytical jacobians if all local operators provide them
   std::vector<XT::Common::Configuration> all_jacobian_options() const override
   {
-    return {{{"type", "finite-differences"}, {"eps", "1e-7"}}};
-  }
+    bool all_local_operators_provide_jacobians = true;
+    for (const auto& data : element_data_)
+      all_local_operators_provide_jacobians &= data.first->provides_jacobian(source_space_);
+    for (const auto& data : intersection_data_)
+      all_local_operators_provide_jacobians &= data.first->provides_jacobian(source_space_);
+    if (all_local_operators_provide_jacobians)
+      return {{{"type", "analytical"}}, {{"type", "finite-differences"}, {"eps", "1e-7"}}};
+    else
+      return {{{"type", "finite-differences"}, {"eps", "1e-7"}}};
+  } // ... all_jacobian_options(...)
 
 public:
   void jacobian(const VectorType& source_vector,
@@ -193,12 +234,18 @@ public:
     LOG_(debug) << "jacobian(source_vector.sup_norm()=" << source_vector.sup_norm()
                 << ", jacobian_op.sup_norm()=" << jacobian_op.matrix().sup_norm() << print(opts, {{"oneline", "true"}})
                 << ", param=" << print(param) << ")" << std::endl;
-    this->assert_jacobian_opts(opts); // ensures that type finite-differences is requested
+    this->assert_jacobian_opts(opts); // ensures that a supported type is requested
     this->assert_matching_source(source_vector);
     const std::string type = opts.get<std::string>("type");
-    const auto default_opts = this->jacobian_options(type);
-    const double eps = opts.get("eps", default_opts.template get<double>("eps"));
-    const auto parameter = param + XT::Common::Parameter({"finite-difference-jacobians.eps", eps});
+    auto parameter = param;
+    if (type == "analytical") {
+      // the local jacobians are computed by the local operators in a single pass
+      parameter = param + XT::Common::Parameter({"analytical-jacobians", 1.});
+    } else {
+      const auto default_opts = this->jacobian_options(type);
+      const double eps = opts.get("eps", default_opts.template get<double>("eps"));
+      parameter = param + XT::Common::Parameter({"finite-difference-jacobians.eps", eps});
+    }
     // append the same local ops with the same filters as in apply() above
     LOG_(info) << "appending {" << element_data_.size() << "|" << intersection_data_.size()
                << "} local {element|intersection} operators to jacobian_op ..." << std::endl;
@@ -224,6 +271,7 @@ public:
     this->extend_parameter_type(local_operator.parameter_type());
     linear_ = linear_ && local_operator.linear();
     element_data_.emplace_back(local_operator.copy(), new ApplyOnAllElements());
+    reset_execution_plan();
     return *this;
   }
 
@@ -236,6 +284,7 @@ public:
     this->extend_parameter_type(local_operator.parameter_type());
     linear_ = linear_ && local_operator.linear();
     element_data_.emplace_back(local_operator.copy(), filter.copy());
+    reset_execution_plan();
     return *this;
   } // ... operator+=(...)
 
@@ -245,6 +294,7 @@ public:
     this->extend_parameter_type(local_operator.parameter_type());
     linear_ = linear_ && local_operator.linear();
     intersection_data_.emplace_back(local_operator.copy(), new ApplyOnAllIntersections());
+    reset_execution_plan();
     return *this;
   }
 
@@ -258,6 +308,7 @@ public:
     this->extend_parameter_type(local_operator.parameter_type());
     linear_ = linear_ && local_operator.linear();
     intersection_data_.emplace_back(local_operator.copy(), filter.copy());
+    reset_execution_plan();
     return *this;
   } // ... operator+=(...)
 
@@ -284,6 +335,8 @@ protected:
   std::list<std::pair<std::unique_ptr<LocalElementOperatorType>, std::unique_ptr<ElementFilterType>>> element_data_;
   std::list<std::pair<std::unique_ptr<LocalIntersectionOperatorType>, std::unique_ptr<IntersectionFilterType>>>
       intersection_data_;
+  mutable std::unique_ptr<std::mutex> execution_plan_mutex_;
+  mutable std::unique_ptr<ExecutionPlanType> execution_plan_;
 }; // class Operator
 
 
@@ -17,10 +17,13 @@
 #ifndef DUNE_GDT_PROLONGATIONS_HH
 #define DUNE_GDT_PROLONGATIONS_HH
 
+#include <type_traits>
 #include <vector>
 
+#include <dune/common/dynmatrix.hh>
 #include <dune/common/dynvector.hh>
 
+#include <dune/xt/grid/type_traits.hh>
 #include <dune/xt/la/container/vector-interface.hh>
 
 #include <dune/gdt/discretefunction/bochner.hh>
@@ -34,6 +37,155 @@ namespace Dune {
 namespace GDT {
 
 
+namespace internal {
+
+
+/**
+ * \brief Prolongs source onto target along the grid hierarchy, if every element of prolongation_grid_view is contained
+ *        in source.space().grid_view() or has an ancestor there (e.g., after global_refine() or adaptation).
+ *
+ * The ancestor is found via father() instead of a point search, and the local DoFs on the element are obtained from
+ * those on the ancestor by a small matrix-vector product. The matrix only depends on the finite elements and on the
+ * position of the element within its ancestor (given by the geometryInFather() of all levels in between, i.e., the
+ * child index), so it is computed once per call for each such combination.
+ *
+ * \note Requires the global bases of both spaces to coincide with the bases of their finite elements, as is the case
+ *       for the Lagrange and finite volume spaces (compare SpaceInterface::prolong_onto()).
+ *
+ * \return false, without touching target, if this is not applicable.
+ */
+template <class SV, class SGV, size_t r, size_t rC, class SR, class TV, class TGV, class TR, class PGV>
+bool prolong_along_grid_hierarchy(const ConstDiscreteFunction<SV, SGV, r, rC, SR>& source,
+                                  DiscreteFunction<TV, TGV, r, rC, TR>& target,
+                                  const GridView<PGV>& prolongation_grid_view)
+{
+  if constexpr (!std::is_same<XT::Grid::extract_grid_t<SGV>, typename PGV::Grid>::value || !std::is_same<SR, TR>::value)
+    return false;
+  else {
+    using E = XT::Grid::extract_entity_t<SGV>;
+    using D = typename SGV::ctype;
+    static constexpr size_t d = SGV::dimension;
+    using LocalGeometryType = typename E::LocalGeometry;
+    const auto& source_space = source.space();
+    const auto& target_space = target.space();
+    const auto& source_grid_view = source_space.grid_view();
+    const auto supports_prolongation_along_grid_hierarchy = [](const auto& space) {
+      return space.type() == SpaceType::continuous_lagrange || space.type() == SpaceType::discontinuous_lagrange
+             || space.type() == SpaceType::finite_volume;
+    };
+    if (prolongation_grid_view.size(0) == 0 || &source_grid_view.grid() != &prolongation_grid_view.grid()
+        || !supports_prolongation_along_grid_hierarchy(source_space)
+        || !supports_prolongation_along_grid_hierarchy(target_space))
+      return false;
+    // the closest ancestor of element in source_grid_view (the element itself, if contained), collects the geometries
+    // in father of all levels in between
+    std::vector<LocalGeometryType> geometries_in_ancestor;
+    const auto find_ancestor = [&](const E& element, E& ancestor) {
+      geometries_in_ancestor.clear();
+      ancestor = element;
+      while (!source_grid_view.contains(ancestor)) {
+        if (!ancestor.hasFather())
+          return false;
+        geometries_in_ancestor.emplace_back(ancestor.geometryInFather());
+        ancestor = ancestor.father();
+      }
+      return true;
+    };
+    E ancestor = *prolongation_grid_view.template begin<0>();
+    for (auto&& element : elements(prolongation_grid_view))
+      if (!find_ancestor(element, ancestor))
+        return false;
+    // the reference prolongation matrices
+    struct Reference
+    {
+      GeometryType ancestor_geometry_type;
+      int source_order;
+      size_t source_size;
+      GeometryType geometry_type;
+      int target_order;
+      size_t target_size;
+      std::vector<FieldVector<D, d>> corners_in_ancestor;
+      DynamicMatrix<TR> matrix;
+    };
+    std::vector<Reference> references;
+    std::vector<FieldVector<D, d>> corners_in_ancestor;
+    const auto to_ancestor = [&](FieldVector<D, d> point_in_reference_element) {
+      for (const auto& geometry_in_father : geometries_in_ancestor)
+        point_in_reference_element = geometry_in_father.global(point_in_reference_element);
+      return point_in_reference_element;
+    };
+    auto source_basis = source_space.basis().localize();
+    auto target_basis = target_space.basis().localize();
+    DynamicVector<size_t> source_global_indices(source_space.mapper().max_local_size());
+    DynamicVector<size_t> target_global_indices(target_space.mapper().max_local_size());
+    DynamicVector<TR> source_local_dofs(source_space.mapper().max_local_size());
+    DynamicVector<TR> target_local_dofs(target_space.mapper().max_local_size());
+    DynamicVector<TR> column(target_space.mapper().max_local_size());
+    std::vector<typename XT::Functions::RangeTypeSelector<TR, r, rC>::type> source_basis_values;
+    for (auto&& element : elements(prolongation_grid_view)) {
+      find_ancestor(element, ancestor);
+      source_basis->bind(ancestor);
+      target_basis->bind(element);
+      const auto& source_fe = source_basis->finite_element();
+      const auto& target_fe = target_basis->finite_element();
+      // find the reference matrix, ...
+      const auto& reference_element = ReferenceElements<D, d>::general(element.type());
+      corners_in_ancestor.resize(reference_element.size(d));
+      for (size_t ii = 0; ii < corners_in_ancestor.size(); ++ii)
+        corners_in_ancestor[ii] = to_ancestor(reference_element.position(static_cast<int>(ii), d));
+      const Reference* reference = nullptr;
+      for (const auto& candidate : references)
+        if (candidate.ancestor_geometry_type == ancestor.type() && candidate.source_order == source_fe.order()
+            && candidate.source_size == source_fe.size() && candidate.geometry_type == element.type()
+            && candidate.target_order == target_fe.order() && candidate.target_size == target_fe.size()
+            && candidate.corners_in_ancestor == corners_in_ancestor) {
+          reference = &candidate;
+          break;
+        }
+      // ... or compute it: the j-th column holds the interpolation of the j-th basis function on the ancestor
+      if (reference == nullptr) {
+        DynamicMatrix<TR> matrix(target_fe.size(), source_fe.size(), 0.);
+        for (size_t jj = 0; jj < source_fe.size(); ++jj) {
+          target_fe.interpolation().interpolate(
+              [&](const auto& point_in_reference_element) {
+                source_fe.basis().evaluate(to_ancestor(point_in_reference_element), source_basis_values);
+                return source_basis_values[jj];
+              },
+              source_fe.order(),
+              column);
+          for (size_t ii = 0; ii < target_fe.size(); ++ii)
+            matrix[ii][jj] = column[ii];
+        }
+        references.push_back({ancestor.type(),
+                              source_fe.order(),
+                              source_fe.size(),
+                              element.type(),
+                              target_fe.order(),
+                              target_fe.size(),
+                              corners_in_ancestor,
+                              std::move(matrix)});
+        reference = &references.back();
+      }
+      // apply it
+      source_space.mapper().global_indices(ancestor, source_global_indices);
+      target_space.mapper().global_indices(element, target_global_indices);
+      for (size_t jj = 0; jj < source_fe.size(); ++jj)
+        source_local_dofs[jj] = source.dofs().vector().get_entry(source_global_indices[jj]);
+      for (size_t ii = 0; ii < target_fe.size(); ++ii) {
+        TR value = 0;
+        for (size_t jj = 0; jj < source_fe.size(); ++jj)
+          value += reference->matrix[ii][jj] * source_local_dofs[jj];
+        target.dofs().vector().set_entry(target_global_indices[ii], value);
+      }
+    }
+    return true;
+  }
+} // ... prolong_along_grid_hierarchy(...)
+
+
+} // namespace internal
+
+
 // ## Variants for a DiscreteFunction ##
 
 
@@ -44,6 +196,9 @@ namespace GDT {
  * \note This does not clear target.dofs().vector(). Thus, if prolongation_grid_view only covers a part of the domain of
  *       target.space().grid_view(), other contributions in target remain (which is on purpose).
  *
+ * \note If the elements of prolongation_grid_view are (descendants of) elements of source.space().grid_view() of the
+ *       same grid, the grid hierarchy is used instead of a point search (see internal::prolong_along_grid_hierarchy).
+ *
  * \sa interpolate
  * \sa reinterpret
  */
@@ -54,6 +209,8 @@ prolong(const ConstDiscreteFunction<SV, SGV, r, rC, SR>& source,
         DiscreteFunction<TV, TGV, r, rC, TR>& target,
         const GridView<PGV>& prolongation_grid_view)
 {
+  if (internal::prolong_along_grid_hierarchy(source, target, prolongation_grid_view))
+    return;
   default_interpolation(reinterpret(source, prolongation_grid_view), target, prolongation_grid_view);
 }
 
@@ -16,11 +16,15 @@
 #ifndef DUNE_GDT_SPACES_BASIS_DEFAULT_HH
 #define DUNE_GDT_SPACES_BASIS_DEFAULT_HH
 
+#include <algorithm>
+#include <memory>
+
 #include <dune/xt/common/memory.hh>
 #include <dune/xt/functions/interfaces/grid-function.hh>
 
 #include <dune/gdt/exceptions.hh>
 #include <dune/gdt/local/finite-elements/interfaces.hh>
+#include <dune/gdt/local/finite-elements/tabulation.hh>
 
 #include "interface.hh"
 
@@ -31,6 +35,10 @@ namespace GDT {
 /**
  * Applies no transformation in evaluate, but left-multiplication by the geometry transformations jacobian inverse
  * transpose in jacobian.
+ *
+ * Evaluations at the points of a quadrature rule (see evaluate_at_quadrature_point() and
+ * jacobians_at_quadrature_point()) are served from tabulations of the local finite element bases, which are shared
+ * between all copies and localizations of this basis.
  */
 template <class GV, size_t r = 1, size_t rC = 1, class R = double>
 class DefaultGlobalBasis : public GlobalBasisInterface<GV, r, rC, R>
@@ -60,6 +68,7 @@ public:
     , local_finite_elements_(local_finite_elements)
     , fe_order_(order)
     , max_size_(0)
+    , tabulations_(std::make_shared<TabulationCacheType>())
   {
   }
 
@@ -83,6 +92,9 @@ public:
   }
 
 private:
+  using TabulationCacheType = LocalFiniteElementBasisTabulationCache<D, d, R, r, rC>;
+  using TabulationType = typename TabulationCacheType::TabulationType;
+
   class LocalizedDefaultGlobalBasis : public LocalizedGlobalFiniteElementInterface<E, r, rC, R>
   {
     using ThisType = LocalizedDefaultGlobalBasis;
@@ -97,6 +109,7 @@ private:
     using typename BaseType::ElementType;
     using typename BaseType::LocalFiniteElementType;
     using typename BaseType::RangeType;
+    using QuadratureType = QuadratureRule<D, d>;
 
     explicit LocalizedDefaultGlobalBasis(const DefaultGlobalBasis<GV, r, rC, R>& self)
       : BaseType()
@@ -144,7 +157,9 @@ private:
     }
 
     using BaseType::evaluate;
+    using BaseType::evaluate_at_quadrature_point;
     using BaseType::jacobians;
+    using BaseType::jacobians_at_quadrature_point;
 
     void evaluate(const DomainType& point_in_reference_element,
                   std::vector<RangeType>& result,
@@ -163,23 +178,44 @@ private:
       this->assert_inside_reference_element(point_in_reference_element);
       // evaluate jacobian of shape functions
       current_local_fe_.access().basis().jacobian(point_in_reference_element, result);
-      // Apply transformation:
-      // Let f: E -> R^r be a basis function, and g: E' -> E be the mapping from reference to actual element, then f
-      // \circ g is a shape function. We have the chain rule J_f = J(f \circ g \circ g^{-1}) = J(f \circ g) J_g^{-1}.
-      // Applying the transpose to that equation gives
-      // J_f^T = J_g^{-T} J(f \circ g)^T,
-      // so we have to multiply J_inv_T from the left to the transposed shape function jacobians (i.e. the shape
-      // function gradients) to get the transposed jacobian of the basis function (basis function gradient).
-      const auto J_inv_T = this->element().geometry().jacobianInverseTransposed(point_in_reference_element);
-      auto tmp_value = result[0][0];
-      const size_t basis_size = current_local_fe_.access().basis().size();
-      for (size_t ii = 0; ii < basis_size; ++ii)
-        for (size_t rr = 0; rr < r; ++rr) {
-          J_inv_T.mv(result[ii][rr], tmp_value);
-          result[ii][rr] = tmp_value;
-        }
+      transform_reference_jacobians(point_in_reference_element, result);
     } // ... jacobian(...)
 
+    void evaluate_at_quadrature_point(const QuadratureType& quadrature,
+                                      const size_t point_index,
+                                      std::vector<RangeType>& result,
+                                      const XT::Common::Parameter& param = {}) const override final
+    {
+      DUNE_THROW_IF(!current_local_fe_.valid(), Exceptions::not_bound_to_an_element_yet, "");
+      const auto* tab = tabulation(quadrature, point_index);
+      if (!tab) {
+        this->evaluate(quadrature[point_index].position(), result, param);
+        return;
+      }
+      const auto& values = tab->values(point_index);
+      if (result.size() < values.size())
+        result.resize(values.size());
+      std::copy(values.begin(), values.end(), result.begin());
+    } // ... evaluate_at_quadrature_point(...)
+
+    void jacobians_at_quadrature_point(const QuadratureType& quadrature,
+                                       const size_t point_index,
+                                       std::vector<DerivativeRangeType>& result,
+                                       const XT::Common::Parameter& param = {}) const override final
+    {
+      DUNE_THROW_IF(!current_local_fe_.valid(), Exceptions::not_bound_to_an_element_yet, "");
+      const auto* tab = tabulation(quadrature, point_index);
+      if (!tab) {
+        this->jacobians(quadrature[point_index].position(), result, param);
+        return;
+      }
+      const auto& reference_jacobians = tab->reference_jacobians(point_index);
+      if (result.size() < reference_jacobians.size())
+        result.resize(reference_jacobians.size());
+      std::copy(reference_jacobians.begin(), reference_jacobians.end(), result.begin());
+      transform_reference_jacobians(tab->point(point_index), result);
+    } // ... jacobians_at_quadrature_point(...)
+
     // required by LocalizedGlobalFiniteElementInterface
 
     const LocalFiniteElementType& finite_element() const override final
@@ -213,17 +249,56 @@ private:
     }
 
   private:
+    void transform_reference_jacobians(const DomainType& point_in_reference_element,
+                                       std::vector<DerivativeRangeType>& result) const
+    {
+      // Apply transformation:
+      // Let f: E -> R^r be a basis function, and g: E' -> E be the mapping from reference to actual element, then f
+      // \circ g is a shape function. We have the chain rule J_f = J(f \circ g \circ g^{-1}) = J(f \circ g) J_g^{-1}.
+      // Applying the transpose to that equation gives
+      // J_f^T = J_g^{-T} J(f \circ g)^T,
+      // so we have to multiply J_inv_T from the left to the transposed shape function jacobians (i.e. the shape
+      // function gradients) to get the transposed jacobian of the basis function (basis function gradient).
+      const auto J_inv_T = this->element().geometry().jacobianInverseTransposed(point_in_reference_element);
+      auto tmp_value = result[0][0];
+      const size_t basis_size = current_local_fe_.access().basis().size();
+      for (size_t ii = 0; ii < basis_size; ++ii)
+        for (size_t rr = 0; rr < r; ++rr) {
+          J_inv_T.mv(result[ii][rr], tmp_value);
+          result[ii][rr] = tmp_value;
+        }
+    } // ... transform_reference_jacobians(...)
+
+    // Returns the tabulation of the current basis for the given quadrature, or nullptr if it cannot be used for the
+    // point_index-th point. The last tabulation is remembered, so the cache is only queried if the quadrature rule or
+    // the local finite element changes (or if another rule now lives at the address of the last one).
+    const TabulationType* tabulation(const QuadratureType& quadrature, const size_t point_index) const
+    {
+      const auto& basis = current_local_fe_.access().basis();
+      if (&basis != tabulated_basis_ || &quadrature != tabulated_quadrature_
+          || !tabulation_->matches(quadrature, point_index)) {
+        tabulation_ = self_.tabulations_->get(basis, quadrature);
+        tabulated_basis_ = &basis;
+        tabulated_quadrature_ = &quadrature;
+      }
+      return tabulation_->matches(quadrature, point_index) ? tabulation_.get() : nullptr;
+    } // ... tabulation(...)
+
     const DefaultGlobalBasis<GV, r, rC, R>& self_;
     XT::Common::ConstStorageProvider<LocalFiniteElementInterface<D, d, R, r, rC>> current_local_fe_;
     size_t size_;
     int order_;
     Dune::GeometryType geometry_type_;
+    mutable std::shared_ptr<const TabulationType> tabulation_;
+    mutable const typename TabulationType::BasisType* tabulated_basis_ = nullptr;
+    mutable const QuadratureType* tabulated_quadrature_ = nullptr;
   }; // class LocalizedDefaultGlobalBasis
 
   const GridViewType& grid_view_;
   const FiniteElementFamilyType& local_finite_elements_;
   const int fe_order_;
   size_t max_size_;
+  const std::shared_ptr<const TabulationCacheType> tabulations_;
 }; // class DefaultGlobalBasis
 
 
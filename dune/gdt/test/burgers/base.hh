@@ -127,15 +127,15 @@ protected:
           DXTC_TEST_CONFIG_GET("setup.estimate_fixed_explicit_dt.min_dt", 1e-4),
           T_end,
           DXTC_TEST_CONFIG_GET("setup.estimate_fixed_explicit_dt.max_overshoot", 1.25));
-    self.current_data_["quantity"]["dt"] = dt;
-    self.current_data_["quantity"]["explicit_fv_dt"] = fv_dt;
+    self.current_data()["quantity"]["dt"] = dt;
+    self.current_data()["quantity"]["explicit_fv_dt"] = fv_dt;
     Timer timer;
     const auto u_0 = self.make_initial_values(space);
     const auto op = self.make_lhs_operator(space);
     /// TODO: investigate why the tested dt from above does not work!
     auto solution = GDT::Test::solve_instationary_system_explicit_euler(
         u_0, *op, T_end, DXTC_TEST_CONFIG_GET("setup.dt_factor", 0.99) * dt);
-    self.current_data_["quantity"]["time to solution (s)"] = timer.elapsed();
+    self.current_data()["quantity"]["time to solution (s)"] = timer.elapsed();
     return solution;
   } // ... solve(...)
 }; // class BurgersExplicitTest
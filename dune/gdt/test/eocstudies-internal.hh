@@ -0,0 +1,113 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   Felix Schindler (2019)
+
+/**
+ * \file  eocstudies-internal.hh
+ * \brief Internal helpers shared by the StationaryEocStudy and the InstationaryEocStudy.
+ **/
+#ifndef DUNE_GDT_TEST_EOCSTUDIES_INTERNAL_HH
+#define DUNE_GDT_TEST_EOCSTUDIES_INTERNAL_HH
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace Dune {
+namespace GDT {
+namespace Test {
+namespace internal {
+
+
+/**
+ * \brief Holds everything which belongs to the refinement level currently computed.
+ *
+ * Several levels may be computed concurrently (see tbb::this_task_arena::isolate in ConvergenceStudy::run()), so each
+ * thread computing a level installs its own LevelState via a LevelStateGuard. All other calls use the default one.
+ */
+template <class GP, class S, class SolutionType>
+class EocStudyLevelState
+{
+protected:
+  struct LevelState
+  {
+    size_t refinement = std::numeric_limits<size_t>::max();
+    std::map<std::string, std::map<std::string, double>> data;
+    std::unique_ptr<GP> grid;
+    std::unique_ptr<S> space;
+    std::unique_ptr<SolutionType> solution_on_reference_grid;
+  };
+
+  /// \brief The LevelState installed by this thread, if any.
+  static LevelState*& level_state_of_this_thread()
+  {
+    thread_local LevelState* level_state = nullptr;
+    return level_state;
+  }
+
+  /// \brief Installs a LevelState for this thread, restores the previous one on destruction.
+  class LevelStateGuard
+  {
+  public:
+    explicit LevelStateGuard(LevelState& level_state)
+      : previous_(level_state_of_this_thread())
+    {
+      level_state_of_this_thread() = &level_state;
+    }
+
+    ~LevelStateGuard()
+    {
+      level_state_of_this_thread() = previous_;
+    }
+
+  private:
+    LevelState* const previous_;
+  }; // class LevelStateGuard
+
+  LevelState& level_state()
+  {
+    return level_state_of_this_thread() ? *level_state_of_this_thread() : level_state_;
+  }
+
+  size_t& current_refinement()
+  {
+    return level_state().refinement;
+  }
+
+  std::map<std::string, std::map<std::string, double>>& current_data()
+  {
+    return level_state().data;
+  }
+
+  std::unique_ptr<GP>& current_grid()
+  {
+    return level_state().grid;
+  }
+
+  std::unique_ptr<S>& current_space()
+  {
+    return level_state().space;
+  }
+
+  std::unique_ptr<SolutionType>& current_solution_on_reference_grid()
+  {
+    return level_state().solution_on_reference_grid;
+  }
+
+private:
+  LevelState level_state_;
+}; // class EocStudyLevelState
+
+
+} // namespace internal
+} // namespace Test
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_TEST_EOCSTUDIES_INTERNAL_HH
@@ -0,0 +1,195 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <dune/common/dynvector.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/type.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/finite-elements/lagrange.hh>
+#include <dune/gdt/local/finite-elements/orthonormal.hh>
+#include <dune/gdt/local/finite-elements/tensor-product.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/local/integrands/product.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+
+GTEST_TEST(finite_elements_tensor_product, detects_lagrange_elements_on_cubes_only)
+{
+  for (int order = 0; order < 5; ++order) {
+    EXPECT_NE(make_local_lagrange_finite_element<double, 2, double>(GeometryTypes::cube(2), order)
+                  ->tensor_product_basis(),
+              nullptr)
+        << "order = " << order;
+    EXPECT_NE(make_local_lagrange_finite_element<double, 3, double>(GeometryTypes::cube(3), order)
+                  ->tensor_product_basis(),
+              nullptr)
+        << "order = " << order;
+    EXPECT_NE(make_local_lagrange_finite_element<double, 2, double, 2>(GeometryTypes::cube(2), order)
+                  ->tensor_product_basis(),
+              nullptr)
+        << "order = " << order;
+  }
+  for (int order = 1; order < 5; ++order) {
+    EXPECT_EQ(make_local_lagrange_finite_element<double, 2, double>(GeometryTypes::simplex(2), order)
+                  ->tensor_product_basis(),
+              nullptr)
+        << "order = " << order;
+    // spans P_k, not Q_k
+    EXPECT_EQ(make_local_orthonormal_finite_element<double, 2, double>(GeometryTypes::cube(2), order)
+                  ->tensor_product_basis(),
+              nullptr)
+        << "order = " << order;
+  }
+}
+
+
+template <size_t d>
+void kernel_evaluations_coincide_with_basis_evaluations(const int order, const size_t num_points_1d)
+{
+  const auto fe = make_local_lagrange_finite_element<double, d, double>(GeometryTypes::cube(d), order);
+  const auto* factorization = fe->tensor_product_basis();
+  ASSERT_NE(factorization, nullptr);
+  ASSERT_EQ(fe->size(), factorization->size());
+  const auto& kernel = factorization->kernel(num_points_1d);
+  const size_t size = fe->size();
+  DynamicVector<double> dofs(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    dofs[ii] = std::sin(double(ii)) + 0.5;
+  std::vector<double> point_values(kernel.num_points());
+  for (size_t qq = 0; qq < kernel.num_points(); ++qq)
+    point_values[qq] = std::cos(double(qq));
+  typename LocalSumFactorizationKernel<double, d, double>::Workspace workspace;
+  std::vector<double> values;
+  std::vector<FieldVector<double, d>> gradients;
+  kernel.evaluate(dofs, values, workspace);
+  kernel.evaluate_reference_gradients(dofs, gradients, workspace);
+  DynamicVector<double> integrated(size, 0.);
+  kernel.integrate(point_values, integrated, workspace);
+  std::vector<FieldVector<double, d>> point_gradients(kernel.num_points());
+  for (size_t qq = 0; qq < kernel.num_points(); ++qq)
+    for (size_t dd = 0; dd < d; ++dd)
+      point_gradients[qq][dd] = point_values[qq] * double(dd + 1);
+  DynamicVector<double> integrated_gradients(size, 0.);
+  kernel.integrate_reference_gradients(point_gradients, integrated_gradients, workspace);
+  // compare with the evaluation of the basis at the points of the kernel
+  DynamicVector<double> expected_integrated(size, 0.);
+  DynamicVector<double> expected_integrated_gradients(size, 0.);
+  const double tolerance = 1e-11;
+  for (size_t qq = 0; qq < kernel.num_points(); ++qq) {
+    const auto& point = kernel.points()[qq];
+    const auto basis_values = fe->basis().evaluate(point);
+    const auto basis_jacobians = fe->basis().jacobian(point);
+    double expected_value = 0.;
+    FieldVector<double, d> expected_gradient(0.);
+    for (size_t ii = 0; ii < size; ++ii) {
+      expected_value += dofs[ii] * basis_values[ii][0];
+      expected_gradient.axpy(dofs[ii], basis_jacobians[ii][0]);
+      expected_integrated[ii] += point_values[qq] * basis_values[ii][0];
+      expected_integrated_gradients[ii] += point_gradients[qq] * basis_jacobians[ii][0];
+    }
+    EXPECT_NEAR(expected_value, values[qq], tolerance) << "qq = " << qq;
+    for (size_t dd = 0; dd < d; ++dd)
+      EXPECT_NEAR(expected_gradient[dd], gradients[qq][dd], tolerance * std::max(1., std::abs(expected_gradient[dd])))
+          << "qq = " << qq << ", dd = " << dd;
+  }
+  for (size_t ii = 0; ii < size; ++ii) {
+    EXPECT_NEAR(expected_integrated[ii], integrated[ii], tolerance) << "ii = " << ii;
+    EXPECT_NEAR(expected_integrated_gradients[ii],
+                integrated_gradients[ii],
+                tolerance * std::max(1., std::abs(expected_integrated_gradients[ii])))
+        << "ii = " << ii;
+  }
+} // ... kernel_evaluations_coincide_with_basis_evaluations(...)
+
+GTEST_TEST(finite_elements_tensor_product, kernel_2d)
+{
+  for (int order = 0; order < 5; ++order)
+    for (size_t num_points_1d : {1, 3, 6})
+      kernel_evaluations_coincide_with_basis_evaluations<2>(order, num_points_1d);
+}
+
+GTEST_TEST(finite_elements_tensor_product, kernel_3d)
+{
+  for (int order = 1; order < 4; ++order)
+    kernel_evaluations_coincide_with_basis_evaluations<3>(order, order + 1);
+}
+
+
+template <class G>
+struct SumFactorizedBilinearFormTest : public ::testing::Test
+{
+  static constexpr size_t d = G::dimension;
+  using GV = typename G::LeafGridView;
+  using E = XT::Grid::extract_entity_t<GV>;
+
+  SumFactorizedBilinearFormTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 2u))
+  {
+  }
+
+  // the sum-factorized application has to coincide with the application of the local matrix
+  template <class SpaceType>
+  void apply_coincides_with_apply2(const SpaceType& space)
+  {
+    const LocalElementIntegralBilinearForm<E> bilinear_form(LocalLaplaceIntegrand<E>()
+                                                            + LocalElementProductIntegrand<E>(3.));
+    auto test_basis = space.basis().localize();
+    auto ansatz_basis = space.basis().localize();
+    DynamicMatrix<double> local_matrix;
+    DynamicVector<double> actual;
+    for (auto&& element : elements(space.grid_view())) {
+      test_basis->bind(element);
+      ansatz_basis->bind(element);
+      ASSERT_NE(ansatz_basis->finite_element().tensor_product_basis(), nullptr);
+      DynamicVector<double> dofs(ansatz_basis->size());
+      for (size_t jj = 0; jj < dofs.size(); ++jj)
+        dofs[jj] = std::sin(double(jj)) + 0.5;
+      bilinear_form.apply2(*test_basis, *ansatz_basis, local_matrix);
+      bilinear_form.apply(*test_basis, *ansatz_basis, dofs, actual);
+      for (size_t ii = 0; ii < test_basis->size(); ++ii) {
+        double expected = 0.;
+        for (size_t jj = 0; jj < ansatz_basis->size(); ++jj)
+          expected += local_matrix[ii][jj] * dofs[jj];
+        EXPECT_NEAR(expected, actual[ii], 1e-12 * std::max(1., std::abs(expected))) << "ii = " << ii;
+      }
+    }
+  } // ... apply_coincides_with_apply2(...)
+
+  XT::Grid::GridProvider<G> grid;
+}; // struct SumFactorizedBilinearFormTest
+
+
+using GridTypes = ::testing::Types<YASP_2D_EQUIDISTANT_OFFSET, YASP_3D_EQUIDISTANT_OFFSET>;
+
+TYPED_TEST_SUITE(SumFactorizedBilinearFormTest, GridTypes);
+TYPED_TEST(SumFactorizedBilinearFormTest, continuous_lagrange_p2)
+{
+  this->apply_coincides_with_apply2(make_continuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TYPED_TEST(SumFactorizedBilinearFormTest, discontinuous_lagrange_p3)
+{
+  this->apply_coincides_with_apply2(make_discontinuous_lagrange_space(this->grid.leaf_view(), 3));
+}
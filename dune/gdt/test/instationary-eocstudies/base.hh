@@ -15,6 +15,7 @@
 #include <cmath>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 #include <dune/common/timer.hh>
 #include <dune/grid/io/file/dgfparser.hh>
@@ -50,6 +51,7 @@
 #include <dune/gdt/spaces/bochner.hh>
 #include <dune/gdt/spaces/interface.hh>
 #include <dune/gdt/type_traits.hh>
+#include <dune/gdt/test/eocstudies-internal.hh>
 
 namespace Dune {
 namespace GDT {
@@ -89,6 +91,10 @@ template <class GridView, size_t m_ = 1, XT::LA::Backends la = XT::LA::Backends:
 class InstationaryEocStudy
   : public XT::Common::ConvergenceStudy
   , public ::testing::Test
+  , protected internal::EocStudyLevelState<
+        XT::Grid::GridProvider<typename GridView::Grid>,
+        SpaceInterface<GridView, m_>,
+        XT::LA::ListVectorArray<XT::LA::vector_t<typename XT::LA::Container<double, la>::MatrixType>>>
 {
   static_assert(XT::Grid::is_view<GridView>::value, "");
 
@@ -109,6 +115,14 @@ protected:
   using DF = DiscreteFunction<V, GV, m>;
   using BS = BochnerSpace<GV, m>;
   using O = OperatorInterface<GV, m, 1, m, 1, R, M>;
+  using LevelStateBaseType = internal::EocStudyLevelState<GP, S, XT::LA::ListVectorArray<V>>;
+  using typename LevelStateBaseType::LevelState;
+  using typename LevelStateBaseType::LevelStateGuard;
+  using LevelStateBaseType::current_data;
+  using LevelStateBaseType::current_grid;
+  using LevelStateBaseType::current_refinement;
+  using LevelStateBaseType::current_solution_on_reference_grid;
+  using LevelStateBaseType::current_space;
 
 public:
   InstationaryEocStudy(
@@ -123,13 +137,8 @@ public:
     , num_refinements_(num_refinements)
     , num_additional_refinements_for_reference_(num_additional_refinements_for_reference)
     , visualize_(visualizer)
-    , current_refinement_(std::numeric_limits<size_t>::max())
-    , current_data_()
-    , current_grid_(nullptr)
-    , current_space_(nullptr)
     , reference_grid_(nullptr)
     , reference_space_(nullptr)
-    , current_solution_on_reference_grid_(nullptr)
     , reference_solution_on_reference_grid_(nullptr)
   {
   }
@@ -177,6 +186,41 @@ public:
     return " |grid| |   #DoFs";
   }
 
+  /// \note Opt-in via setup.concurrent_levels, since not all grids may be used from several threads at once.
+  bool levels_are_independent() const override
+  {
+    return DXTC_TEST_CONFIG_GET("setup.concurrent_levels", false);
+  }
+
+  /// \note Halving h in space also halves the time step.
+  double estimated_work(const size_t refinement_level) const override
+  {
+    return std::pow(2., double((d + 1) * refinement_level));
+  }
+
+  /// \brief Computes the level on a fresh LevelState, which is used by all calls of this thread in the meantime.
+  std::pair<std::string, std::map<std::string, std::map<std::string, double>>>
+  compute_level(const size_t refinement_level,
+                const std::vector<std::string>& actual_norms,
+                const std::vector<std::pair<std::string, std::string>>& actual_estimates,
+                const std::vector<std::string>& actual_quantities) override
+  {
+    LevelState level_state;
+    const LevelStateGuard guard(level_state);
+    if (!actual_norms.empty()) {
+      // Some studies temporarily modify the space type for the reference solution, so no level may create its space
+      // in the meantime. The reference solution is computed after this level's discretization info, as in the
+      // sequential case, since solve() may depend on it (e.g., on the grid width for the time step).
+      std::lock_guard<std::mutex> lock(reference_mutex_);
+      discretization_info(refinement_level);
+      const auto current_data_backup = current_data();
+      compute_reference_solution();
+      current_data() = current_data_backup;
+    }
+    return XT::Common::ConvergenceStudy::compute_level(
+        refinement_level, actual_norms, actual_estimates, actual_quantities);
+  }
+
 protected:
   virtual GP make_initial_grid() = 0;
 
@@ -185,27 +229,27 @@ protected:
 public:
   std::string discretization_info(const size_t refinement_level) override
   {
-    if (current_refinement_ != refinement_level) {
+    if (current_refinement() != refinement_level) {
       // clear the current state
-      current_grid_.reset();
-      current_space_.reset();
-      current_solution_on_reference_grid_.reset();
+      current_grid().reset();
+      current_space().reset();
+      current_solution_on_reference_grid().reset();
       // compute on this refinement
-      current_grid_ = std::make_unique<GP>(make_initial_grid());
+      current_grid() = std::make_unique<GP>(make_initial_grid());
       for (size_t ref = 0; ref < refinement_level; ++ref)
-        current_grid_->global_refine(DGFGridInfo<G>::refineStepsForHalf());
-      current_space_ = make_space(*current_grid_);
+        current_grid()->global_refine(DGFGridInfo<G>::refineStepsForHalf());
+      current_space() = make_space(*current_grid());
       double grid_size = 0;
       double grid_width = 0.;
-      for (auto&& grid_element : elements(current_space_->grid_view())) {
+      for (auto&& grid_element : elements(current_space()->grid_view())) {
         grid_size += 1;
         grid_width = std::max(grid_width, XT::Grid::entity_diameter(grid_element));
       }
-      current_refinement_ = refinement_level;
-      current_data_.clear();
-      current_data_["target"]["h"] = grid_width;
-      current_data_["quantity"]["num_grid_elements"] = grid_size;
-      current_data_["quantity"]["num_dofs"] = static_cast<double>(current_space_->mapper().size());
+      current_refinement() = refinement_level;
+      current_data().clear();
+      current_data()["target"]["h"] = grid_width;
+      current_data()["quantity"]["num_grid_elements"] = grid_size;
+      current_data()["quantity"]["num_dofs"] = static_cast<double>(current_space()->mapper().size());
     }
     const auto lfill_nicely = [&](const auto& number, const auto& len) {
       std::string ret;
@@ -219,8 +263,8 @@ public:
       }
       return ret;
     };
-    return lfill_nicely(current_data_["quantity"]["num_grid_elements"], 7) + " | "
-           + lfill_nicely(current_data_["quantity"]["num_dofs"], 7);
+    return lfill_nicely(current_data()["quantity"]["num_grid_elements"], 7) + " | "
+           + lfill_nicely(current_data()["quantity"]["num_dofs"], 7);
   } // ... discretization_info(...)
 
 protected:
@@ -254,17 +298,17 @@ public:
           const std::vector<std::string>& actual_quantities) override
   {
     auto& self = *this;
-    if (current_refinement_ != refinement_level)
+    if (current_refinement() != refinement_level)
       self.discretization_info(refinement_level);
-    DUNE_THROW_IF(!current_space_, InvalidStateException, "");
+    DUNE_THROW_IF(!current_space(), InvalidStateException, "");
     // compute current solution
-    const auto& current_space = *current_space_;
+    const auto& current_space = *self.current_space();
     Timer timer;
     auto solution_on_current_grid = solve(current_space, T_end_);
     const double time_to_solution = timer.elapsed();
     // only set time if this did not happen in solve()
-    if (current_data_["quantity"].count("time to solution (s)") == 0)
-      current_data_["quantity"]["time to solution (s)"] = time_to_solution;
+    if (current_data()["quantity"].count("time to solution (s)") == 0)
+      current_data()["quantity"]["time to solution (s)"] = time_to_solution;
     // visualize
     const BS current_bochner_space(current_space, time_points_from_vector_array(solution_on_current_grid));
     visualize_(make_discrete_bochner_function(current_bochner_space, solution_on_current_grid),
@@ -275,9 +319,12 @@ public:
     auto norms_to_compute = actual_norms;
     // - norms
     if (!norms_to_compute.empty()) {
-      auto current_data_backup = current_data_;
-      self.compute_reference_solution();
-      current_data_ = current_data_backup;
+      auto current_data_backup = current_data();
+      {
+        std::lock_guard<std::mutex> lock(reference_mutex_);
+        self.compute_reference_solution();
+      }
+      current_data() = current_data_backup;
       DUNE_THROW_IF(!reference_space_, InvalidStateException, "");
       const auto& reference_space = *reference_space_;
       DUNE_THROW_IF(!reference_solution_on_reference_grid_, InvalidStateException, "");
@@ -285,9 +332,10 @@ public:
       // prolong
       const BS reference_bochner_space(reference_space,
                                        time_points_from_vector_array(*reference_solution_on_reference_grid_));
-      current_solution_on_reference_grid_ = std::make_unique<XT::LA::ListVectorArray<V>>(
+      current_solution_on_reference_grid() = std::make_unique<XT::LA::ListVectorArray<V>>(
           std::move(prolong<V>(coarse_solution, reference_bochner_space).dof_vectors()));
-      auto& u_h = *current_solution_on_reference_grid_;
+      auto& u_h = *current_solution_on_reference_grid();
+      Timer norms_timer;
       while (!norms_to_compute.empty()) {
         const auto norm_id = norms_to_compute.back();
         const auto components = XT::Common::tokenize(norm_id, "/");
@@ -314,7 +362,7 @@ public:
                      "I do not know how to compute the spatial norm '" << spatial_norm_id << "'!");
         // - temporal component
         if (temporal_norm_id == "L_infty") {
-          current_data_["norm"][norm_id] = compute_temporal_l_infty_norm(u, u_h, reference_space, spatial_norm);
+          current_data()["norm"][norm_id] = compute_temporal_l_infty_norm(u, u_h, reference_space, spatial_norm);
         } else if (temporal_norm_id == "L_2") {
           const XT::Functions::GenericFunction<1> spatial_norm_function(
               1, [&](const auto& time, const auto& /*param*/) {
@@ -324,12 +372,13 @@ public:
                     make_discrete_function(reference_space, u_t.dofs().vector() - u_h_t.dofs().vector()));
               });
           auto temporal_grid_view = reference_bochner_space.temporal_space().grid_view();
-          current_data_["norm"][norm_id] =
+          current_data()["norm"][norm_id] =
               l2_norm(temporal_grid_view, XT::Functions::make_grid_function(spatial_norm_function, temporal_grid_view));
         } else
           DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
                      "I do not know how to compute the temporal norm '" << temporal_norm_id << "'!");
       }
+      current_data()["info"]["time_norms (s)"] = norms_timer.elapsed();
     }
     DUNE_THROW_IF(!norms_to_compute.empty(),
                   XT::Common::Exceptions::wrong_input_given,
@@ -345,9 +394,9 @@ public:
       const auto id = quantities_to_compute.back();
       quantities_to_compute.pop_back();
       if (id == "time to solution (s)") {
-        DUNE_THROW_IF(current_data_["quantity"].find(id) == current_data_["quantity"].end(),
+        DUNE_THROW_IF(current_data()["quantity"].find(id) == current_data()["quantity"].end(),
                       InvalidStateException,
-                      "Could not find id " << id << "in current_data_ map");
+                      "Could not find id " << id << "in current_data map");
       } else if (id == "rel mass conserv error") {
         const auto compute_masses = [&](const auto& vec) {
           auto func = make_discrete_function(current_space, vec);
@@ -369,18 +418,18 @@ public:
           update_relative_mass_conservation_errors<m>(
               relative_mass_conservation_errors, initial_masses, current_masses);
         }
-        current_data_["quantity"][id] = relative_mass_conservation_errors.infinity_norm();
+        current_data()["quantity"][id] = relative_mass_conservation_errors.infinity_norm();
       } else if (id == "num timesteps") {
-        current_data_["quantity"][id] = static_cast<double>(solution_on_current_grid.vectors().size());
+        current_data()["quantity"][id] = static_cast<double>(solution_on_current_grid.vectors().size());
       } else if (id == "CFL") {
         DUNE_THROW_IF(this->adaptive_timestepping(), InvalidStateException, "");
         const auto time_points = this->time_points_from_vector_array(solution_on_current_grid);
         const auto dt = time_points.at(1) - time_points.at(0);
-        current_data_["quantity"][id] = dt / this->extract(current_data_, "quantity", "explicit_fv_dt");
+        current_data()["quantity"][id] = dt / this->extract(current_data(), "quantity", "explicit_fv_dt");
       } else if (id == "dt") {
         DUNE_THROW_IF(this->adaptive_timestepping(), InvalidStateException, "");
         const auto time_points = this->time_points_from_vector_array(solution_on_current_grid);
-        current_data_["quantity"][id] = time_points.at(1) - time_points.at(0);
+        current_data()["quantity"][id] = time_points.at(1) - time_points.at(0);
       } else if (id == "min dt") {
         double min_dt = std::numeric_limits<double>::max();
         const auto time_points = this->time_points_from_vector_array(solution_on_current_grid);
@@ -388,7 +437,7 @@ public:
           auto dt = time_points[ii] - time_points[ii - 1];
           min_dt = std::min(min_dt, dt);
         }
-        current_data_["quantity"][id] = min_dt;
+        current_data()["quantity"][id] = min_dt;
       } else if (id == "max dt") {
         double max_dt = std::numeric_limits<double>::min();
         const auto time_points = this->time_points_from_vector_array(solution_on_current_grid);
@@ -396,7 +445,7 @@ public:
           auto dt = time_points[ii] - time_points[ii - 1];
           max_dt = std::max(max_dt, dt);
         }
-        current_data_["quantity"][id] = max_dt;
+        current_data()["quantity"][id] = max_dt;
       } else
         DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
                    "I do not know how to compute the quantity '" << id << "'!");
@@ -404,7 +453,7 @@ public:
     DUNE_THROW_IF(!quantities_to_compute.empty(),
                   XT::Common::Exceptions::wrong_input_given,
                   "I did not know how to compute the following quantities: " << quantities_to_compute);
-    return current_data_;
+    return current_data();
   } // ... compute_on_current_refinement(...)
 
 protected:
@@ -438,13 +487,9 @@ protected:
   size_t num_refinements_;
   size_t num_additional_refinements_for_reference_;
   const std::function<void(const DiscreteBochnerFunction<V, GV, m>&, const std::string&)> visualize_;
-  size_t current_refinement_;
-  std::map<std::string, std::map<std::string, double>> current_data_;
-  std::unique_ptr<GP> current_grid_;
-  std::unique_ptr<S> current_space_;
+  std::mutex reference_mutex_;
   std::unique_ptr<GP> reference_grid_;
   std::unique_ptr<S> reference_space_;
-  std::unique_ptr<XT::LA::ListVectorArray<V>> current_solution_on_reference_grid_;
   std::unique_ptr<XT::LA::ListVectorArray<V>> reference_solution_on_reference_grid_;
 }; // struct InstationaryEocStudy
 
@@ -0,0 +1,189 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <dune/geometry/quadraturerules.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/functions/generic/grid-function.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+
+#include <dune/gdt/local/integrands/combined.hh>
+#include <dune/gdt/local/integrands/ipdg.hh>
+#include <dune/gdt/local/integrands/laplace-ipdg.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/local/integrands/product.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using I = XT::Grid::extract_intersection_t<GV>;
+using D = typename G::ctype;
+static constexpr size_t d = G::dimension;
+
+
+// evaluate_all() of the integrands with a batched implementation has to coincide with the per-point fallback
+struct BatchedIntegrandTest : public ::testing::Test
+{
+  BatchedIntegrandTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 4u))
+    , space(grid.leaf_view(), /*order=*/2)
+    , diffusion(2,
+                [](const E&) {},
+                [](const FieldVector<D, d>& x, const XT::Common::Parameter&) {
+                  return FieldMatrix<double, d, d>{{2. + x[0], 0.5 * x[1]}, {0.25, 1. + x[0] * x[1]}};
+                })
+  {
+  }
+
+  static void expect_near(const DynamicMatrix<double>& expected,
+                          const DynamicMatrix<double>& actual,
+                          const size_t rows,
+                          const size_t cols)
+  {
+    for (size_t ii = 0; ii < rows; ++ii)
+      for (size_t jj = 0; jj < cols; ++jj)
+        EXPECT_NEAR(expected[ii][jj], actual[ii][jj], 1e-12 * std::max(1., std::abs(expected[ii][jj])))
+            << "ii = " << ii << ", jj = " << jj;
+  }
+
+  template <class IntegrandType>
+  void check_element_integrand(IntegrandType integrand)
+  {
+    auto basis = space.basis().localize();
+    DynamicMatrix<double> expected, actual;
+    std::vector<double> weights;
+    for (auto&& element : elements(space.grid_view())) {
+      basis->bind(element);
+      integrand.bind(element);
+      const auto& quadrature = QuadratureRules<D, d>::rule(element.type(), integrand.order(*basis, *basis));
+      weights.resize(quadrature.size());
+      for (size_t qq = 0; qq < quadrature.size(); ++qq)
+        weights[qq] = element.geometry().integrationElement(quadrature[qq].position()) * quadrature[qq].weight();
+      integrand.evaluate_all_pointwise(*basis, *basis, quadrature, weights, expected);
+      integrand.evaluate_all(*basis, *basis, quadrature, weights, actual);
+      expect_near(expected, actual, basis->size(), basis->size());
+    }
+  } // ... check_element_integrand(...)
+
+  template <class IntegrandType>
+  void check_boundary_integrand(IntegrandType integrand)
+  {
+    auto basis = space.basis().localize();
+    DynamicMatrix<double> expected, actual;
+    std::vector<double> weights;
+    for (auto&& element : elements(space.grid_view())) {
+      basis->bind(element);
+      for (auto&& intersection : intersections(space.grid_view(), element)) {
+        if (!intersection.boundary())
+          continue;
+        integrand.bind(intersection);
+        const auto& quadrature =
+            QuadratureRules<D, d - 1>::rule(intersection.type(), integrand.order(*basis, *basis));
+        weights.resize(quadrature.size());
+        for (size_t qq = 0; qq < quadrature.size(); ++qq)
+          weights[qq] =
+              intersection.geometry().integrationElement(quadrature[qq].position()) * quadrature[qq].weight();
+        integrand.evaluate_all_pointwise(*basis, *basis, quadrature, weights, expected);
+        integrand.evaluate_all(*basis, *basis, quadrature, weights, actual);
+        expect_near(expected, actual, basis->size(), basis->size());
+      }
+    }
+  } // ... check_boundary_integrand(...)
+
+  template <class IntegrandType>
+  void check_coupling_integrand(IntegrandType integrand)
+  {
+    auto basis_in = space.basis().localize();
+    auto basis_out = space.basis().localize();
+    std::array<DynamicMatrix<double>, 4> expected, actual;
+    std::vector<double> weights;
+    for (auto&& element : elements(space.grid_view())) {
+      basis_in->bind(element);
+      for (auto&& intersection : intersections(space.grid_view(), element)) {
+        if (!intersection.neighbor())
+          continue;
+        basis_out->bind(intersection.outside());
+        integrand.bind(intersection);
+        const auto& quadrature = QuadratureRules<D, d - 1>::rule(
+            intersection.type(), integrand.order(*basis_in, *basis_in, *basis_out, *basis_out));
+        weights.resize(quadrature.size());
+        for (size_t qq = 0; qq < quadrature.size(); ++qq)
+          weights[qq] =
+              intersection.geometry().integrationElement(quadrature[qq].position()) * quadrature[qq].weight();
+        integrand.evaluate_all_pointwise(*basis_in,
+                                         *basis_in,
+                                         *basis_out,
+                                         *basis_out,
+                                         quadrature,
+                                         weights,
+                                         expected[0],
+                                         expected[1],
+                                         expected[2],
+                                         expected[3]);
+        integrand.evaluate_all(*basis_in,
+                               *basis_in,
+                               *basis_out,
+                               *basis_out,
+                               quadrature,
+                               weights,
+                               actual[0],
+                               actual[1],
+                               actual[2],
+                               actual[3]);
+        for (size_t ii = 0; ii < 4; ++ii)
+          expect_near(expected[ii], actual[ii], basis_in->size(), basis_in->size());
+      }
+    }
+  } // ... check_coupling_integrand(...)
+
+  XT::Grid::GridProvider<G> grid;
+  const DiscontinuousLagrangeSpace<GV> space;
+  const XT::Functions::GenericGridFunction<E, d, d> diffusion;
+}; // struct BatchedIntegrandTest
+
+
+TEST_F(BatchedIntegrandTest, laplace)
+{
+  this->check_element_integrand(LocalLaplaceIntegrand<E>(diffusion));
+}
+TEST_F(BatchedIntegrandTest, product)
+{
+  this->check_element_integrand(LocalElementProductIntegrand<E>(2.));
+}
+TEST_F(BatchedIntegrandTest, laplace_plus_product)
+{
+  this->check_element_integrand(LocalLaplaceIntegrand<E>(diffusion) + LocalElementProductIntegrand<E>());
+}
+TEST_F(BatchedIntegrandTest, ipdg_inner_penalty)
+{
+  this->check_coupling_integrand(LocalIPDGIntegrands::InnerPenalty<I>(8., diffusion));
+}
+TEST_F(BatchedIntegrandTest, ipdg_boundary_penalty)
+{
+  this->check_boundary_integrand(LocalIPDGIntegrands::BoundaryPenalty<I>(14., diffusion));
+}
+TEST_F(BatchedIntegrandTest, laplace_ipdg_inner_coupling)
+{
+  this->check_coupling_integrand(LocalLaplaceIPDGIntegrands::InnerCoupling<I>(1., diffusion, diffusion));
+}
+TEST_F(BatchedIntegrandTest, laplace_ipdg_dirichlet_coupling)
+{
+  this->check_boundary_integrand(LocalLaplaceIPDGIntegrands::DirichletCoupling<I>(1., diffusion));
+}
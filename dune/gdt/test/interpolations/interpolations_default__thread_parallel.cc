@@ -0,0 +1,94 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <vector>
+
+#include <dune/xt/common/parallel/threadmanager.hh>
+#include <dune/xt/functions/generic/function.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/interpolations/default.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+#include <dune/gdt/tools/dof-ownership.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using V = XT::LA::IstlDenseVector<double>;
+
+
+// Interpolates with the walker split into as many partitions as threads were requested, restores the thread count.
+template <class SpaceType>
+static V interpolate_with_threads(const SpaceType& space, const size_t num_threads)
+{
+  const XT::Functions::GenericFunction<2> source(
+      2, [](const auto& x, const auto&) { return 2 * x[0] * x[0] - x[0] * x[1] + 0.5 * x[1] + 3; });
+  const auto threads_before = XT::Common::threadManager().max_threads();
+  XT::Common::threadManager().set_max_threads(num_threads);
+  auto target = default_interpolation<V>(source, space);
+  XT::Common::threadManager().set_max_threads(threads_before);
+  return target.dofs().vector();
+}
+
+
+// Each DoF of a continuous space is shared between several elements, but has to be owned by exactly one of them.
+GTEST_TEST(interpolations_default__thread_parallel, every_dof_has_exactly_one_owner)
+{
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 8u);
+  const auto grid_view = grid.leaf_view();
+  const auto space = make_continuous_lagrange_space(grid_view, 2);
+  const DofOwnership<GV> ownership(space.mapper(), grid_view);
+  ASSERT_EQ(space.mapper().size(), ownership.size());
+
+  std::vector<size_t> owner_count(space.mapper().size(), 0);
+  for (auto&& element : elements(grid_view)) {
+    const auto global_indices = space.mapper().global_indices(element);
+    for (size_t ii = 0; ii < global_indices.size(); ++ii)
+      if (ownership.owns(element, global_indices[ii]))
+        ++owner_count[global_indices[ii]];
+  }
+  for (size_t ii = 0; ii < owner_count.size(); ++ii)
+    EXPECT_EQ(1u, owner_count[ii]) << "global DoF " << ii;
+}
+
+
+// Owner-computes makes the result independent of the partitioning of the grid walk, i.e. of the number of threads.
+GTEST_TEST(interpolations_default__thread_parallel, continuous_lagrange_is_independent_of_thread_count)
+{
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 8u);
+  const auto space = make_continuous_lagrange_space(grid.leaf_view(), 2);
+  const auto reference = interpolate_with_threads(space, 1);
+  for (size_t num_threads : {2, 3, 4, 8}) {
+    const auto result = interpolate_with_threads(space, num_threads);
+    ASSERT_EQ(reference.size(), result.size());
+    for (size_t ii = 0; ii < reference.size(); ++ii)
+      EXPECT_EQ(reference[ii], result[ii]) << "global DoF " << ii << " with " << num_threads << " threads";
+  }
+}
+
+
+GTEST_TEST(interpolations_default__thread_parallel, discontinuous_lagrange_is_independent_of_thread_count)
+{
+  auto grid = XT::Grid::make_cube_grid<G>(0., 1., 8u);
+  const auto space = make_discontinuous_lagrange_space(grid.leaf_view(), 2);
+  const auto reference = interpolate_with_threads(space, 1);
+  for (size_t num_threads : {2, 3, 4, 8}) {
+    const auto result = interpolate_with_threads(space, num_threads);
+    ASSERT_EQ(reference.size(), result.size());
+    for (size_t ii = 0; ii < reference.size(); ++ii)
+      EXPECT_EQ(reference[ii], result[ii]) << "global DoF " << ii << " with " << num_threads << " threads";
+  }
+}
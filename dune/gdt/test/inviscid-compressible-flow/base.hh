@@ -375,13 +375,13 @@ protected:
       dt = this->estimate_fixed_explicit_dt_to_T_end(
           space, DXTC_TEST_CONFIG_GET("setup.estimate_fixed_explicit_dt.min_dt", 1e-2) * dt, T_end);
     }
-    this->current_data_["quantity"]["dt"] = dt;
-    this->current_data_["quantity"]["explicit_fv_dt"] = fv_dt;
+    this->current_data()["quantity"]["dt"] = dt;
+    this->current_data()["quantity"]["explicit_fv_dt"] = fv_dt;
     Timer timer;
     const auto op = this->make_lhs_operator(space);
     auto solution =
         solve_instationary_system_explicit_euler(u_0, *op, T_end, DXTC_TEST_CONFIG_GET("setup.dt_factor", 0.99) * dt);
-    this->current_data_["quantity"]["time to solution (s)"] = timer.elapsed();
+    this->current_data()["quantity"]["time to solution (s)"] = timer.elapsed();
     return solution;
   }
 }; // class InviscidCompressibleFlowEulerExplicitTest
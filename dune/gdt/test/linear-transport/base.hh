@@ -186,9 +186,9 @@ protected:
   {
     auto u_0 = this->make_initial_values(space);
     const auto op = this->make_lhs_operator(space);
-    const auto dt = this->current_data_["target"]["h"];
-    this->current_data_["quantity"]["dt"] = dt;
-    this->current_data_["quantity"]["explicit_fv_dt"] = this->estimate_fixed_explicit_fv_dt(space);
+    const auto dt = this->current_data()["target"]["h"];
+    this->current_data()["quantity"]["dt"] = dt;
+    this->current_data()["quantity"]["explicit_fv_dt"] = this->estimate_fixed_explicit_fv_dt(space);
     return solve_instationary_system_explicit_euler(u_0, *op, T_end, dt);
   }
 }; // class LinearTransportExplicitTest
@@ -212,9 +212,9 @@ protected:
   {
     const auto u_0 = this->make_initial_values(space);
     const auto op = this->make_lhs_operator(space);
-    const auto dt = dt_factor_ * this->current_data_["target"]["h"];
-    this->current_data_["quantity"]["dt"] = dt;
-    this->current_data_["quantity"]["explicit_fv_dt"] = this->estimate_fixed_explicit_fv_dt(space);
+    const auto dt = dt_factor_ * this->current_data()["target"]["h"];
+    this->current_data()["quantity"]["dt"] = dt;
+    this->current_data()["quantity"]["explicit_fv_dt"] = this->estimate_fixed_explicit_fv_dt(space);
     return solve_instationary_system_implicit_euler(u_0, *op, T_end, dt);
   }
 
@@ -63,8 +63,8 @@ protected:
     const auto u_0 = this->make_initial_values(space);
     const auto op = this->make_lhs_operator(space);
     const auto dt = this->estimate_fixed_explicit_fv_dt(space);
-    this->current_data_["quantity"]["dt"] = dt;
-    this->current_data_["quantity"]["explicit_fv_dt"] = dt;
+    this->current_data()["quantity"]["dt"] = dt;
+    this->current_data()["quantity"]["explicit_fv_dt"] = dt;
     return solve_instationary_system_explicit_euler(u_0, *op, T_end, dt);
   }
 }; // class LinearTransport1dExplicitWithAutomaticDtTest
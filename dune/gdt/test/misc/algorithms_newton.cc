@@ -303,3 +303,91 @@ GTEST_TEST(algorithms_newton, throws_if_the_dampening_does_not_converge)
   // the jacobian was required to obtain the update whose dampening then failed
   EXPECT_EQ(1u, op.num_jacobians());
 }
+
+
+// The returned info has to contain one entry per iteration (and the final residual).
+GTEST_TEST(algorithms_newton, returns_per_iteration_info)
+{
+  auto grid = make_grid();
+  auto grid_view = grid.leaf_view();
+  const auto space = make_finite_volume_space(grid_view);
+  const SquareOperator op(space);
+
+  const size_t n = space.mapper().size();
+  const V rhs(n, 2.);
+  V u(n, 1.);
+
+  const auto info = newton_solve(op, rhs, u);
+
+  const size_t num_iterations = info.num_iterations();
+  EXPECT_EQ(op.num_jacobians(), num_iterations); // <- a new jacobian in each iteration by default
+  EXPECT_EQ(num_iterations, info.num_jacobians);
+  EXPECT_EQ(num_iterations + 1, info.residual_norms.size());
+  EXPECT_EQ(num_iterations + 1, info.residual_timings.size());
+  EXPECT_EQ(num_iterations, info.jacobian_timings.size());
+  EXPECT_EQ(num_iterations, info.jacobian_ages.size());
+  EXPECT_EQ(num_iterations, info.linear_solver_timings.size());
+  EXPECT_EQ(num_iterations, info.linear_solver_precisions.size());
+  EXPECT_EQ(num_iterations, info.linear_solver_types.size());
+  EXPECT_EQ(num_iterations, info.update_timings.size());
+  EXPECT_EQ(num_iterations, info.dampenings.size());
+  for (size_t ll = 0; ll < num_iterations; ++ll) {
+    EXPECT_LT(info.residual_norms[ll + 1], info.residual_norms[ll]) << "ll = " << ll;
+    EXPECT_EQ(0u, info.jacobian_ages[ll]) << "ll = " << ll;
+  }
+  EXPECT_LT(info.residual_norms.back(), 1e-7);
+}
+
+
+// A lagged jacobian has to converge to the same root with fewer jacobians (but usually more iterations).
+GTEST_TEST(algorithms_newton, converges_with_a_lagged_jacobian)
+{
+  auto grid = make_grid();
+  auto grid_view = grid.leaf_view();
+  const auto space = make_finite_volume_space(grid_view);
+  const SquareOperator newton_op(space);
+  const SquareOperator lagged_op(space);
+
+  const size_t n = space.mapper().size();
+  const V rhs(n, 2.);
+
+  V newton_u(n, 1.5);
+  newton_solve(newton_op, rhs, newton_u);
+
+  auto opts = default_newton_solve_options();
+  opts["jacobian_lag"] = "100";
+  opts["jacobian_max_contraction"] = "1";
+  V lagged_u(n, 1.5);
+  const auto info = newton_solve(lagged_op, rhs, lagged_u, {}, opts);
+
+  for (size_t ii = 0; ii < n; ++ii)
+    EXPECT_NEAR(std::sqrt(2.), lagged_u.get_entry(ii), 1e-6);
+  EXPECT_LT(lagged_op.num_jacobians(), newton_op.num_jacobians());
+  EXPECT_EQ(lagged_op.num_jacobians(), info.num_jacobians);
+  EXPECT_GT(info.num_iterations(), info.num_jacobians);
+}
+
+
+// Eisenstat-Walker forcing terms have to adapt the linear precision while still converging to the root.
+GTEST_TEST(algorithms_newton, converges_with_eisenstat_walker_forcing)
+{
+  auto grid = make_grid();
+  auto grid_view = grid.leaf_view();
+  const auto space = make_finite_volume_space(grid_view);
+  const SquareOperator op(space);
+
+  const size_t n = space.mapper().size();
+  const V rhs(n, 2.);
+  V u(n, 1.);
+
+  auto opts = default_newton_solve_options();
+  opts["forcing"] = "eisenstat_walker";
+  const auto info = newton_solve(op, rhs, u, {}, opts);
+
+  for (size_t ii = 0; ii < n; ++ii)
+    EXPECT_NEAR(std::sqrt(2.), u.get_entry(ii), 1e-6);
+  ASSERT_GT(info.num_iterations(), 0u);
+  EXPECT_DOUBLE_EQ(0.5, info.linear_solver_precisions.at(0)); // <- forcing.eta_0
+  for (const auto& eta : info.linear_solver_precisions)
+    EXPECT_LE(eta, 0.9); // <- forcing.eta_max
+}
@@ -0,0 +1,88 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/functions/generic/function.hh>
+#include <dune/xt/la/container/common.hh>
+
+#include <dune/gdt/interpolations/default.hh>
+#include <dune/gdt/prolongations.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using V = XT::LA::CommonDenseVector<double>;
+
+
+/// Prolongs from level 0 onto the leaf view (two refinements further), where the grid hierarchy is used.
+struct ProlongationAlongGridHierarchyTest : public ::testing::Test
+{
+  ProlongationAlongGridHierarchyTest()
+    : grid_provider_(XT::Grid::make_cube_grid<G>(0., 1., 2u))
+    , function_(2, [](const auto& x, const auto& /*param*/) { return x[0] * x[0] + 3. * x[0] * x[1] + 1.; })
+  {
+    grid_provider_.global_refine(2);
+  }
+
+  template <class CoarseSpace, class FineSpace>
+  void check(const CoarseSpace& coarse_space, const FineSpace& fine_space)
+  {
+    const auto coarse_function = default_interpolation<V>(function_, coarse_space);
+    auto prolonged_function = make_discrete_function<V>(fine_space);
+    ASSERT_TRUE(internal::prolong_along_grid_hierarchy(coarse_function, prolonged_function, fine_space.grid_view()));
+    // the function is quadratic, so the prolongation has to coincide with the interpolation on the fine grid ...
+    const auto fine_function = default_interpolation<V>(function_, fine_space);
+    for (size_t ii = 0; ii < fine_space.mapper().size(); ++ii)
+      EXPECT_NEAR(fine_function.dofs().vector()[ii], prolonged_function.dofs().vector()[ii], 1e-13) << "ii = " << ii;
+    // ... and with the prolongation via a point search
+    auto searched_function = make_discrete_function<V>(fine_space);
+    default_interpolation(
+        reinterpret(coarse_function, fine_space.grid_view()), searched_function, fine_space.grid_view());
+    for (size_t ii = 0; ii < fine_space.mapper().size(); ++ii)
+      EXPECT_NEAR(searched_function.dofs().vector()[ii], prolonged_function.dofs().vector()[ii], 1e-13)
+          << "ii = " << ii;
+  } // ... check(...)
+
+  XT::Grid::GridProvider<G> grid_provider_;
+  const XT::Functions::GenericFunction<2> function_;
+}; // struct ProlongationAlongGridHierarchyTest
+
+
+TEST_F(ProlongationAlongGridHierarchyTest, discontinuous_lagrange)
+{
+  const auto coarse_space = make_discontinuous_lagrange_space(grid_provider_.level_view(0), 2);
+  const auto fine_space = make_discontinuous_lagrange_space(grid_provider_.leaf_view(), 2);
+  this->check(coarse_space, fine_space);
+}
+
+TEST_F(ProlongationAlongGridHierarchyTest, continuous_lagrange)
+{
+  const auto coarse_space = make_continuous_lagrange_space(grid_provider_.level_view(0), 2);
+  const auto fine_space = make_continuous_lagrange_space(grid_provider_.leaf_view(), 2);
+  this->check(coarse_space, fine_space);
+}
+
+TEST_F(ProlongationAlongGridHierarchyTest, is_not_used_for_unrelated_grids)
+{
+  auto other_grid_provider = XT::Grid::make_cube_grid<G>(0., 1., 8u);
+  const auto coarse_space = make_discontinuous_lagrange_space(grid_provider_.level_view(0), 1);
+  const auto fine_space = make_discontinuous_lagrange_space(other_grid_provider.leaf_view(), 1);
+  const auto coarse_function = default_interpolation<V>(function_, coarse_space);
+  auto prolonged_function = make_discrete_function<V>(fine_space);
+  EXPECT_FALSE(internal::prolong_along_grid_hierarchy(coarse_function, prolonged_function, fine_space.grid_view()));
+  // prolong() falls back to the point search
+  prolong(coarse_function, prolonged_function);
+  EXPECT_GT(prolonged_function.dofs().vector().sup_norm(), 0.);
+}
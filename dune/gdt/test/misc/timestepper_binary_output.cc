@@ -0,0 +1,120 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <cmath>
+#include <cstdio>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+
+#include <dune/gdt/discretefunction/default.hh>
+#include <dune/gdt/operators/identity.hh>
+#include <dune/gdt/spaces/l2/finite-volume.hh>
+#include <dune/gdt/tools/timestepper/binary-output.hh>
+#include <dune/gdt/tools/timestepper/explicit-rungekutta.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_1D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using OperatorType = IdentityOperator<GV>;
+using V = typename OperatorType::VectorType;
+using DF = DiscreteFunction<V, GV>;
+using StepperType = ExplicitRungeKuttaTimeStepper<OperatorType, DF, TimeStepperMethods::explicit_euler>;
+
+
+GTEST_TEST(BinaryDofFileTest, round_trip)
+{
+  // long runs of equal values (compressible) followed by values without any structure
+  std::vector<double> values(1000, 1.);
+  for (size_t ii = 500; ii < values.size(); ++ii)
+    values[ii] = std::sin(double(ii));
+  std::vector<char> buffer;
+  for (const bool compress : {false, true}) {
+    BinaryDofFile<double>::write("binary_dof_file_test.dofs", values, 0.25, 7, compress, buffer);
+    std::vector<double> read_values;
+    const auto time_and_step = BinaryDofFile<double>::read("binary_dof_file_test.dofs", read_values);
+    EXPECT_EQ(0.25, time_and_step.first);
+    EXPECT_EQ(size_t(7), time_and_step.second);
+    ASSERT_EQ(values.size(), read_values.size());
+    for (size_t ii = 0; ii < values.size(); ++ii)
+      EXPECT_EQ(values[ii], read_values[ii]) << "compress = " << compress << ", ii = " << ii;
+  }
+  EXPECT_LT(buffer.size(), values.size() * sizeof(double));
+  std::remove("binary_dof_file_test.dofs");
+}
+
+
+/// Solves u' = -u, u(0) = 1 as in timestepper_explicit_rungekutta.cc.
+struct TimeStepperBinaryOutputTest : public ::testing::Test
+{
+  void SetUp() override
+  {
+    grid_provider_ = std::make_unique<XT::Grid::GridProvider<G>>(XT::Grid::make_cube_grid<G>(0., 1., 4u));
+    space_ = std::make_unique<FiniteVolumeSpace<GV>>(grid_provider_->leaf_view());
+    op_ = std::make_unique<OperatorType>(*space_);
+    initial_values_ = std::make_unique<DF>(*space_);
+    for (size_t ii = 0; ii < space_->mapper().size(); ++ii)
+      initial_values_->dofs().vector()[ii] = 1. + ii;
+  }
+
+  std::unique_ptr<XT::Grid::GridProvider<G>> grid_provider_;
+  std::unique_ptr<FiniteVolumeSpace<GV>> space_;
+  std::unique_ptr<OperatorType> op_;
+  std::unique_ptr<DF> initial_values_;
+}; // struct TimeStepperBinaryOutputTest
+
+
+TEST_F(TimeStepperBinaryOutputTest, spilled_solution_coincides_with_saved_solution)
+{
+  DF in_memory_values(*space_, initial_values_->dofs().vector().copy());
+  StepperType in_memory(*op_, in_memory_values, /*r=*/-1.);
+  in_memory.solve(/*t_end=*/1., /*dt=*/1e-2, /*num_save_steps=*/4, in_memory.solution());
+  StepperType spilling(*op_, *initial_values_, /*r=*/-1.);
+  spilling.enable_spill_to_disk("spilled_solution", /*compress=*/true);
+  spilling.solve(/*t_end=*/1., /*dt=*/1e-2, /*num_save_steps=*/4, spilling.solution());
+  EXPECT_TRUE(spilling.solution().empty());
+  ASSERT_EQ(in_memory.solution().size(), spilling.spilled_solution().size());
+  for (const auto& time_and_solution : in_memory.solution()) {
+    const auto loaded = spilling.load_spilled_solution(time_and_solution.first);
+    const auto& expected = time_and_solution.second->dofs().vector();
+    for (size_t ii = 0; ii < expected.size(); ++ii)
+      EXPECT_EQ(expected[ii], loaded->dofs().vector()[ii]) << "t = " << time_and_solution.first << ", ii = " << ii;
+  }
+  for (const auto& time_and_filename : spilling.spilled_solution())
+    std::remove(time_and_filename.second.c_str());
+}
+
+TEST_F(TimeStepperBinaryOutputTest, writes_binary_files_instead_of_text_files)
+{
+  StepperType stepper(*op_, *initial_values_, /*r=*/-1.);
+  stepper.enable_binary_output();
+  stepper.solve(/*t_end=*/1.,
+                /*dt=*/1e-2,
+                /*num_save_steps=*/4,
+                /*num_output_steps=*/0,
+                /*save_solution=*/false,
+                /*visualize=*/false,
+                /*write_discrete=*/true,
+                /*write_exact=*/false,
+                /*reset_begin_time=*/true,
+                "binary_output");
+  std::vector<double> values;
+  for (size_t step = 0; step <= 4; ++step) {
+    const auto filename = StepperType::rankfile_name("binary_output", 0, step, ".dofs");
+    const auto time_and_step = BinaryDofFile<double>::read(filename, values);
+    EXPECT_NEAR(0.25 * step, time_and_step.first, 1e-12);
+    EXPECT_EQ(step, time_and_step.second);
+    std::remove(filename.c_str());
+  }
+  ASSERT_EQ(space_->mapper().size(), values.size());
+  for (size_t ii = 0; ii < values.size(); ++ii)
+    EXPECT_EQ(stepper.current_solution().dofs().vector()[ii], values[ii]) << "ii = " << ii;
+}
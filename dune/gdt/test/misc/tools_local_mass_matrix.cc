@@ -13,12 +13,20 @@
 
 #include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
 
+#include <array>
+#include <cmath>
+#include <vector>
+
 #include <dune/grid/common/rangegenerators.hh>
+#include <dune/grid/yaspgrid.hh>
 
 #include <dune/xt/grid/grids.hh>
 #include <dune/xt/grid/gridprovider/cube.hh>
 #include <dune/xt/grid/walker.hh>
 
+#include <dune/xt/la/container/common.hh>
+
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
 #include <dune/gdt/spaces/l2/finite-volume.hh>
 #include <dune/gdt/tools/local-mass-matrix.hh>
 
@@ -56,3 +64,48 @@ GTEST_TEST(local_mass_matrix, finite_volume_local_mass_matrix_equals_element_vol
     EXPECT_DOUBLE_EQ(1. / volume, mass_matrix_inverse.get_entry(0, 0));
   }
 }
+
+GTEST_TEST(local_mass_matrix, compressed_storage_coincides_with_stored_matrices)
+{
+  // all elements are affine, but of different size and aspect ratio, so each one uses the reference matrices with its
+  // own scaling
+  using TensorGridType = YaspGrid<2, TensorProductCoordinates<double, 2>>;
+  using TensorGridViewType = typename TensorGridType::LeafGridView;
+  const std::array<std::vector<double>, 2> coordinates{{{0., 0.1, 0.3, 0.6, 1.}, {0., 0.05, 0.5, 0.75, 1.}}};
+  TensorGridType grid(coordinates);
+  auto grid_view = grid.leafGridView();
+  auto dg_space = make_discontinuous_lagrange_space(grid_view, /*order=*/2);
+
+  LocalMassMatrixProvider<TensorGridViewType> stored(grid_view, dg_space);
+  LocalMassMatrixProvider<TensorGridViewType> compressed(grid_view, dg_space, /*compressed=*/true);
+  auto walker = XT::Grid::make_walker(grid_view);
+  walker.append(stored);
+  walker.append(compressed);
+  walker.walk(/*use_tbb=*/true);
+
+  for (auto&& element : elements(grid_view)) {
+    const auto expected_matrix = stored.local_mass_matrix(element);
+    const auto expected_inverse = stored.local_mass_matrix_inverse(element);
+    const auto actual_matrix = compressed.local_mass_matrix(element);
+    const auto actual_inverse = compressed.local_mass_matrix_inverse(element);
+    ASSERT_EQ(expected_matrix.rows(), actual_matrix.rows());
+    ASSERT_EQ(expected_matrix.cols(), actual_matrix.cols());
+    for (size_t ii = 0; ii < expected_matrix.rows(); ++ii)
+      for (size_t jj = 0; jj < expected_matrix.cols(); ++jj) {
+        EXPECT_NEAR(expected_matrix.get_entry(ii, jj), actual_matrix.get_entry(ii, jj), 1e-15);
+        EXPECT_NEAR(expected_inverse.get_entry(ii, jj),
+                    actual_inverse.get_entry(ii, jj),
+                    1e-12 * std::abs(expected_inverse.get_entry(ii, jj)) + 1e-12);
+      }
+    // the in-place application adds to the result
+    XT::LA::CommonDenseVector<double> local_dofs(expected_matrix.cols(), 0.);
+    for (size_t ii = 0; ii < local_dofs.size(); ++ii)
+      local_dofs[ii] = 1. + ii;
+    XT::LA::CommonDenseVector<double> expected_result(expected_matrix.rows(), 1.);
+    expected_result += expected_inverse * local_dofs;
+    XT::LA::CommonDenseVector<double> actual_result(expected_matrix.rows(), 1.);
+    compressed.apply_inverse(element, local_dofs, actual_result);
+    for (size_t ii = 0; ii < expected_result.size(); ++ii)
+      EXPECT_NEAR(expected_result[ii], actual_result[ii], 1e-10 * std::abs(expected_result[ii]));
+  }
+}
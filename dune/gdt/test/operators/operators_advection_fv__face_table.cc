@@ -0,0 +1,149 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+
+#include <tbb/global_control.h>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/view/periodic.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/data/burgers.hh>
+#include <dune/gdt/local/numerical-fluxes/generic.hh>
+#include <dune/gdt/local/numerical-fluxes/upwind.hh>
+#include <dune/gdt/operators/advection-fv.hh>
+#include <dune/gdt/spaces/l2/finite-volume.hh>
+#include <dune/gdt/tools/finite-volume-face-table.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_1D_EQUIDISTANT_OFFSET;
+using V = XT::LA::IstlDenseVector<double>;
+
+
+struct AdvectionFvFaceTableTest : public ::testing::Test
+{
+  AdvectionFvFaceTableTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 64u))
+  {
+  }
+
+  static V make_source(const size_t size, const double shift)
+  {
+    V source(size, 0.);
+    for (size_t ii = 0; ii < size; ++ii)
+      source.set_entry(ii, std::sin(double(ii) + shift) + 0.5);
+    return source;
+  }
+
+  // op uses the face table, reference does not
+  template <class OperatorType, class SpaceType>
+  static void face_table_coincides_with_default(const OperatorType& op,
+                                                const OperatorType& reference,
+                                                const SpaceType& space)
+  {
+    // repeat with different sources to make sure the table is reused correctly
+    for (size_t run = 0; run < 3; ++run) {
+      const auto source = make_source(space.mapper().size(), double(run));
+      V expected(space.mapper().size(), 0.);
+      reference.apply(source, expected, {{"t", {double(run)}}});
+      const tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism, 4);
+      V actual(space.mapper().size(), 1.);
+      op.apply(source, actual, {{"t", {double(run)}}});
+      for (size_t ii = 0; ii < expected.size(); ++ii)
+        EXPECT_NEAR(expected.get_entry(ii),
+                    actual.get_entry(ii),
+                    1e-13 * std::max(1., std::abs(expected.get_entry(ii))))
+            << "run = " << run << ", ii = " << ii;
+    }
+  } // ... face_table_coincides_with_default(...)
+
+  const Data::BurgersProblem<G> problem;
+  XT::Grid::GridProvider<G> grid;
+}; // struct AdvectionFvFaceTableTest
+
+
+TEST_F(AdvectionFvFaceTableTest, table_is_consistent)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  const FiniteVolumeFaceTable<GV> table(
+      periodic_grid_view,
+      *(XT::Grid::ApplyOn::InnerIntersectionsOnce<GV>() || XT::Grid::ApplyOn::PeriodicBoundaryIntersectionsOnce<GV>()));
+  EXPECT_EQ(64u, table.num_cells());
+  EXPECT_EQ(64u, table.num_faces());
+  EXPECT_TRUE(table.valid(periodic_grid_view));
+  for (size_t cc = 0; cc < table.num_cells(); ++cc) {
+    EXPECT_EQ(2u, table.cell_face_offsets()[cc + 1] - table.cell_face_offsets()[cc]) << "cc = " << cc;
+    // the weights of each cell sum up to zero in 1d
+    double sum = 0.;
+    for (size_t kk = table.cell_face_offsets()[cc]; kk < table.cell_face_offsets()[cc + 1]; ++kk)
+      sum += table.cell_face_weights()[kk];
+    EXPECT_NEAR(0., sum, 1e-12) << "cc = " << cc;
+  }
+}
+
+TEST_F(AdvectionFvFaceTableTest, periodic_burgers_fv)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  const auto reference = make_advection_fv_operator(space, numerical_flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  op.use_face_table();
+  face_table_coincides_with_default(op, reference, space);
+}
+
+TEST_F(AdvectionFvFaceTableTest, burgers_fv_with_boundary_treatment)
+{
+  auto grid_view = grid.leaf_view();
+  using GV = decltype(grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  const auto boundary_flux = [](const auto& intersection, const auto& xx, const auto& u, auto& g, const auto&) {
+    g = u;
+    g *= 0.5 * u[0] * intersection.unitOuterNormal(xx)[0];
+  };
+  auto reference = make_advection_fv_operator(space, numerical_flux);
+  reference.boundary_treatment(boundary_flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  op.use_face_table().boundary_treatment(boundary_flux);
+  face_table_coincides_with_default(op, reference, space);
+}
+
+TEST_F(AdvectionFvFaceTableTest, falls_back_for_intersection_dependent_fluxes)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  // a central flux, but the lambda could depend on the intersection
+  const GenericNumericalFlux<I, 1, 1> numerical_flux(
+      problem.flux,
+      [](const auto& /*intersection*/, const auto& /*x*/, const auto& u, const auto& v, const auto& n, const auto&) {
+        auto ret = u;
+        ret[0] = 0.25 * (u[0] * u[0] + v[0] * v[0]) * n[0];
+        return ret;
+      });
+  EXPECT_TRUE(numerical_flux.intersection_dependent());
+  const auto reference = make_advection_fv_operator(space, numerical_flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  op.use_face_table();
+  face_table_coincides_with_default(op, reference, space);
+}
@@ -0,0 +1,100 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/view/periodic.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/data/burgers.hh>
+#include <dune/gdt/local/numerical-fluxes/lax-friedrichs.hh>
+#include <dune/gdt/local/numerical-fluxes/upwind.hh>
+#include <dune/gdt/operators/advection-fv.hh>
+#include <dune/gdt/spaces/l2/finite-volume.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_1D_EQUIDISTANT_OFFSET;
+using V = XT::LA::IstlDenseVector<double>;
+
+
+struct AdvectionFvJacobianTest : public ::testing::Test
+{
+  AdvectionFvJacobianTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 32u))
+  {
+  }
+
+  template <class OperatorType, class SpaceType>
+  static void analytical_jacobian_coincides_with_finite_differences(const OperatorType& op, const SpaceType& space)
+  {
+    ASSERT_EQ("analytical", op.jacobian_options().at(0));
+    V source(space.mapper().size(), 0.);
+    for (size_t ii = 0; ii < source.size(); ++ii)
+      source.set_entry(ii, std::sin(double(ii)) + 0.5);
+    auto expected = op.jacobian(source, "finite-differences");
+    expected.assemble();
+    auto actual = op.jacobian(source, "analytical");
+    actual.assemble();
+    for (size_t ii = 0; ii < source.size(); ++ii)
+      for (size_t jj = 0; jj < source.size(); ++jj)
+        EXPECT_NEAR(expected.matrix().get_entry(ii, jj), actual.matrix().get_entry(ii, jj), 1e-5)
+            << "ii = " << ii << ", jj = " << jj;
+  } // ... analytical_jacobian_coincides_with_finite_differences(...)
+
+  const Data::BurgersProblem<G> problem;
+  XT::Grid::GridProvider<G> grid;
+}; // struct AdvectionFvJacobianTest
+
+
+TEST_F(AdvectionFvJacobianTest, periodic_burgers_fv_upwind)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  const auto op = make_advection_fv_operator(space, numerical_flux);
+  analytical_jacobian_coincides_with_finite_differences(op, space);
+}
+
+TEST_F(AdvectionFvJacobianTest, periodic_burgers_fv_lax_friedrichs)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  // a fixed lambda, otherwise the flux is not differentiable where the maximal wave speed changes
+  const NumericalLaxFriedrichsFlux<I, 1, 1> numerical_flux(problem.flux, /*lambda=*/0.5);
+  const auto op = make_advection_fv_operator(space, numerical_flux);
+  analytical_jacobian_coincides_with_finite_differences(op, space);
+}
+
+TEST_F(AdvectionFvJacobianTest, falls_back_to_finite_differences_for_boundary_treatments)
+{
+  auto grid_view = grid.leaf_view();
+  using GV = decltype(grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  EXPECT_EQ("analytical", op.jacobian_options().at(0));
+  op.boundary_treatment([](const auto& intersection, const auto& xx, const auto& u, auto& g, const auto& /*param*/) {
+    g = u;
+    g *= 0.5 * u[0] * intersection.unitOuterNormal(xx)[0];
+  });
+  EXPECT_EQ(std::vector<std::string>({"finite-differences"}), op.jacobian_options());
+}
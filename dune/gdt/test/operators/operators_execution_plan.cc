@@ -0,0 +1,142 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+
+#include <dune/xt/common/parallel/threadmanager.hh>
+#include <dune/xt/grid/filters/intersection.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/type_traits.hh>
+#include <dune/xt/grid/view/periodic.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/data/burgers.hh>
+#include <dune/gdt/discretefunction/default.hh>
+#include <dune/gdt/local/numerical-fluxes/upwind.hh>
+#include <dune/gdt/local/operators/generic.hh>
+#include <dune/gdt/operators/advection-fv.hh>
+#include <dune/gdt/spaces/l2/finite-volume.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_1D_EQUIDISTANT_OFFSET;
+using V = XT::LA::IstlDenseVector<double>;
+
+
+struct OperatorExecutionPlanTest : public ::testing::Test
+{
+  OperatorExecutionPlanTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 64u))
+  {
+  }
+
+  static V make_source(const size_t size, const double shift)
+  {
+    V source(size, 0.);
+    for (size_t ii = 0; ii < size; ++ii)
+      source.set_entry(ii, std::sin(double(ii) + shift) + 0.5);
+    return source;
+  }
+
+  // applying to a vector uses the execution plan, applying to a grid function walks the grid
+  template <class OperatorType, class SpaceType>
+  static void plan_coincides_with_walker(const OperatorType& op, const SpaceType& space)
+  {
+    // repeat with different sources to make sure the plan picks up the current one
+    for (size_t run = 0; run < 3; ++run) {
+      const auto source = make_source(space.mapper().size(), double(run));
+      V expected(space.mapper().size(), 0.);
+      op.apply(make_discrete_function(space, source), expected, {{"t", {double(run)}}});
+      V actual(space.mapper().size(), 1.);
+      op.apply(source, actual, {{"t", {double(run)}}});
+      for (size_t ii = 0; ii < expected.size(); ++ii)
+        EXPECT_NEAR(expected.get_entry(ii),
+                    actual.get_entry(ii),
+                    1e-14 * std::max(1., std::abs(expected.get_entry(ii))))
+            << "run = " << run << ", ii = " << ii;
+    }
+  } // ... plan_coincides_with_walker(...)
+
+  const Data::BurgersProblem<G> problem;
+  XT::Grid::GridProvider<G> grid;
+}; // struct OperatorExecutionPlanTest
+
+
+TEST_F(OperatorExecutionPlanTest, periodic_burgers_fv)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  const auto op = make_advection_fv_operator(space, numerical_flux);
+  plan_coincides_with_walker(op, space);
+}
+
+TEST_F(OperatorExecutionPlanTest, burgers_fv_with_boundary_treatment)
+{
+  auto grid_view = grid.leaf_view();
+  using GV = decltype(grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  op.boundary_treatment([](const auto& intersection, const auto& xx, const auto& u, auto& g, const auto& /*param*/) {
+    g = u;
+    g *= 0.5 * u[0] * intersection.unitOuterNormal(xx)[0];
+  });
+  plan_coincides_with_walker(op, space);
+}
+
+TEST_F(OperatorExecutionPlanTest, appending_drops_the_plan)
+{
+  auto grid_view = grid.leaf_view();
+  using GV = decltype(grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  auto op = make_advection_fv_operator(space, numerical_flux);
+  const auto source = make_source(space.mapper().size(), 0.);
+  V without_source_term(space.mapper().size(), 0.);
+  op.apply(source, without_source_term); // creates the plan
+  op += GenericLocalElementOperator<V, GV>(
+      [](const auto& /*source*/, const auto& local_sources, auto& local_range, const auto& /*param*/) {
+        const auto& geometry = local_range.element().geometry();
+        local_range.dofs()[0] += 2. * local_sources[0]->evaluate(geometry.local(geometry.center()))[0];
+      },
+      /*num_local_sources=*/1);
+  V with_source_term(space.mapper().size(), 0.);
+  op.apply(source, with_source_term);
+  for (size_t ii = 0; ii < source.size(); ++ii)
+    EXPECT_NEAR(without_source_term.get_entry(ii) + 2. * source.get_entry(ii), with_source_term.get_entry(ii), 1e-13)
+        << "ii = " << ii;
+  plan_coincides_with_walker(op, space);
+}
+
+TEST_F(OperatorExecutionPlanTest, plan_follows_the_number_of_threads)
+{
+  auto periodic_grid_view = XT::Grid::make_periodic_grid_layer(grid.leaf_view());
+  using GV = decltype(periodic_grid_view);
+  using I = XT::Grid::extract_intersection_t<GV>;
+  const FiniteVolumeSpace<GV> space(periodic_grid_view);
+  const NumericalUpwindFlux<I, 1, 1> numerical_flux(problem.flux);
+  const auto op = make_advection_fv_operator(space, numerical_flux);
+  const size_t num_threads = XT::Common::threadManager().max_threads();
+  plan_coincides_with_walker(op, space); // creates the plan
+  // the plan is kept, but its elements are split into more chunks
+  XT::Common::threadManager().set_max_threads(2 * num_threads);
+  plan_coincides_with_walker(op, space);
+  XT::Common::threadManager().set_max_threads(num_threads);
+  plan_coincides_with_walker(op, space);
+}
@@ -0,0 +1,108 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+
+#include <tbb/global_control.h>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/grid/walker.hh>
+#include <dune/xt/la/container.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/integrands/ipdg.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/local/integrands/product.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+#include <dune/gdt/tools/sparsity-pattern.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using I = XT::Grid::extract_intersection_t<GV>;
+
+
+template <class MatrixType>
+struct ColoredMatrixAssemblyTest : public ::testing::Test
+{
+  ColoredMatrixAssemblyTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 16u))
+  {
+  }
+
+  // assembles a Laplace and a mass matrix, plus the interior penalty coupling for DG spaces
+  template <class SpaceType>
+  MatrixType assemble(const SpaceType& space, const bool colored)
+  {
+    const auto pattern = make_element_and_intersection_sparsity_pattern(space);
+    auto form = make_bilinear_form(space.grid_view());
+    form += LocalElementIntegralBilinearForm<E>(LocalLaplaceIntegrand<E>());
+    form += LocalElementIntegralBilinearForm<E>(LocalElementProductIntegrand<E>());
+    if (!space.continuous(0))
+      form += {LocalCouplingIntersectionIntegralBilinearForm<I>(LocalIPDGIntegrands::InnerPenalty<I>(8.)),
+               XT::Grid::ApplyOn::InnerIntersectionsOnce<GV>()};
+    auto matrix_op = make_matrix_operator<MatrixType>(space, pattern);
+    matrix_op.append(form);
+    auto walker = XT::Grid::make_walker(space.grid_view());
+    walker.append(matrix_op);
+    if (colored) {
+      // process the elements of one color concurrently, even if the test main restricts tbb to a single thread
+      const tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism, 4);
+      walker.walk_colored();
+    } else
+      walker.walk(/*use_tbb=*/false);
+    return matrix_op.matrix();
+  } // ... assemble(...)
+
+  template <class SpaceType>
+  void colored_assembly_equals_serial_assembly(const SpaceType& space)
+  {
+    const auto expected = assemble(space, /*colored=*/false);
+    const auto pattern = make_element_and_intersection_sparsity_pattern(space);
+    // repeat to give races a chance to show up
+    for (size_t run = 0; run < 3; ++run) {
+      const auto actual = assemble(space, /*colored=*/true);
+      ASSERT_EQ(expected.rows(), actual.rows());
+      ASSERT_EQ(expected.cols(), actual.cols());
+      for (size_t ii = 0; ii < pattern.size(); ++ii)
+        for (const auto& jj : pattern.inner(ii)) {
+          const auto expected_entry = expected.get_entry(ii, jj);
+          EXPECT_NEAR(expected_entry, actual.get_entry(ii, jj), 1e-13 * std::max(1., std::abs(expected_entry)))
+              << "entry (" << ii << ", " << jj << ")";
+        }
+    }
+  } // ... colored_assembly_equals_serial_assembly(...)
+
+  XT::Grid::GridProvider<G> grid;
+}; // struct ColoredMatrixAssemblyTest
+
+
+using MatrixTypes = ::testing::Types<XT::LA::IstlRowMajorSparseMatrix<double>,
+                                     XT::LA::EigenRowMajorSparseMatrix<double>,
+                                     XT::LA::CommonSparseMatrix<double>>;
+
+TYPED_TEST_SUITE(ColoredMatrixAssemblyTest, MatrixTypes);
+TYPED_TEST(ColoredMatrixAssemblyTest, continuous_lagrange_p2)
+{
+  this->colored_assembly_equals_serial_assembly(make_continuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TYPED_TEST(ColoredMatrixAssemblyTest, discontinuous_lagrange_p1_with_coupling)
+{
+  this->colored_assembly_equals_serial_assembly(make_discontinuous_lagrange_space(this->grid.leaf_view(), 1));
+}
@@ -0,0 +1,155 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+#include <dune/xt/la/container/istl.hh>
+
+#include <dune/gdt/local/bilinear-forms/integrals.hh>
+#include <dune/gdt/local/integrands/ipdg.hh>
+#include <dune/gdt/local/integrands/laplace-ipdg.hh>
+#include <dune/gdt/local/integrands/laplace.hh>
+#include <dune/gdt/local/integrands/product.hh>
+#include <dune/gdt/operators/bilinear-form.hh>
+#include <dune/gdt/operators/matrix-free.hh>
+#include <dune/gdt/operators/matrix.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+#include <dune/gdt/tools/sparsity-pattern.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+using G = YASP_2D_EQUIDISTANT_OFFSET;
+using GV = typename G::LeafGridView;
+using E = XT::Grid::extract_entity_t<GV>;
+using I = XT::Grid::extract_intersection_t<GV>;
+using M = XT::LA::IstlRowMajorSparseMatrix<double>;
+using V = XT::LA::IstlDenseVector<double>;
+
+
+struct MatrixFreeOperatorTest : public ::testing::Test
+{
+  MatrixFreeOperatorTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 8u))
+  {
+  }
+
+  // Laplace plus mass, plus the symmetric interior penalty terms (incl. boundary terms) for DG spaces
+  template <class SpaceType>
+  BilinearForm<GV> make_form(const SpaceType& space) const
+  {
+    auto form = make_bilinear_form(space.grid_view());
+    form += LocalElementIntegralBilinearForm<E>(LocalLaplaceIntegrand<E>());
+    form += LocalElementIntegralBilinearForm<E>(LocalElementProductIntegrand<E>());
+    if (!space.continuous(0)) {
+      form += {LocalCouplingIntersectionIntegralBilinearForm<I>(LocalLaplaceIPDGIntegrands::InnerCoupling<I>(1., 1.)
+                                                                + LocalIPDGIntegrands::InnerPenalty<I>(8.)),
+               XT::Grid::ApplyOn::InnerIntersectionsOnce<GV>()};
+      form += {LocalIntersectionIntegralBilinearForm<I>(LocalIPDGIntegrands::BoundaryPenalty<I>(14.)),
+               XT::Grid::ApplyOn::BoundaryIntersections<GV>()};
+    }
+    return form;
+  } // ... make_form(...)
+
+  static V make_source(const size_t size)
+  {
+    V source(size, 0.);
+    for (size_t ii = 0; ii < size; ++ii)
+      source.set_entry(ii, std::sin(double(ii)) + 0.5);
+    return source;
+  }
+
+  template <class SpaceType>
+  void apply_equals_matrix_operator_apply(const SpaceType& space)
+  {
+    const auto form = make_form(space);
+    auto matrix_op = make_matrix_operator<M>(space, Stencil::element_and_intersection);
+    matrix_op.append(form);
+    matrix_op.assemble(/*use_tbb=*/false);
+    const auto source = make_source(space.mapper().size());
+    const auto expected = matrix_op.apply(source);
+    const auto op = make_matrix_free_operator(form, space);
+    // repeat to give races a chance to show up
+    for (size_t run = 0; run < 3; ++run) {
+      // process the elements of one color concurrently, even if the test main restricts tbb to a single thread
+      const tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism, 4);
+      const auto actual = op.apply(source);
+      ASSERT_EQ(expected.size(), actual.size());
+      for (size_t ii = 0; ii < expected.size(); ++ii)
+        EXPECT_NEAR(expected.get_entry(ii),
+                    actual.get_entry(ii),
+                    1e-12 * std::max(1., std::abs(expected.get_entry(ii))))
+            << "ii = " << ii;
+    }
+  } // ... apply_equals_matrix_operator_apply(...)
+
+  template <class SpaceType>
+  void jacobian_is_the_assembled_matrix(const SpaceType& space)
+  {
+    const auto form = make_form(space);
+    auto matrix_op = make_matrix_operator<M>(space, Stencil::element_and_intersection);
+    matrix_op.append(form);
+    matrix_op.assemble(/*use_tbb=*/false);
+    const auto op = make_matrix_free_operator(form, space);
+    EXPECT_EQ(op.jacobian_options(), std::vector<std::string>({"matrix"}));
+    auto jacobian_op = op.jacobian(make_source(space.mapper().size()));
+    jacobian_op.assemble(/*use_tbb=*/false);
+    const auto pattern = make_element_and_intersection_sparsity_pattern(space);
+    for (size_t ii = 0; ii < pattern.size(); ++ii)
+      for (const auto& jj : pattern.inner(ii)) {
+        const auto expected_entry = matrix_op.matrix().get_entry(ii, jj);
+        EXPECT_NEAR(
+            expected_entry, jacobian_op.matrix().get_entry(ii, jj), 1e-12 * std::max(1., std::abs(expected_entry)))
+            << "entry (" << ii << ", " << jj << ")";
+      }
+  } // ... jacobian_is_the_assembled_matrix(...)
+
+  template <class SpaceType>
+  void apply_inverse_by_newton(const SpaceType& space)
+  {
+    // the operator holds its own copy of the bilinear form
+    const auto op = make_matrix_free_operator(make_form(space), space);
+    const auto expected = make_source(space.mapper().size());
+    const auto range = op.apply(expected);
+    const auto actual = op.apply_inverse(range);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t ii = 0; ii < expected.size(); ++ii)
+      EXPECT_NEAR(expected.get_entry(ii), actual.get_entry(ii), 1e-8) << "ii = " << ii;
+  } // ... apply_inverse_by_newton(...)
+
+  XT::Grid::GridProvider<G> grid;
+}; // struct MatrixFreeOperatorTest
+
+
+TEST_F(MatrixFreeOperatorTest, apply_equals_matrix_operator_apply__continuous_lagrange_p2)
+{
+  this->apply_equals_matrix_operator_apply(make_continuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TEST_F(MatrixFreeOperatorTest, apply_equals_matrix_operator_apply__discontinuous_lagrange_p2_sipdg)
+{
+  this->apply_equals_matrix_operator_apply(make_discontinuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TEST_F(MatrixFreeOperatorTest, jacobian_is_the_assembled_matrix__discontinuous_lagrange_p1_sipdg)
+{
+  this->jacobian_is_the_assembled_matrix(make_discontinuous_lagrange_space(this->grid.leaf_view(), 1));
+}
+TEST_F(MatrixFreeOperatorTest, apply_inverse_by_newton__continuous_lagrange_p1)
+{
+  this->apply_inverse_by_newton(make_continuous_lagrange_space(this->grid.leaf_view(), 1));
+}
@@ -0,0 +1,127 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+#include <dune/xt/test/main.hxx> // <- this one has to come first (includes the config.h)!
+
+#include <dune/geometry/quadraturerules.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/common/float_cmp.hh>
+#include <dune/xt/grid/grids.hh>
+#include <dune/xt/grid/gridprovider/cube.hh>
+
+#include <dune/gdt/local/finite-elements/tabulation.hh>
+#include <dune/gdt/spaces/h1/continuous-lagrange.hh>
+#include <dune/gdt/spaces/l2/discontinuous-lagrange.hh>
+
+using namespace Dune;
+using namespace Dune::GDT;
+
+
+template <class G>
+struct DefaultGlobalBasisTabulationTest : public ::testing::Test
+{
+  static constexpr size_t d = G::dimension;
+  using D = typename G::ctype;
+
+  DefaultGlobalBasisTabulationTest()
+    : grid(XT::Grid::make_cube_grid<G>(0., 1., 4u))
+  {
+  }
+
+  // the values served at the points of a quadrature rule have to coincide with the ones at the respective positions
+  template <class SpaceType>
+  void tabulated_evaluations_coincide_with_pointwise_ones(const SpaceType& space)
+  {
+    const double tolerance = 1e-14;
+    auto basis = space.basis().localize();
+    std::vector<typename SpaceType::GlobalBasisType::LocalizedType::RangeType> expected_values, actual_values;
+    std::vector<typename SpaceType::GlobalBasisType::LocalizedType::DerivativeRangeType> expected_jacobians,
+        actual_jacobians;
+    for (auto&& element : elements(space.grid_view())) {
+      basis->bind(element);
+      // a persistent rule, served from the tabulation, ...
+      const auto& quadrature = QuadratureRules<D, d>::rule(element.type(), 2 * basis->order());
+      // ... and a temporary copy of it, which has to give the same results
+      const auto quadrature_copy = quadrature;
+      for (const auto* rule : {&quadrature, &quadrature_copy}) {
+        for (size_t qq = 0; qq < rule->size(); ++qq) {
+          const auto& point = (*rule)[qq].position();
+          basis->evaluate(point, expected_values);
+          basis->evaluate_at_quadrature_point(*rule, qq, actual_values);
+          basis->jacobians(point, expected_jacobians);
+          basis->jacobians_at_quadrature_point(*rule, qq, actual_jacobians);
+          for (size_t ii = 0; ii < basis->size(); ++ii) {
+            EXPECT_TRUE(XT::Common::FloatCmp::eq(expected_values[ii], actual_values[ii], tolerance, tolerance))
+                << "ii = " << ii << ", qq = " << qq;
+            EXPECT_TRUE(
+                XT::Common::FloatCmp::eq(expected_jacobians[ii], actual_jacobians[ii], tolerance, tolerance))
+                << "ii = " << ii << ", qq = " << qq;
+          }
+        }
+      }
+    }
+  } // ... tabulated_evaluations_coincide_with_pointwise_ones(...)
+
+  // the cache identifies tabulations by value, so copies of a rule share them, and it does not grow without bound
+  template <class SpaceType>
+  void tabulation_cache_is_keyed_by_value_and_bounded(const SpaceType& space)
+  {
+    using CacheType = LocalFiniteElementBasisTabulationCache<D, d, double, SpaceType::r, SpaceType::rC>;
+    const CacheType cache(/*max_size=*/2);
+    const auto element = *space.grid_view().template begin<0>();
+    const auto& basis = space.finite_elements().get(element.type(), space.max_polorder()).basis();
+    const auto& quadrature = QuadratureRules<D, d>::rule(element.type(), 2);
+    const auto tabulation = cache.get(basis, quadrature);
+    {
+      const auto quadrature_copy = quadrature;
+      EXPECT_EQ(tabulation, cache.get(basis, quadrature_copy));
+    }
+    EXPECT_EQ(size_t(1), cache.size());
+    const auto other_tabulation = cache.get(basis, QuadratureRules<D, d>::rule(element.type(), 6));
+    EXPECT_NE(tabulation, other_tabulation);
+    EXPECT_EQ(size_t(2), cache.size());
+    // the cache is full and thus cleared, but the tabulations handed out before remain valid
+    cache.get(basis, QuadratureRules<D, d>::rule(element.type(), 10));
+    EXPECT_EQ(size_t(1), cache.size());
+    EXPECT_TRUE(tabulation->matches(quadrature, 0));
+    EXPECT_EQ(quadrature.size(), tabulation->size());
+  } // ... tabulation_cache_is_keyed_by_value_and_bounded(...)
+
+  XT::Grid::GridProvider<G> grid;
+}; // struct DefaultGlobalBasisTabulationTest
+
+
+using GridTypes = ::testing::Types<YASP_2D_EQUIDISTANT_OFFSET
+#if SIMPLEXGRID_2D_AVAILABLE
+                                   ,
+                                   SIMPLEXGRID_2D
+#endif
+                                   >;
+
+TYPED_TEST_SUITE(DefaultGlobalBasisTabulationTest, GridTypes);
+TYPED_TEST(DefaultGlobalBasisTabulationTest, discontinuous_lagrange_p2)
+{
+  this->tabulated_evaluations_coincide_with_pointwise_ones(
+      make_discontinuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TYPED_TEST(DefaultGlobalBasisTabulationTest, discontinuous_lagrange_p3)
+{
+  this->tabulated_evaluations_coincide_with_pointwise_ones(
+      make_discontinuous_lagrange_space(this->grid.leaf_view(), 3));
+}
+TYPED_TEST(DefaultGlobalBasisTabulationTest, continuous_lagrange_p2)
+{
+  this->tabulated_evaluations_coincide_with_pointwise_ones(make_continuous_lagrange_space(this->grid.leaf_view(), 2));
+}
+TYPED_TEST(DefaultGlobalBasisTabulationTest, tabulation_cache_is_keyed_by_value_and_bounded)
+{
+  this->tabulation_cache_is_keyed_by_value_and_bounded(make_discontinuous_lagrange_space(this->grid.leaf_view(), 2));
+}
@@ -13,6 +13,7 @@
 #include <cmath>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 #include <dune/common/timer.hh>
 #include <dune/grid/io/file/dgfparser.hh>
@@ -48,6 +49,7 @@
 #include <dune/gdt/prolongations.hh>
 #include <dune/gdt/spaces/interface.hh>
 #include <dune/gdt/type_traits.hh>
+#include <dune/gdt/test/eocstudies-internal.hh>
 
 namespace Dune {
 namespace GDT {
@@ -58,6 +60,9 @@ template <class GridView, size_t m_ = 1, XT::LA::Backends la = XT::LA::Backends:
 class StationaryEocStudy
   : public XT::Common::ConvergenceStudy
   , public ::testing::Test
+  , protected internal::EocStudyLevelState<XT::Grid::GridProvider<typename GridView::Grid>,
+                                           SpaceInterface<GridView, m_>,
+                                           XT::LA::vector_t<typename XT::LA::Container<double, la>::MatrixType>>
 {
   static_assert(XT::Grid::is_view<GridView>::value, "");
 
@@ -77,6 +82,14 @@ protected:
   using V = XT::LA::vector_t<M>;
   using DF = DiscreteFunction<V, GV, m>;
   using O = OperatorInterface<GV, m, 1, m, 1, R, M>;
+  using LevelStateBaseType = internal::EocStudyLevelState<GP, S, V>;
+  using typename LevelStateBaseType::LevelState;
+  using typename LevelStateBaseType::LevelStateGuard;
+  using LevelStateBaseType::current_data;
+  using LevelStateBaseType::current_grid;
+  using LevelStateBaseType::current_refinement;
+  using LevelStateBaseType::current_solution_on_reference_grid;
+  using LevelStateBaseType::current_space;
 
 public:
   using E = XT::Grid::extract_entity_t<GV>;
@@ -93,13 +106,8 @@ public:
     : num_refinements_(num_refinements)
     , num_additional_refinements_for_reference_(num_additional_refinements_for_reference)
     , visualize_(visualizer)
-    , current_refinement_(std::numeric_limits<size_t>::max())
-    , current_data_()
-    , current_grid_(nullptr)
-    , current_space_(nullptr)
     , reference_grid_(nullptr)
     , reference_space_(nullptr)
-    , current_solution_on_reference_grid_(nullptr)
     , reference_solution_on_reference_grid_(nullptr)
   {
   }
@@ -135,6 +143,40 @@ public:
     return " |grid| |   #DoFs";
   }
 
+  /// \note Opt-in via setup.concurrent_levels, since not all grids may be used from several threads at once.
+  bool levels_are_independent() const override
+  {
+    return DXTC_TEST_CONFIG_GET("setup.concurrent_levels", false);
+  }
+
+  double estimated_work(const size_t refinement_level) const override
+  {
+    return std::pow(2., double(d * refinement_level));
+  }
+
+  /// \brief Computes the level on a fresh LevelState, which is used by all calls of this thread in the meantime.
+  std::pair<std::string, std::map<std::string, std::map<std::string, double>>>
+  compute_level(const size_t refinement_level,
+                const std::vector<std::string>& actual_norms,
+                const std::vector<std::pair<std::string, std::string>>& actual_estimates,
+                const std::vector<std::string>& actual_quantities) override
+  {
+    LevelState level_state;
+    const LevelStateGuard guard(level_state);
+    if (!actual_norms.empty()) {
+      // Some studies temporarily modify the space type for the reference solution, so no level may create its space
+      // in the meantime. The reference solution is computed after this level's discretization info, as in the
+      // sequential case, since solve() may depend on it (e.g., on the grid width for the time step).
+      std::lock_guard<std::mutex> lock(reference_mutex_);
+      discretization_info(refinement_level);
+      const auto current_data_backup = current_data();
+      compute_reference_solution();
+      current_data() = current_data_backup;
+    }
+    return XT::Common::ConvergenceStudy::compute_level(
+        refinement_level, actual_norms, actual_estimates, actual_quantities);
+  }
+
 protected:
   virtual GP make_initial_grid() = 0;
 
@@ -143,27 +185,27 @@ protected:
 public:
   std::string discretization_info(const size_t refinement_level) override
   {
-    if (current_refinement_ != refinement_level) {
+    if (current_refinement() != refinement_level) {
       // clear the current state
-      current_grid_.reset();
-      current_space_.reset();
-      current_solution_on_reference_grid_.reset();
+      current_grid().reset();
+      current_space().reset();
+      current_solution_on_reference_grid().reset();
       // compute on this refinement
-      current_grid_ = std::make_unique<GP>(make_initial_grid());
+      current_grid() = std::make_unique<GP>(make_initial_grid());
       for (size_t ref = 0; ref < refinement_level; ++ref)
-        current_grid_->global_refine(DGFGridInfo<G>::refineStepsForHalf());
-      current_space_ = make_space(*current_grid_);
+        current_grid()->global_refine(DGFGridInfo<G>::refineStepsForHalf());
+      current_space() = make_space(*current_grid());
       double grid_size = 0;
       double grid_width = 0.;
-      for (auto&& grid_element : elements(current_space_->grid_view())) {
+      for (auto&& grid_element : elements(current_space()->grid_view())) {
         grid_size += 1;
         grid_width = std::max(grid_width, XT::Grid::entity_diameter(grid_element));
       }
-      current_refinement_ = refinement_level;
-      current_data_.clear();
-      current_data_["target"]["h"] = grid_width;
-      current_data_["quantity"]["num_grid_elements"] = grid_size;
-      current_data_["quantity"]["num_dofs"] = static_cast<double>(current_space_->mapper().size());
+      current_refinement() = refinement_level;
+      current_data().clear();
+      current_data()["target"]["h"] = grid_width;
+      current_data()["quantity"]["num_grid_elements"] = grid_size;
+      current_data()["quantity"]["num_dofs"] = static_cast<double>(current_space()->mapper().size());
     }
     const auto lfill_nicely = [&](const auto& number, const auto& len) {
       std::string ret;
@@ -177,8 +219,8 @@ public:
       }
       return ret;
     };
-    return lfill_nicely(current_data_["quantity"]["num_grid_elements"], 7) + " | "
-           + lfill_nicely(current_data_["quantity"]["num_dofs"], 7);
+    return lfill_nicely(current_data()["quantity"]["num_grid_elements"], 7) + " | "
+           + lfill_nicely(current_data()["quantity"]["num_dofs"], 7);
   } // ... discretization_info(...)
 
 protected:
@@ -186,9 +228,14 @@ protected:
 
   virtual V solve(const S& space)
   {
+    Timer timer;
     auto op = make_residual_operator(space);
+    current_data()["info"]["time_assembly (s)"] = timer.elapsed();
+    timer.reset();
     V zero(op->range_space().mapper().size(), 0.);
-    return op->apply_inverse(zero);
+    auto solution = op->apply_inverse(zero);
+    current_data()["info"]["time_solve (s)"] = timer.elapsed();
+    return solution;
   }
 
   virtual void compute_reference_solution()
@@ -214,16 +261,16 @@ public:
           const std::vector<std::string>& actual_quantities) override
   {
     auto& self = *this;
-    if (current_refinement_ != refinement_level)
+    if (current_refinement() != refinement_level)
       self.discretization_info(refinement_level);
-    DUNE_THROW_IF(!current_space_, InvalidStateException, "");
+    DUNE_THROW_IF(!current_space(), InvalidStateException, "");
     // compute current solution
-    const auto& current_space = *current_space_;
+    const auto& current_space = *self.current_space();
     Timer timer;
     auto solution_on_current_grid = solve(current_space);
     // only set time if this did not happen in solve()
-    if (current_data_["quantity"].count("time to solution (s)") == 0)
-      current_data_["quantity"]["time to solution (s)"] = timer.elapsed();
+    if (current_data()["quantity"].count("time to solution (s)") == 0)
+      current_data()["quantity"]["time to solution (s)"] = timer.elapsed();
     // visualize
     visualize_(make_discrete_function(current_space, solution_on_current_grid),
                "solution_on_refinement_" + XT::Common::to_string(refinement_level));
@@ -233,18 +280,22 @@ public:
     auto norms_to_compute = actual_norms;
     // - norms
     if (!norms_to_compute.empty()) {
-      auto current_data_backup = current_data_;
-      self.compute_reference_solution();
-      current_data_ = current_data_backup;
+      auto current_data_backup = current_data();
+      {
+        std::lock_guard<std::mutex> lock(reference_mutex_);
+        self.compute_reference_solution();
+      }
+      current_data() = current_data_backup;
       DUNE_THROW_IF(!reference_space_, InvalidStateException, "");
       const auto& reference_space = *reference_space_;
       DUNE_THROW_IF(!reference_solution_on_reference_grid_, InvalidStateException, "");
       auto& u = *reference_solution_on_reference_grid_;
+      Timer norms_timer;
       // prolong
-      current_solution_on_reference_grid_ =
+      current_solution_on_reference_grid() =
           std::make_unique<V>(prolong<V>(coarse_solution, reference_space).dofs().vector());
       // compute norm
-      auto& u_h = *current_solution_on_reference_grid_;
+      auto& u_h = *current_solution_on_reference_grid();
       while (!norms_to_compute.empty()) {
         const auto spatial_norm_id = norms_to_compute.back();
         norms_to_compute.pop_back();
@@ -270,11 +321,12 @@ public:
         } else
           DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
                      "I do not know how to compute the norm '" << spatial_norm_id << "'!");
-        current_data_["norm"][spatial_norm_id] = spatial_norm(make_discrete_function(reference_space, u - u_h));
+        current_data()["norm"][spatial_norm_id] = spatial_norm(make_discrete_function(reference_space, u - u_h));
       }
       DUNE_THROW_IF(!norms_to_compute.empty(),
                     XT::Common::Exceptions::wrong_input_given,
                     "I did not know how to compute the following norms: " << norms_to_compute);
+      current_data()["info"]["time_norms (s)"] = norms_timer.elapsed();
     }
     // - estimates
     auto estimats_to_compute = actual_estimates;
@@ -287,9 +339,9 @@ public:
       const auto id = quantities_to_compute.back();
       quantities_to_compute.pop_back();
       if (id == "time to solution (s)") {
-        DUNE_THROW_IF(current_data_["quantity"].find(id) == current_data_["quantity"].end(),
+        DUNE_THROW_IF(current_data()["quantity"].find(id) == current_data()["quantity"].end(),
                       InvalidStateException,
-                      "Could not find id " << id << "in current_data_ map");
+                      "Could not find id " << id << "in current_data map");
       } else
         DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
                    "I do not know how to compute the quantity '" << id << "'!");
@@ -297,20 +349,16 @@ public:
     DUNE_THROW_IF(!quantities_to_compute.empty(),
                   XT::Common::Exceptions::wrong_input_given,
                   "I did not know how to compute the following quantities: " << quantities_to_compute);
-    return current_data_;
+    return current_data();
   } // ... compute_on_current_refinement(...)
 
 protected:
   size_t num_refinements_;
   size_t num_additional_refinements_for_reference_;
   const std::function<void(const DF&, const std::string&)> visualize_;
-  size_t current_refinement_;
-  std::map<std::string, std::map<std::string, double>> current_data_;
-  std::unique_ptr<GP> current_grid_;
-  std::unique_ptr<S> current_space_;
+  std::mutex reference_mutex_;
   std::unique_ptr<GP> reference_grid_;
   std::unique_ptr<S> reference_space_;
-  std::unique_ptr<V> current_solution_on_reference_grid_;
   std::unique_ptr<V> reference_solution_on_reference_grid_;
 }; // struct StationaryEocStudy
 
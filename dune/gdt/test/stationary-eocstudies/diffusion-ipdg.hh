@@ -122,15 +122,15 @@ protected:
   {
     auto& self = *this;
     // compute the quantities/norms/estimates we known about and remove them from the todos
-    // store the data in current_data_, BaseType::compute will return that
+    // store the data in current_data(), BaseType::compute will return that
     auto remaining_norms = actual_norms;
     auto remaining_estimates = actual_estimates;
     auto remaining_quantities = actual_quantities;
-    if (self.current_refinement_ != refinement_level)
+    if (self.current_refinement() != refinement_level)
       self.discretization_info(refinement_level);
-    DUNE_THROW_IF(!self.current_space_, InvalidStateException, "");
+    DUNE_THROW_IF(!self.current_space(), InvalidStateException, "");
     // compute current solution
-    const auto& current_space = *self.current_space_;
+    const auto& current_space = *self.current_space();
     // visualize
     if (DXTC_TEST_CONFIG_GET("setup.visualize", false)) {
       const std::string prefix = XT::Common::Test::get_unique_test_name() + "_problem_";
@@ -145,8 +145,8 @@ protected:
     Timer timer;
     const auto solution = make_discrete_function(current_space, self.solve(current_space));
     // only set time if this did not happen in solve()
-    if (self.current_data_["quantity"].count("time to solution (s)") == 0)
-      self.current_data_["quantity"]["time to solution (s)"] = timer.elapsed();
+    if (self.current_data()["quantity"].count("time to solution (s)") == 0)
+      self.current_data()["quantity"]["time to solution (s)"] = timer.elapsed();
     for (auto norm_it = remaining_norms.begin(); norm_it != remaining_norms.end(); /*Do not increment here ...*/) {
       const auto norm_id = *norm_it;
       if (norm_id == "eta_NC") {
@@ -158,7 +158,7 @@ protected:
         const auto h1_interpolation = oswald_interpolation_operator.apply(solution);
         auto h1_semi_product = make_bilinear_form(current_space.grid_view());
         h1_semi_product += LocalElementIntegralBilinearForm<E>(LocalLaplaceIntegrand<E>(/*weight=*/diffusion()));
-        self.current_data_["norm"][norm_id] = h1_semi_product.norm(solution - h1_interpolation);
+        self.current_data()["norm"][norm_id] = h1_semi_product.norm(solution - h1_interpolation);
       } else if (norm_id == "eta_R") {
         norm_it = remaining_norms.erase(norm_it); // ... or here ...
         // compute estimate
@@ -212,7 +212,7 @@ protected:
             },
             []() {});
         walker.walk(/*parallel=*/true);
-        self.current_data_["norm"][norm_id] = std::sqrt(eta_R_2);
+        self.current_data()["norm"][norm_id] = std::sqrt(eta_R_2);
       } else if (norm_id == "eta_DF") {
         norm_it = remaining_norms.erase(norm_it); // ... or here ...
         // compute estimate
@@ -257,7 +257,7 @@ protected:
             },
             []() {});
         walker.walk(/*parallel=*/true);
-        self.current_data_["norm"][norm_id] = std::sqrt(eta_DF_2);
+        self.current_data()["norm"][norm_id] = std::sqrt(eta_DF_2);
       } else
         ++norm_it; // ... or finally here.
     } // norms
@@ -0,0 +1,110 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/**
+ * \file  dof-ownership.hh
+ * \brief Assigns each global DoF to exactly one element, to allow for lock-free parallel writes (owner-computes).
+ **/
+#ifndef DUNE_GDT_TOOLS_DOF_OWNERSHIP_HH
+#define DUNE_GDT_TOOLS_DOF_OWNERSHIP_HH
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/dynvector.hh>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/grid/type_traits.hh>
+
+#include <dune/gdt/spaces/mapper/interfaces.hh>
+
+namespace Dune {
+namespace GDT {
+
+
+/**
+ * \brief Assigns each global DoF of a mapper to exactly one element of a grid view.
+ *
+ * The owner of a DoF is the element with the smallest index (w.r.t. the index set of grid_view) among all elements of
+ * grid_view the DoF is associated with. Element functors which set DoFs shared between several elements (e.g., when
+ * interpolating into a continuous space) may thus be applied in parallel without any locking, if each element only
+ * writes the DoFs it owns. Since the owner does not depend on the order of the grid walk, the result is independent of
+ * the number of threads.
+ *
+ * \note The ownership is computed once during construction and is immutable afterwards, so a single instance may be
+ *       shared between all threads.
+ * \note DoFs not associated with any element of grid_view are not owned by any element.
+ */
+template <class GV, class OGV = GV>
+class DofOwnership
+{
+  static_assert(XT::Grid::is_view<GV>::value);
+  static_assert(XT::Grid::is_view<OGV>::value);
+  static_assert(std::is_same<XT::Grid::extract_entity_t<GV>, XT::Grid::extract_entity_t<OGV>>::value);
+
+public:
+  using MapperType = MapperInterface<GV>;
+  using GridViewType = OGV;
+  using ElementType = XT::Grid::extract_entity_t<GridViewType>;
+
+  DofOwnership(const MapperType& mapper, const GridViewType& grid_view)
+    : grid_view_(grid_view)
+    , owners_(mapper.size(), no_owner())
+  {
+    DynamicVector<size_t> global_indices(mapper.max_local_size());
+    for (auto&& element : elements(grid_view_)) {
+      const size_t element_index = grid_view_.indexSet().index(element);
+      mapper.global_indices(element, global_indices);
+      const size_t local_size = mapper.local_size(element);
+      for (size_t ii = 0; ii < local_size; ++ii) {
+        auto& owner = owners_[global_indices[ii]];
+        owner = std::min(owner, element_index);
+      }
+    }
+  } // DofOwnership(...)
+
+  const GridViewType& grid_view() const
+  {
+    return grid_view_;
+  }
+
+  size_t size() const
+  {
+    return owners_.size();
+  }
+
+  /// \brief Returns true if the element with the given index (w.r.t. grid_view().indexSet()) owns the global DoF.
+  bool owns(const size_t element_index, const size_t global_index) const
+  {
+    assert(global_index < owners_.size());
+    return owners_[global_index] == element_index;
+  }
+
+  bool owns(const ElementType& element, const size_t global_index) const
+  {
+    return owns(grid_view_.indexSet().index(element), global_index);
+  }
+
+private:
+  static constexpr size_t no_owner()
+  {
+    return std::numeric_limits<size_t>::max();
+  }
+
+  const GridViewType grid_view_;
+  std::vector<size_t> owners_;
+}; // class DofOwnership
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_TOOLS_DOF_OWNERSHIP_HH
@@ -14,9 +14,14 @@
 #ifndef DUNE_GDT_TOOLS_local_mass_matrices_HH
 #define DUNE_GDT_TOOLS_local_mass_matrices_HH
 
+#include <cstdint>
+#include <limits>
+#include <map>
 #include <mutex>
 #include <vector>
 
+#include <dune/geometry/type.hh>
+
 #include <dune/xt/common/parallel/threadstorage.hh>
 #include <dune/xt/la/container/common.hh>
 #include <dune/xt/la/container/conversion.hh>
@@ -32,39 +37,122 @@
 
 namespace Dune {
 namespace GDT {
+namespace internal {
+
+
+/**
+ * \brief The local mass matrices and their inverses stored by LocalMassMatrixProvider.
+ *
+ * In compressed storage, each affine element only stores the index of a reference matrix (and its inverse) and the
+ * integration element of its geometry, the local mass matrix of the element being the reference matrix scaled by the
+ * integration element (and the inverse being scaled by its reciprocal). All other elements (and all elements in
+ * uncompressed storage) store their matrices in the map.
+ */
+template <class F>
+struct LocalMassMatrixStorage
+{
+  using MatrixType = XT::LA::CommonDenseMatrix<F>;
+
+  static constexpr std::uint32_t no_reference()
+  {
+    return std::numeric_limits<std::uint32_t>::max();
+  }
+
+  struct ReferenceMatrices
+  {
+    GeometryType geometry_type;
+    int order;
+    size_t size;
+    MatrixType matrix;
+    MatrixType inverse;
+  };
+
+  std::uint32_t find_reference(const GeometryType& geometry_type, const int order, const size_t size) const
+  {
+    for (size_t ii = 0; ii < references.size(); ++ii)
+      if (references[ii].geometry_type == geometry_type && references[ii].order == order
+          && references[ii].size == size)
+        return static_cast<std::uint32_t>(ii);
+    return no_reference();
+  }
+
+  /// \brief Binary reduction for ThreadResultPropagator, merges the elements of b into a copy of a.
+  struct Merge
+  {
+    LocalMassMatrixStorage operator()(const LocalMassMatrixStorage& a, const LocalMassMatrixStorage& b) const
+    {
+      LocalMassMatrixStorage result = a;
+      result.matrices.insert(b.matrices.begin(), b.matrices.end());
+      if (b.reference_ids.empty())
+        return result;
+      // the reference matrices are numbered in the order they were encountered by each thread
+      std::vector<std::uint32_t> renumbering(b.references.size());
+      for (size_t ii = 0; ii < b.references.size(); ++ii) {
+        const auto& reference = b.references[ii];
+        renumbering[ii] = result.find_reference(reference.geometry_type, reference.order, reference.size);
+        if (renumbering[ii] == no_reference()) {
+          renumbering[ii] = static_cast<std::uint32_t>(result.references.size());
+          result.references.push_back(reference);
+        }
+      }
+      result.reference_ids.resize(b.reference_ids.size(), no_reference());
+      result.scalings.resize(b.scalings.size(), 0.);
+      for (size_t ii = 0; ii < b.reference_ids.size(); ++ii) {
+        if (b.reference_ids[ii] != no_reference()) {
+          result.reference_ids[ii] = renumbering[b.reference_ids[ii]];
+          result.scalings[ii] = b.scalings[ii];
+        }
+      }
+      return result;
+    } // ... operator()(...)
+  }; // struct Merge
+
+  std::map<size_t, std::pair<MatrixType, MatrixType>> matrices;
+  std::vector<ReferenceMatrices> references;
+  std::vector<std::uint32_t> reference_ids;
+  std::vector<F> scalings;
+}; // struct LocalMassMatrixStorage
+
+
+} // namespace internal
 
 
 /**
  * \brief Element functor that computes the local L2 mass matrix and its inverse for each element of the grid and
  *        provides access to them per element.
+ *
+ * With compressed storage, the local mass matrix of an affine element is not stored, but obtained from a reference
+ * matrix (one per geometry type and order of the local basis, computed on the first such element) scaled by the
+ * integration element, so only one scalar (and the index of the reference matrix) is stored per affine element.
+ * Non-affine elements store their matrices as before.
+ *
+ * \note Compressed storage requires the local basis on each element to be the pull-back of one reference basis per
+ *       geometry type and order (as for the discontinuous Lagrange spaces), which is not checked.
  */
 template <class GV, size_t r = 1, size_t rC = 1, class F = double, class AGV = GV>
 class LocalMassMatrixProvider
   : public XT::Grid::ElementFunctor<GV>
-  , public XT::Common::ThreadResultPropagator<
-        LocalMassMatrixProvider<GV, r, rC, F>,
-        std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>>,
-        XT::Common::concatenate_container<
-            std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>>>>
+  , public XT::Common::ThreadResultPropagator<LocalMassMatrixProvider<GV, r, rC, F>,
+                                              internal::LocalMassMatrixStorage<F>,
+                                              typename internal::LocalMassMatrixStorage<F>::Merge>
 {
   static_assert(XT::Grid::is_view<AGV>::value, "");
 
   using ThisType = LocalMassMatrixProvider;
   using BaseType = XT::Grid::ElementFunctor<GV>;
-  using Propagator = XT::Common::ThreadResultPropagator<
-      LocalMassMatrixProvider<GV, r, rC, F>,
-      std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>>,
-      XT::Common::concatenate_container<
-          std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>>>>;
+  using StorageType = internal::LocalMassMatrixStorage<F>;
+  using Propagator = XT::Common::
+      ThreadResultPropagator<LocalMassMatrixProvider<GV, r, rC, F>, StorageType, typename StorageType::Merge>;
   friend Propagator;
 
 public:
   using AssemblyGridView = AGV;
   using SpaceType = SpaceInterface<GV, r, rC, F>;
+  using MatrixType = XT::LA::CommonDenseMatrix<F>;
   using typename BaseType::E;
   using typename BaseType::ElementType;
 
-  LocalMassMatrixProvider(const AssemblyGridView& grid_view, const SpaceType& space)
+  LocalMassMatrixProvider(const AssemblyGridView& grid_view, const SpaceType& space, const bool compressed = false)
     : BaseType()
     , Propagator(this)
     , grid_view_(grid_view)
@@ -72,6 +160,7 @@ public:
     , element_mapper_(grid_view_)
     , instance_counter_(0)
     , local_basis_(space_->basis().localize())
+    , compressed_(compressed)
   {
   }
 
@@ -83,19 +172,55 @@ public:
     , element_mapper_(grid_view_)
     , instance_counter_(other.instance_counter_ + 1)
     , local_basis_(space_->basis().localize())
+    , compressed_(other.compressed_)
+  {
+  }
+
+  /// \brief Switches between compressed and uncompressed storage, drops all matrices computed so far.
+  void compress(const bool compressed = true)
+  {
+    compressed_ = compressed;
+    storage_ = StorageType();
+  }
+
+  bool compressed() const
   {
+    return compressed_;
   }
 
   void apply_local(const ElementType& element) override
   {
     local_basis_->bind(element);
     const size_t id = element_mapper_.global_index(element, 0);
+    const auto& geometry = element.geometry();
+    const bool use_reference = compressed_ && geometry.affine();
+    if (use_reference) {
+      if (storage_.reference_ids.empty()) {
+        storage_.reference_ids.resize(element_mapper_.size(), StorageType::no_reference());
+        storage_.scalings.resize(element_mapper_.size(), 0.);
+      }
+      const auto reference_id = storage_.find_reference(element.type(), local_basis_->order(), local_basis_->size());
+      if (reference_id != StorageType::no_reference()) {
+        storage_.reference_ids[id] = reference_id;
+        storage_.scalings[id] = geometry.integrationElement(geometry.local(geometry.center()));
+        return;
+      }
+    }
     const LocalElementIntegralBilinearForm<E, r, rC, F, F> local_l2_bilinear_form(
         LocalProductIntegrand<E, r, F, F>(1.));
-    auto matrix =
-        XT::LA::convert_to<XT::LA::CommonDenseMatrix<F>>(local_l2_bilinear_form.apply2(*local_basis_, *local_basis_));
+    auto matrix = XT::LA::convert_to<MatrixType>(local_l2_bilinear_form.apply2(*local_basis_, *local_basis_));
     auto inverse = XT::LA::invert_matrix(matrix);
-    local_mass_matrices_.insert(std::make_pair(id, std::make_pair(std::move(matrix), std::move(inverse))));
+    if (use_reference) {
+      // the first affine element of this kind defines the reference matrices
+      const F scaling = geometry.integrationElement(geometry.local(geometry.center()));
+      matrix /= scaling;
+      inverse *= scaling;
+      storage_.reference_ids[id] = static_cast<std::uint32_t>(storage_.references.size());
+      storage_.scalings[id] = scaling;
+      storage_.references.push_back(
+          {element.type(), local_basis_->order(), local_basis_->size(), std::move(matrix), std::move(inverse)});
+    } else
+      storage_.matrices.insert(std::make_pair(id, std::make_pair(std::move(matrix), std::move(inverse))));
   } // ... apply_local(...)
 
   BaseType* copy() override final
@@ -112,41 +237,88 @@ public:
    * \note This is only used to merge the thread-local results after the grid walk, you are probably interested in
    *       local_mass_matrix() and local_mass_matrix_inverse().
    */
-  std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>> result() const
+  StorageType result() const
   {
-    return local_mass_matrices_;
+    return storage_;
   }
 
-  void set_result(std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>> res)
+  void set_result(StorageType res)
   {
-    local_mass_matrices_ = res;
+    storage_ = std::move(res);
   }
 
-  const XT::LA::CommonDenseMatrix<F>& local_mass_matrix(const ElementType& element) const
+  /// \note Returns a copy, since the matrix might be a scaled reference matrix, see also apply_inverse().
+  MatrixType local_mass_matrix(const ElementType& element) const
   {
     const size_t id = element_mapper_.global_index(element, 0);
-    DUNE_THROW_IF(local_mass_matrices_.count(id) == 0,
-                  XT::Common::Exceptions::this_should_not_happen,
-                  "Missing local mass matrix for id " << id << "!");
-    return local_mass_matrices_.at(id).first;
+    if (const auto* reference = find_reference(id)) {
+      MatrixType ret = reference->matrix;
+      ret *= storage_.scalings[id];
+      return ret;
+    }
+    return find_matrices(id).first;
+  }
+
+  /// \note Returns a copy, since the matrix might be a scaled reference matrix, see also apply_inverse().
+  MatrixType local_mass_matrix_inverse(const ElementType& element) const
+  {
+    const size_t id = element_mapper_.global_index(element, 0);
+    if (const auto* reference = find_reference(id)) {
+      MatrixType ret = reference->inverse;
+      ret /= storage_.scalings[id];
+      return ret;
+    }
+    return find_matrices(id).second;
   }
 
-  const XT::LA::CommonDenseMatrix<F>& local_mass_matrix_inverse(const ElementType& element) const
+  /**
+   * \brief Adds the inverse of the local mass matrix of element times local_dofs to result, without temporaries.
+   *
+   * VectorType has to provide operator[] and ResultType has to provide add_to_entry(), both with size(), e.g.
+   * XT::LA::CommonDenseVector or the local DoF vector of a local discrete function.
+   */
+  template <class VectorType, class ResultType>
+  void apply_inverse(const ElementType& element, const VectorType& local_dofs, ResultType& result) const
   {
     const size_t id = element_mapper_.global_index(element, 0);
-    DUNE_THROW_IF(local_mass_matrices_.count(id) == 0,
+    const auto* reference = find_reference(id);
+    const MatrixType& inverse = (reference != nullptr) ? reference->inverse : find_matrices(id).second;
+    const F factor = (reference != nullptr) ? 1. / storage_.scalings[id] : 1.;
+    DUNE_THROW_IF(inverse.cols() != local_dofs.size(),
+                  XT::Common::Exceptions::shapes_do_not_match,
+                  "inverse.cols() = " << inverse.cols() << "\n   local_dofs.size() = " << local_dofs.size());
+    for (size_t ii = 0; ii < inverse.rows(); ++ii) {
+      F value = 0.;
+      for (size_t jj = 0; jj < inverse.cols(); ++jj)
+        value += inverse.get_entry(ii, jj) * local_dofs[jj];
+      result.add_to_entry(ii, factor * value);
+    }
+  } // ... apply_inverse(...)
+
+private:
+  const typename StorageType::ReferenceMatrices* find_reference(const size_t id) const
+  {
+    if (id < storage_.reference_ids.size() && storage_.reference_ids[id] != StorageType::no_reference())
+      return &storage_.references[storage_.reference_ids[id]];
+    return nullptr;
+  }
+
+  const std::pair<MatrixType, MatrixType>& find_matrices(const size_t id) const
+  {
+    const auto it = storage_.matrices.find(id);
+    DUNE_THROW_IF(it == storage_.matrices.end(),
                   XT::Common::Exceptions::this_should_not_happen,
                   "Missing local mass matrix for id " << id << "!");
-    return local_mass_matrices_.at(id).second;
+    return it->second;
   }
 
-private:
   const AssemblyGridView grid_view_;
   std::unique_ptr<const SpaceType> space_;
   const FiniteVolumeMapper<GV> element_mapper_;
   size_t instance_counter_;
   std::unique_ptr<typename SpaceType::GlobalBasisType::LocalizedType> local_basis_;
-  std::map<size_t, std::pair<XT::LA::CommonDenseMatrix<F>, XT::LA::CommonDenseMatrix<F>>> local_mass_matrices_;
+  bool compressed_;
+  StorageType storage_;
 }; // class LocalMassMatrixProvider
 
 
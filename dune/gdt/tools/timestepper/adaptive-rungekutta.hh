@@ -184,6 +184,7 @@ public:
   using RangeFieldType = typename DiscreteFunctionType::RangeFieldType;
   using MatrixType = typename Dune::DynamicMatrix<RangeFieldType>;
   using VectorType = typename Dune::DynamicVector<RangeFieldType>;
+  using StageVectorType = typename DiscreteFunctionType::VectorType;
   using SolutionType = typename std::vector<std::pair<RangeFieldType, DiscreteFunctionType>>;
 
   /**
@@ -224,6 +225,8 @@ public:
     , c_(c)
     , b_diff_(b_2_ - b_1_)
     , num_stages_(A_.rows())
+    , stage_param_(t_0)
+    , t_(stage_param_.handle("__unspecified__"))
   {
     assert(Dune::XT::Common::FloatCmp::gt(tol_, 0.0));
     assert(Dune::XT::Common::FloatCmp::le(scale_factor_min_, 1.0));
@@ -243,6 +246,8 @@ public:
     for (size_t ii = 0; ii < num_stages_; ++ii) {
       stages_k_.emplace_back(current_solution().copy_as_discrete_function());
     }
+    coeffs_.reserve(num_stages_ + 1);
+    vectors_.reserve(num_stages_ + 1);
   } // constructor AdaptiveRungeKuttaTimeStepper
 
   using BaseType::current_solution;
@@ -306,11 +311,15 @@ public:
 
       for (size_t ii = first_stage_to_compute; ii < num_stages_; ++ii) {
         std::fill(stages_k_[ii]->dofs().vector().begin(), stages_k_[ii]->dofs().vector().end(), RangeFieldType(0.));
-        u_tmp_->dofs().vector() = u_n.dofs().vector();
+        // the vector updates are fused and do not allocate
+        coeffs_.assign(1, 1.);
+        vectors_.assign(1, &u_n.dofs().vector());
         for (size_t jj = 0; jj < ii; ++jj)
-          u_tmp_->dofs().vector() += stages_k_[jj]->dofs().vector() * (actual_dt * r_ * (A_[ii][jj]));
+          add_stage(jj, actual_dt * r_ * A_[ii][jj]);
+        u_tmp_->dofs().vector().lincomb(coeffs_, vectors_);
         try {
-          op_.apply(u_tmp_->dofs().vector(), stages_k_[ii]->dofs().vector(), t + actual_dt * c_[ii]);
+          stage_param_.set(t_, t + actual_dt * c_[ii]);
+          op_.apply(u_tmp_->dofs().vector(), stages_k_[ii]->dofs().vector(), stage_param_);
         } catch (const Dune::MathError&) {
           mixed_error = 1e10;
           skip_error_computation = true;
@@ -328,14 +337,18 @@ public:
 
       if (!skip_error_computation) {
         // compute error vector
-        u_tmp_->dofs().vector() = stages_k_[0]->dofs().vector() * b_diff_[0];
-        for (size_t ii = 1; ii < num_stages_; ++ii)
-          u_tmp_->dofs().vector() += stages_k_[ii]->dofs().vector() * b_diff_[ii];
-        u_tmp_->dofs().vector() *= actual_dt * r_;
+        coeffs_.clear();
+        vectors_.clear();
+        for (size_t ii = 0; ii < num_stages_; ++ii)
+          add_stage(ii, actual_dt * r_ * b_diff_[ii]);
+        u_tmp_->dofs().vector().lincomb(coeffs_, vectors_);
 
         // calculate u at timestep n+1
+        coeffs_.clear();
+        vectors_.clear();
         for (size_t ii = 0; ii < num_stages_; ++ii)
-          u_n.dofs().vector() += stages_k_[ii]->dofs().vector() * (actual_dt * r_ * b_1_[ii]);
+          add_stage(ii, actual_dt * r_ * b_1_[ii]);
+        u_n.dofs().vector().multi_axpy(coeffs_, vectors_);
 
         // scale error, use absolute error if norm is less than 0.01 and relative error else
         auto& diff_vector = u_tmp_->dofs().vector();
@@ -349,8 +362,10 @@ public:
             std::min(std::max(0.9 * std::pow(tol_ / mixed_error, 1.0 / 5.0), scale_factor_min_), scale_factor_max_);
 
         if (mixed_error > tol_) { // go back from u at timestep n+1 to timestep n
-          for (size_t ii = 0; ii < num_stages_; ++ii)
-            u_n.dofs().vector() += stages_k_[ii]->dofs().vector() * (-1.0 * r_ * actual_dt * b_1_[ii]);
+          // coeffs_ and vectors_ still hold the update of u_n
+          for (auto& coeff : coeffs_)
+            coeff *= -1.;
+          u_n.dofs().vector().multi_axpy(coeffs_, vectors_);
         }
       }
     } // while (mixed_error > tol_)
@@ -364,6 +379,15 @@ public:
   } // ... step(...)
 
 private:
+  // stages with a zero coefficient are skipped
+  void add_stage(const size_t ii, const RangeFieldType coeff)
+  {
+    if (coeff != 0.) {
+      coeffs_.push_back(coeff);
+      vectors_.push_back(&stages_k_[ii]->dofs().vector());
+    }
+  }
+
   const OperatorType& op_;
   const RangeFieldType r_;
   const RangeFieldType tol_;
@@ -378,6 +402,10 @@ private:
   std::vector<std::unique_ptr<DiscreteFunctionType>> stages_k_;
   const size_t num_stages_;
   std::unique_ptr<DiscreteFunctionType> last_stage_of_previous_step_;
+  std::vector<RangeFieldType> coeffs_;
+  std::vector<const StageVectorType*> vectors_;
+  XT::Common::Parameter stage_param_;
+  const XT::Common::ParameterHandle t_;
 }; // class AdaptiveRungeKuttaTimeStepper
 
 
@@ -0,0 +1,299 @@
+// This file is part of the dune-gdt project:
+//   https://github.com/dune-community/dune-gdt
+// Copyright 2010-2018 dune-gdt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+// Authors:
+//   dune-gdt developers
+
+/**
+ * \file  binary-output.hh
+ * \brief Compact binary files of DoF vectors, written on a background thread.
+ **/
+#ifndef DUNE_GDT_TIMESTEPPER_BINARY_OUTPUT_HH
+#define DUNE_GDT_TIMESTEPPER_BINARY_OUTPUT_HH
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <dune/xt/common/exceptions.hh>
+
+namespace Dune {
+namespace GDT {
+
+
+/**
+ * \brief Reads and writes a DoF vector, together with the time and the step it belongs to, as a binary file.
+ *
+ * The file starts with a fixed header (a magic string, a flag for the compression, the size of a scalar, the time, the
+ * step, the number of entries and the number of payload bytes), followed by the raw bytes of the entries. If
+ * compressed, the bytes of the entries are shuffled (all first bytes, then all second bytes, ...) and run-length
+ * encoded (as in PackBits), which is lossless and cheap and pays off for the exponents and leading mantissa bytes of
+ * piecewise smooth or piecewise constant data.
+ *
+ * \note The files are meant for checkpointing and postprocessing on the same architecture, byte order is not
+ *       converted.
+ */
+template <class S>
+class BinaryDofFile
+{
+  static_assert(std::is_trivially_copyable<S>::value);
+
+  static constexpr std::array<char, 8> magic()
+  {
+    return {'G', 'D', 'T', 'D', 'O', 'F', 'S', '1'};
+  }
+
+  struct Header
+  {
+    std::array<char, 8> magic;
+    std::uint64_t compressed;
+    std::uint64_t scalar_size;
+    double time;
+    std::uint64_t step;
+    std::uint64_t size;
+    std::uint64_t payload_size;
+  };
+
+public:
+  static void write(const std::string& filename,
+                    const std::vector<S>& values,
+                    const double time,
+                    const size_t step,
+                    const bool compress,
+                    std::vector<char>& buffer)
+  {
+    const char* payload = reinterpret_cast<const char*>(values.data());
+    size_t payload_size = values.size() * sizeof(S);
+    if (compress) {
+      encode(values, buffer);
+      payload = buffer.data();
+      payload_size = buffer.size();
+    }
+    const Header header{magic(), compress, sizeof(S), time, step, values.size(), payload_size};
+    std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+    DUNE_THROW_IF(!file, XT::Common::Exceptions::io_error, "Could not open '" << filename << "' for writing!");
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(payload, payload_size);
+    DUNE_THROW_IF(!file, XT::Common::Exceptions::io_error, "Could not write to '" << filename << "'!");
+  } // ... write(...)
+
+  /// \brief Reads the entries into values (which is resized) and returns the time and the step.
+  static std::pair<double, size_t> read(const std::string& filename, std::vector<S>& values)
+  {
+    std::ifstream file(filename, std::ios_base::binary);
+    DUNE_THROW_IF(!file, XT::Common::Exceptions::io_error, "Could not open '" << filename << "' for reading!");
+    Header header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    DUNE_THROW_IF(!file || header.magic != magic() || header.scalar_size != sizeof(S),
+                  XT::Common::Exceptions::io_error,
+                  "'" << filename << "' is not a DoF file written by BinaryDofFile<S> for this S!");
+    std::vector<char> payload(header.payload_size);
+    file.read(payload.data(), header.payload_size);
+    DUNE_THROW_IF(!file, XT::Common::Exceptions::io_error, "'" << filename << "' is truncated!");
+    values.resize(header.size);
+    if (header.compressed)
+      decode(payload, values);
+    else {
+      DUNE_THROW_IF(header.payload_size != header.size * sizeof(S),
+                    XT::Common::Exceptions::io_error,
+                    "'" << filename << "' is corrupt!");
+      if (header.payload_size > 0)
+        std::memcpy(values.data(), payload.data(), header.payload_size);
+    }
+    return {header.time, header.step};
+  } // ... read(...)
+
+private:
+  static void encode(const std::vector<S>& values, std::vector<char>& encoded)
+  {
+    const size_t num_bytes = values.size() * sizeof(S);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(values.data());
+    const auto shuffled = [&](const size_t ii) { return bytes[(ii % values.size()) * sizeof(S) + ii / values.size()]; };
+    encoded.clear();
+    size_t ii = 0;
+    while (ii < num_bytes) {
+      // a run of (at least two) equal bytes
+      size_t run = 1;
+      while (ii + run < num_bytes && run < 128 && shuffled(ii + run) == shuffled(ii))
+        ++run;
+      if (run > 1) {
+        encoded.push_back(static_cast<char>(257 - run));
+        encoded.push_back(static_cast<char>(shuffled(ii)));
+        ii += run;
+        continue;
+      }
+      // literal bytes up to the next run
+      size_t literal = 1;
+      while (ii + literal < num_bytes && literal < 128
+             && !(ii + literal + 1 < num_bytes && shuffled(ii + literal) == shuffled(ii + literal + 1)))
+        ++literal;
+      encoded.push_back(static_cast<char>(literal - 1));
+      for (size_t jj = 0; jj < literal; ++jj)
+        encoded.push_back(static_cast<char>(shuffled(ii + jj)));
+      ii += literal;
+    }
+  } // ... encode(...)
+
+  static void decode(const std::vector<char>& encoded, std::vector<S>& values)
+  {
+    const size_t num_bytes = values.size() * sizeof(S);
+    auto* bytes = reinterpret_cast<unsigned char*>(values.data());
+    const auto shuffled = [&](const size_t ii) -> unsigned char& {
+      return bytes[(ii % values.size()) * sizeof(S) + ii / values.size()];
+    };
+    size_t ii = 0;
+    size_t pos = 0;
+    while (pos < encoded.size()) {
+      const auto control = static_cast<unsigned char>(encoded[pos++]);
+      const size_t count = (control < 128) ? control + 1 : 257 - control;
+      DUNE_THROW_IF(ii + count > num_bytes || pos + (control < 128 ? count : 1) > encoded.size(),
+                    XT::Common::Exceptions::io_error,
+                    "Corrupt compressed DoF data!");
+      for (size_t jj = 0; jj < count; ++jj)
+        shuffled(ii + jj) = static_cast<unsigned char>(encoded[(control < 128) ? pos + jj : pos]);
+      pos += (control < 128) ? count : 1;
+      ii += count;
+    }
+    DUNE_THROW_IF(ii != num_bytes, XT::Common::Exceptions::io_error, "Corrupt compressed DoF data!");
+  } // ... decode(...)
+}; // class BinaryDofFile
+
+
+/**
+ * \brief Writes DoF vectors as BinaryDofFile on a background thread.
+ *
+ * write() only copies the entries into one of two snapshot buffers and returns, the file is written (and compressed,
+ * if requested) by the I/O thread. Only if both buffers are still waiting to be written (i.e., if writing is slower
+ * than computing the next snapshot), write() waits for one of them to become free. Errors of the I/O thread are
+ * rethrown by the next call to write() or flush().
+ *
+ * \note write() and flush() must not be called concurrently, the destructor flushes (and swallows errors).
+ */
+template <class S>
+class AsyncBinaryDofWriter
+{
+  struct Snapshot
+  {
+    std::vector<S> values;
+    std::string filename;
+    double time;
+    size_t step;
+  };
+
+public:
+  explicit AsyncBinaryDofWriter(const bool compress = false)
+    : compress_(compress)
+    , stop_(false)
+  {
+    for (auto& snapshot : snapshots_)
+      free_.push_back(&snapshot);
+    thread_ = std::thread([this]() { run(); });
+  }
+
+  AsyncBinaryDofWriter(const AsyncBinaryDofWriter&) = delete;
+  AsyncBinaryDofWriter(AsyncBinaryDofWriter&&) = delete;
+
+  ~AsyncBinaryDofWriter()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+  }
+
+  /// \brief Copies the entries of dofs (anything with size() and operator[]) and schedules writing them to filename.
+  template <class VectorType>
+  void write(const std::string& filename, const VectorType& dofs, const double time, const size_t step)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]() { return !free_.empty() || error_; });
+    rethrow_error();
+    Snapshot* snapshot = free_.front();
+    free_.pop_front();
+    lock.unlock();
+    snapshot->values.resize(dofs.size());
+    for (size_t ii = 0; ii < dofs.size(); ++ii)
+      snapshot->values[ii] = dofs[ii];
+    snapshot->filename = filename;
+    snapshot->time = time;
+    snapshot->step = step;
+    lock.lock();
+    pending_.push_back(snapshot);
+    lock.unlock();
+    condition_.notify_all();
+  } // ... write(...)
+
+  /// \brief Waits until all scheduled files are written.
+  void flush()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]() { return (pending_.empty() && free_.size() == snapshots_.size()) || error_; });
+    rethrow_error();
+  }
+
+private:
+  void run()
+  {
+    std::vector<char> buffer;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [&]() { return stop_ || !pending_.empty(); });
+      if (pending_.empty())
+        return; // stop_ is set and everything is written
+      Snapshot* snapshot = pending_.front();
+      pending_.pop_front();
+      lock.unlock();
+      try {
+        BinaryDofFile<S>::write(
+            snapshot->filename, snapshot->values, snapshot->time, snapshot->step, compress_, buffer);
+      } catch (...) {
+        lock.lock();
+        error_ = std::current_exception();
+        lock.unlock();
+      }
+      lock.lock();
+      free_.push_back(snapshot);
+      condition_.notify_all();
+    }
+  } // ... run(...)
+
+  // to be called with locked mutex_
+  void rethrow_error()
+  {
+    if (error_) {
+      auto error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  const bool compress_;
+  std::array<Snapshot, 2> snapshots_;
+  std::deque<Snapshot*> free_;
+  std::deque<Snapshot*> pending_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::exception_ptr error_;
+  bool stop_;
+  std::thread thread_;
+}; // class AsyncBinaryDofWriter
+
+
+} // namespace GDT
+} // namespace Dune
+
+#endif // DUNE_GDT_TIMESTEPPER_BINARY_OUTPUT_HH
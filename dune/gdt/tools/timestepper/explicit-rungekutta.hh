@@ -181,6 +181,7 @@ public:
   using OperatorType = OperatorImp;
   using MatrixType = Dune::DynamicMatrix<RangeFieldType>;
   using VectorType = Dune::DynamicVector<RangeFieldType>;
+  using StageVectorType = typename DiscreteFunctionType::VectorType;
 
   using BaseType::current_solution;
   using BaseType::current_time;
@@ -210,6 +211,9 @@ public:
     , b_(b)
     , c_(c)
     , num_stages_(A_.rows())
+    , stage_param_({{"t", {t_0}}, {"dt", {0.}}})
+    , t_(stage_param_.handle("t"))
+    , dt_(stage_param_.handle("dt"))
   {
     assert(A_.rows() == A_.cols() && "A has to be a square matrix");
     assert(b_.size() == A_.rows());
@@ -225,6 +229,8 @@ public:
     for (size_t ii = 0; ii < num_stages_; ++ii) {
       stages_k_.emplace_back(current_solution().copy_as_discrete_function());
     }
+    coeffs_.reserve(num_stages_ + 1);
+    vectors_.reserve(num_stages_ + 1);
   } // constructor
 
   /**
@@ -246,25 +252,31 @@ public:
 
     this->dts_.push_back(actual_dt);
 
-    // calculate stages
+    // calculate stages (the vector updates are fused and do not allocate)
     auto& u_n = current_solution();
     for (size_t ii = 0; ii < num_stages_; ++ii) {
-      u_i_->dofs().vector() = u_n.dofs().vector();
+      coeffs_.assign(1, 1.);
+      vectors_.assign(1, &u_n.dofs().vector());
       for (size_t jj = 0; jj < ii; ++jj)
-        u_i_->dofs().vector() += stages_k_[jj]->dofs().vector() * (actual_dt * r_ * (A_[ii][jj]));
+        add_stage(jj, actual_dt * r_ * A_[ii][jj]);
+      u_i_->dofs().vector().lincomb(coeffs_, vectors_);
       // TODO: provide actual_dt to op_. This leads to spurious oscillations in the Lax-Friedrichs flux
       // because actual_dt/dx may become very small.
-      op_.apply(u_i_->dofs().vector(),
-                stages_k_[ii]->dofs().vector(),
-                XT::Common::Parameter({{"t", {t + actual_dt * c_[ii]}}, {"dt", {dt}}}));
+      // the stage parameter is updated in place (through handles) instead of being rebuilt
+      stage_param_.set(t_, t + actual_dt * c_[ii]);
+      stage_param_.set(dt_, dt);
+      op_.apply(u_i_->dofs().vector(), stages_k_[ii]->dofs().vector(), stage_param_);
       DataHandleType stages_k_ii_handle(*stages_k_[ii]);
       stages_k_[ii]->space().grid_view().template communicate<DataHandleType>(
           stages_k_ii_handle, Dune::InteriorBorder_All_Interface, Dune::ForwardCommunication);
     }
 
     // calculate value of u at next time step
+    coeffs_.clear();
+    vectors_.clear();
     for (size_t ii = 0; ii < num_stages_; ++ii)
-      u_n.dofs().vector() += stages_k_[ii]->dofs().vector() * (r_ * actual_dt * b_[ii]);
+      add_stage(ii, r_ * actual_dt * b_[ii]);
+    u_n.dofs().vector().multi_axpy(coeffs_, vectors_);
 
     // augment time
     t += actual_dt;
@@ -322,6 +334,15 @@ public:
   }
 
 private:
+  // stages with a zero coefficient are skipped
+  void add_stage(const size_t ii, const RangeFieldType coeff)
+  {
+    if (coeff != 0.) {
+      coeffs_.push_back(coeff);
+      vectors_.push_back(&stages_k_[ii]->dofs().vector());
+    }
+  }
+
   const OperatorType& op_;
   const RangeFieldType r_;
   std::unique_ptr<DiscreteFunctionType> u_i_;
@@ -330,6 +351,11 @@ private:
   const VectorType c_;
   std::vector<std::unique_ptr<DiscreteFunctionType>> stages_k_;
   const size_t num_stages_;
+  std::vector<RangeFieldType> coeffs_;
+  std::vector<const StageVectorType*> vectors_;
+  XT::Common::Parameter stage_param_;
+  const XT::Common::ParameterHandle t_;
+  const XT::Common::ParameterHandle dt_;
 };
 
 
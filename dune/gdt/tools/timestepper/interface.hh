@@ -33,6 +33,7 @@
 #include <dune/gdt/operators/interfaces.hh>
 #include <dune/gdt/discretefunction/default.hh>
 
+#include "binary-output.hh"
 #include "enums.hh"
 
 namespace Dune {
@@ -81,6 +82,9 @@ public:
   using DataHandleType = DiscreteFunctionDataHandle<DiscreteFunctionType>;
   using VisualizerType = XT::Functions::VisualizerInterface<dimRange, dimRangeCols, RangeFieldType>;
   using StringifierType = std::function<std::string(const RangeType&)>;
+  using DofFieldType = typename DiscreteFunctionType::VectorType::ScalarType;
+  using BinaryDofWriterType = AsyncBinaryDofWriter<DofFieldType>;
+  using SpilledSolutionType = std::map<RangeFieldType, std::string, internal::FloatCmpLt>;
   using ThisType = TimeStepperInterface;
 
 private:
@@ -222,9 +226,9 @@ public:
 
     // save/visualize initial solution
     if (save_solution)
-      sol.emplace(t, current_solution().copy_as_discrete_function());
+      save_current_solution(sol, t);
     write_files(visualize,
-                write_discrete,
+                write_discrete && !binary_writer_,
                 write_exact,
                 current_solution(),
                 exact_solution,
@@ -233,6 +237,8 @@ public:
                 t,
                 stringifier,
                 visualizer);
+    if (write_discrete && binary_writer_)
+      write_binary(prefix, 0, t);
 
     // store initial time
     timepoints_.push_back(t);
@@ -259,9 +265,9 @@ public:
       // check if data should be written in this timestep (and write)
       if (Dune::XT::Common::FloatCmp::ge(t, next_save_time) || num_save_steps == size_t(-1)) {
         if (save_solution)
-          sol.emplace_hint(sol.end(), t, current_solution().copy_as_discrete_function());
+          save_current_solution(sol, t);
         write_files(visualize,
-                    write_discrete,
+                    write_discrete && !binary_writer_,
                     write_exact,
                     current_solution(),
                     exact_solution,
@@ -270,6 +276,8 @@ public:
                     t,
                     stringifier,
                     visualizer);
+        if (write_discrete && binary_writer_)
+          write_binary(prefix, save_step_counter, t);
         next_save_time += save_interval;
         ++save_step_counter;
       }
@@ -279,6 +287,11 @@ public:
         next_output_time += output_interval;
       }
     } // while (t < t_end)
+    // make sure all files are complete (and report errors of the I/O thread) before returning
+    if (binary_writer_)
+      binary_writer_->flush();
+    if (spill_writer_)
+      spill_writer_->flush();
     solve_walltime_ = std::chrono::steady_clock::now() - begin_time_;
     // for the last time point there is no actual dt and no computation time as the step is not taken anymore, so we
     // store the estimate for the next timestep and the time for the whole solution process
@@ -402,9 +415,10 @@ public:
     };
   } // ... vector_stringifier()
 
-  static std::string rankfile_name(const std::string& prefix, const int rank, const size_t step)
+  static std::string
+  rankfile_name(const std::string& prefix, const int rank, const size_t step, const std::string& extension = ".txt")
   {
-    return prefix + "_rank_" + XT::Common::to_string(rank) + "_" + XT::Common::to_string(step) + ".txt";
+    return prefix + "_rank_" + XT::Common::to_string(rank) + "_" + XT::Common::to_string(step) + extension;
   }
 
   static void write_to_textfile(const GridFunctionType& u_n,
@@ -418,6 +432,7 @@ public:
     // write one file per MPI rank
     std::ofstream rankfile(rankfile_name(prefix, grid_view.comm().rank(), step));
     const auto local_func = u_n.local_function();
+    const XT::Common::Parameter param("t", t);
     for (const auto& entity : elements(grid_view, Dune::Partitions::interiorBorder)) {
       local_func->bind(entity);
       const auto entity_center = entity.geometry().center();
@@ -429,7 +444,7 @@ public:
           for (size_t ii = 0; ii < dimDomain; ++ii)
             if (position[ii] < entity_center[ii])
               position[ii] += 1e-6 * (entity_center[ii] - position[ii]);
-          const auto val = local_func->evaluate(entity.geometry().local(position), {"t", t});
+          const auto val = local_func->evaluate(entity.geometry().local(position), param);
           for (size_t ii = 0; ii < dimDomain; ++ii)
             rankfile << XT::Common::to_string(position[ii], 15) << " ";
           rankfile << stringifier(val) << std::endl;
@@ -438,7 +453,7 @@ public:
         auto position = entity_center;
         assert(position.size() == dimDomain);
         // avoid ambiguity at interface
-        const auto val = local_func->evaluate(entity.geometry().local(position), {"t", t});
+        const auto val = local_func->evaluate(entity.geometry().local(position), param);
         for (size_t ii = 0; ii < dimDomain; ++ii)
           rankfile << XT::Common::to_string(position[ii], 15) << " ";
         rankfile << stringifier(val) << std::endl;
@@ -489,6 +504,69 @@ public:
       write_to_textfile(exact_sol, grid_view, prefix + "_exact", step, t, stringifier);
   }
 
+  /**
+   * \brief Write the DoF vector of the current solution as binary files instead of .txt files in solve().
+   *
+   * If write_discrete is set in solve(), each MPI rank writes its DoF vector to prefix_rank_R_S.dofs (see
+   * BinaryDofFile, to be read back with BinaryDofFile<DofFieldType>::read), without a barrier or merging. The files are
+   * written on a background thread, see AsyncBinaryDofWriter, solve() only waits for them before returning.
+   */
+  void enable_binary_output(const bool compress = false)
+  {
+    binary_writer_ = std::make_unique<BinaryDofWriterType>(compress);
+  }
+
+  void disable_binary_output()
+  {
+    binary_writer_ = nullptr;
+  }
+
+  /**
+   * \brief Keep saved solutions on disk instead of in memory.
+   *
+   * If save_solution is set in solve(), the DoF vector of the current solution is written (on a background thread, as
+   * in enable_binary_output) to prefix_rank_R_N.dofs instead of storing a copy in the solution map, so memory stays
+   * bounded on long runs. The saved time points are available in spilled_solution(), use load_spilled_solution() to
+   * read a solution back.
+   */
+  void enable_spill_to_disk(const std::string& prefix, const bool compress = false)
+  {
+    spill_writer_ = std::make_unique<BinaryDofWriterType>(compress);
+    spill_prefix_ = prefix;
+  }
+
+  void disable_spill_to_disk()
+  {
+    spill_writer_ = nullptr;
+  }
+
+  /// \brief The files of all solutions saved by solve() while spilling to disk was enabled.
+  const SpilledSolutionType& spilled_solution() const
+  {
+    return spilled_solution_;
+  }
+
+  /// \brief Reads the solution saved at time t (which has to be a key of spilled_solution()).
+  std::unique_ptr<DiscreteFunctionType> load_spilled_solution(const RangeFieldType t) const
+  {
+    const auto it = spilled_solution_.find(t);
+    DUNE_THROW_IF(it == spilled_solution_.end(),
+                  Dune::InvalidStateException,
+                  "There is no solution for time " << t << " spilled to disk!");
+    if (spill_writer_)
+      spill_writer_->flush();
+    std::vector<DofFieldType> values;
+    BinaryDofFile<DofFieldType>::read(it->second, values);
+    auto ret = std::make_unique<DiscreteFunctionType>(current_solution().space());
+    auto& vector = ret->dofs().vector();
+    DUNE_THROW_IF(values.size() != vector.size(),
+                  Dune::InvalidStateException,
+                  "'" << it->second << "' does not fit the current space!");
+    for (size_t ii = 0; ii < values.size(); ++ii)
+      vector[ii] = values[ii];
+    return ret;
+  } // ... load_spilled_solution(...)
+
   void write_timings(const std::string& prefix)
   {
     const std::string filename = prefix + "_timings.txt";
@@ -503,8 +581,29 @@ public:
     timings_file.close();
   }
 
-
 protected:
+  void save_current_solution(DiscreteSolutionType& sol, const RangeFieldType t)
+  {
+    if (!spill_writer_) {
+      sol.emplace_hint(sol.end(), t, current_solution().copy_as_discrete_function());
+      return;
+    }
+    if (spilled_solution_.count(t))
+      return;
+    // number the files consecutively, the save steps of solve() restart with every call
+    const auto& grid_view = current_solution().space().grid_view();
+    const auto filename = rankfile_name(spill_prefix_, grid_view.comm().rank(), spilled_solution_.size(), ".dofs");
+    spill_writer_->write(filename, current_solution().dofs().vector(), t, spilled_solution_.size());
+    spilled_solution_.emplace_hint(spilled_solution_.end(), t, filename);
+  } // ... save_current_solution(...)
+
+  void write_binary(const std::string& prefix, const size_t step, const RangeFieldType t)
+  {
+    const auto& grid_view = current_solution().space().grid_view();
+    binary_writer_->write(
+        rankfile_name(prefix, grid_view.comm().rank(), step, ".dofs"), current_solution().dofs().vector(), t, step);
+  }
+
   RangeFieldType t_;
   DiscreteFunctionType* u_n_;
   DiscreteSolutionType* solution_;
@@ -513,6 +612,10 @@ protected:
   std::vector<double> timepoints_;
   std::vector<double> step_walltimes_;
   std::chrono::duration<double> solve_walltime_;
+  std::unique_ptr<BinaryDofWriterType> binary_writer_;
+  std::unique_ptr<BinaryDofWriterType> spill_writer_;
+  std::string spill_prefix_;
+  SpilledSolutionType spilled_solution_;
 }; // class TimeStepperInterface
 
 
@@ -12,9 +12,17 @@
 #include "config.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/float_cmp.hh>
+#include <dune/xt/common/parallel/threadmanager.hh>
 #include <dune/xt/common/string.hh>
 #include <dune/xt/common/color.hh>
 
@@ -28,6 +36,21 @@ double ConvergenceStudy::expected_rate(const std::string& /*type*/, const std::s
   return 1;
 }
 
+double ConvergenceStudy::estimated_work(const size_t refinement_level) const
+{
+  return std::pow(2., double(refinement_level));
+}
+
+std::pair<std::string, std::map<std::string, std::map<std::string, double>>>
+ConvergenceStudy::compute_level(const size_t refinement_level,
+                                const std::vector<std::string>& actual_norms,
+                                const std::vector<std::pair<std::string, std::string>>& actual_estimates,
+                                const std::vector<std::string>& actual_quantities)
+{
+  auto disc_info = discretization_info(refinement_level);
+  return {std::move(disc_info), compute(refinement_level, actual_norms, actual_estimates, actual_quantities)};
+}
+
 std::vector<std::string> ConvergenceStudy::filter(const std::vector<std::string>& vec,
                                                   const std::vector<std::string>& only_these) const
 {
@@ -299,15 +322,8 @@ ConvergenceStudy::run(const std::vector<std::string>& only_these, std::ostream&
   std::replace(tmp.begin(), tmp.end(), '-', '=');
   out << std::string(h1.size(), '=') << "\n" << h1 << "\n" << d1 << "\n" << h2 << "\n" << tmp << std::endl;
   std::map<size_t, std::map<std::string, std::map<std::string, double>>> data;
-  // run actual study
-  for (size_t level = 0; level <= self.num_refinements(); ++level) {
-    // compute some discretization statistics
-    const auto disc_info = self.discretization_info(level);
-    // and print them
-    out << " " << cfill(disc_info, disc_info_title.size()) << " " << std::flush;
-    // do the actual computation
-    data[level] = compute(level, actual_norms, actual_estimates, actual_quantities);
-    // and print the results
+  // prints the results of a level, after the discretization info, requires the data of all coarser levels
+  const auto print_results = [&](const size_t level) {
     // - targets
     for (const auto& id : actual_targets) {
       std::stringstream ss;
@@ -357,6 +373,59 @@ ConvergenceStudy::run(const std::vector<std::string>& only_these, std::ostream&
     if (level < self.num_refinements())
       out << delim;
     out << std::endl;
+  };
+  const auto seconds_since = [](const auto& begin) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+  };
+  // run actual study
+  const size_t max_threads = threadManager().max_threads();
+  if (!self.levels_are_independent() || max_threads <= 1 || self.num_refinements() == 0) {
+    for (size_t level = 0; level <= self.num_refinements(); ++level) {
+      const auto begin = std::chrono::steady_clock::now();
+      // compute some discretization statistics
+      const auto disc_info = self.discretization_info(level);
+      // and print them
+      out << " " << cfill(disc_info, disc_info_title.size()) << " " << std::flush;
+      // do the actual computation
+      data[level] = compute(level, actual_norms, actual_estimates, actual_quantities);
+      data[level]["info"]["time_level (s)"] = seconds_since(begin);
+      // and print the results
+      print_results(level);
+    }
+  } else {
+    // start with the most expensive levels
+    std::vector<size_t> levels(self.num_refinements() + 1);
+    std::iota(levels.begin(), levels.end(), 0);
+    std::stable_sort(levels.begin(), levels.end(), [&](const auto& lhs, const auto& rhs) {
+      return self.estimated_work(lhs) > self.estimated_work(rhs);
+    });
+    std::mutex mutex;
+    std::vector<std::string> disc_infos(levels.size());
+    size_t next_level_to_print = 0;
+    tbb::task_arena arena(static_cast<int>(max_threads));
+    arena.execute([&]() {
+      tbb::task_group group;
+      for (const auto level : levels) {
+        group.run([&, level]() {
+          // while waiting for nested parallel work, this thread must not start another level
+          tbb::this_task_arena::isolate([&]() {
+            const auto begin = std::chrono::steady_clock::now();
+            auto level_result = self.compute_level(level, actual_norms, actual_estimates, actual_quantities);
+            level_result.second["info"]["time_level (s)"] = seconds_since(begin);
+            std::lock_guard<std::mutex> lock(mutex);
+            disc_infos[level] = std::move(level_result.first);
+            data[level] = std::move(level_result.second);
+            // print all rows which are complete, in order
+            while (next_level_to_print < levels.size() && data.count(next_level_to_print) > 0) {
+              out << " " << cfill(disc_infos[next_level_to_print], disc_info_title.size()) << " ";
+              print_results(next_level_to_print);
+              ++next_level_to_print;
+            }
+          });
+        });
+      }
+      group.wait();
+    });
   }
   // convert data
   std::map<std::string, std::map<std::string, std::map<size_t, double>>> return_data;
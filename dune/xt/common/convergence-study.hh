@@ -20,6 +20,7 @@
 #include <map>
 #include <string>
 #include <iostream>
+#include <utility>
 
 #include <dune/xt/common/logging.hh>
 
@@ -112,6 +113,37 @@ for (std::string type : {"target", "norm", "estimate"}) {
    */
   virtual double expected_rate(const std::string& type, const std::string& id) const;
 
+  /**
+   * \brief Whether the refinement levels may be computed concurrently, see run() and compute_level().
+   *
+   * Only return true if compute_level() does not modify any state which is shared between the levels.
+   */
+  virtual bool levels_are_independent() const
+  {
+    return false;
+  }
+
+  /**
+   * \brief An estimate of the (relative) computational work on refinement_level.
+   *
+   * When computing the levels concurrently, the levels with the most work are started first, so that the cheaper ones
+   * can fill up the remaining threads.
+   */
+  virtual double estimated_work(const size_t refinement_level) const;
+
+  /**
+   * \brief Calls discretization_info() and compute() for refinement_level, returns both results.
+   *
+   * When computing the levels concurrently, this is called for different levels at the same time, each call is
+   * isolated in the sense that the calling thread only takes part in nested parallel work of this call (see
+   * tbb::this_task_arena::isolate). Override this to set up and tear down the state of a single level.
+   */
+  virtual std::pair<std::string, std::map<std::string, std::map<std::string, double>>>
+  compute_level(const size_t refinement_level,
+                const std::vector<std::string>& actual_norms,
+                const std::vector<std::pair<std::string, std::string>>& actual_estimates,
+                const std::vector<std::string>& actual_quantities);
+
 protected:
   // some helpers
   std::vector<std::string> filter(const std::vector<std::string>& vec,
@@ -156,9 +188,15 @@ public:
    * \brief Runs the study and displays a table with all targets, norms, estimates and quantities given by the study
    *        (if only_these is empty) or only those which are contained in only_these (else).
    *
+   * If levels_are_independent(), the levels are computed concurrently on a task arena with
+   * threadManager().max_threads() threads (starting with the most expensive ones, see estimated_work()), and each row
+   * of the table is printed as soon as the level and all coarser ones are done. Otherwise, the levels are computed one
+   * after another.
+   *
    * \return data with data[foo][bar][level] where 0 <= level <= num_refinements(), "foo" is one of
-   *         {"target", "norm", "estimate", "quantity"} and bar is one of targets(), norms(), estimates() or
-   *         quantities() (intersected with only_these), respectively.
+   *         {"target", "norm", "estimate", "quantity", "info"} and bar is one of targets(), norms(), estimates() or
+   *         quantities() (intersected with only_these), respectively, or any timing reported by compute() in
+   *         data["info"] (in addition to "time_level (s)", the wall time of the level measured by run()).
    **/
   std::map<std::string, std::map<std::string, std::map<size_t, double>>>
   run(const std::vector<std::string>& only_these = {}, std::ostream& out = std::cout);
@@ -0,0 +1,67 @@
+// This file is part of the dune-xt project:
+//   https://zivgitlab.uni-muenster.de/ag-ohlberger/dune-community/dune-xt
+// Copyright 2009-2021 dune-xt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/// \file
+/// \brief Provides ConflictFreeScope, which marks code in the calling thread as free of concurrent write conflicts.
+
+#ifndef DUNE_XT_COMMON_PARALLEL_CONFLICT_FREE_SCOPE_HH
+#define DUNE_XT_COMMON_PARALLEL_CONFLICT_FREE_SCOPE_HH
+
+namespace Dune::XT::Common {
+
+
+/**
+ * \brief While an instance is alive, the calling thread promises that no other thread concurrently writes the entries
+ *        it writes.
+ *
+ * Containers which synchronize single-entry updates (e.g., add_to_entry() of the dune-xt-la containers, see
+ * LA::internal::LockGuard) skip their locks within such a scope. This is used by Grid::Walker::walk_colored(), where no
+ * two concurrently processed elements share a DoF.
+ *
+ * \note The state is thread local and scopes may be nested, the previous state is restored on destruction.
+ * \note The scope applies to everything the thread executes while it is alive, including TBB tasks it picks up while
+ *       waiting for nested parallel work. Code which may wait within the scope thus has to run in
+ *       tbb::this_task_arena::isolate(), as in Grid::Walker::walk_colored(), and must not let other threads write the
+ *       same entries concurrently.
+ */
+class ConflictFreeScope
+{
+public:
+  ConflictFreeScope()
+    : previous_(active_flag())
+  {
+    active_flag() = true;
+  }
+
+  ConflictFreeScope(const ConflictFreeScope&) = delete;
+  ConflictFreeScope& operator=(const ConflictFreeScope&) = delete;
+
+  ~ConflictFreeScope()
+  {
+    active_flag() = previous_;
+  }
+
+  /// \brief Returns true if the calling thread is currently within a ConflictFreeScope.
+  static bool active()
+  {
+    return active_flag();
+  }
+
+private:
+  static bool& active_flag()
+  {
+    thread_local bool flag = false;
+    return flag;
+  }
+
+  const bool previous_;
+}; // class ConflictFreeScope
+
+
+} // namespace Dune::XT::Common
+
+#endif // DUNE_XT_COMMON_PARALLEL_CONFLICT_FREE_SCOPE_HH
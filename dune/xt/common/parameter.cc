@@ -12,9 +12,13 @@
 #include "config.h"
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <type_traits>
 
+#include <dune/xt/common/debug.hh>
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/float_cmp.hh>
 #include <dune/xt/common/numeric_cast.hh>
@@ -24,15 +28,92 @@
 
 namespace Dune::XT::Common {
 namespace internal {
+namespace {
 
 
-// ========================
-// ===== SimpleDict =======
-// ========================
+struct ParameterLayoutRegistry
+{
+  std::mutex mutex;
+  std::map<std::vector<std::pair<std::string, size_t>>, std::unique_ptr<ParameterLayout>> layouts;
+  std::map<std::string, size_t> key_ids;
+};
+
+// never destroyed, since handles and parameters (possibly static ones) point to the layouts
+ParameterLayoutRegistry& parameter_layout_registry()
+{
+  static auto* registry = new ParameterLayoutRegistry();
+  return *registry;
+}
+
 
+} // namespace
 
-template class SimpleDict<size_t>;
-template class SimpleDict<std::vector<double>>;
+
+// ===========================
+// ===== ParameterLayout =====
+// ===========================
+ParameterLayout::ParameterLayout(const std::vector<std::pair<std::string, size_t>>& sorted_key_size_pairs,
+                                 std::vector<size_t>&& key_ids)
+  : key_ids_(std::move(key_ids))
+  , offsets_(1, 0)
+{
+  for (const auto& key_size_pair : sorted_key_size_pairs) {
+    keys_.push_back(key_size_pair.first);
+    sizes_.push_back(key_size_pair.second);
+    offsets_.push_back(offsets_.back() + key_size_pair.second);
+  }
+}
+
+const ParameterLayout& ParameterLayout::empty()
+{
+  static const ParameterLayout& empty_layout = make({});
+  return empty_layout;
+}
+
+const ParameterLayout& ParameterLayout::make(std::vector<std::pair<std::string, size_t>> key_size_pairs)
+{
+  std::stable_sort(key_size_pairs.begin(), key_size_pairs.end(), [](const auto& left, const auto& right) {
+    return left.first < right.first;
+  });
+  key_size_pairs.erase(std::unique(key_size_pairs.begin(),
+                                   key_size_pairs.end(),
+                                   [](const auto& left, const auto& right) { return left.first == right.first; }),
+                       key_size_pairs.end());
+  thread_local std::map<std::vector<std::pair<std::string, size_t>>, const ParameterLayout*> known_layouts;
+  const auto known_layout = known_layouts.find(key_size_pairs);
+  if (known_layout != known_layouts.end())
+    return *known_layout->second;
+  auto& registry = parameter_layout_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto& layout = registry.layouts[key_size_pairs];
+  if (!layout) {
+    std::vector<size_t> key_ids;
+    for (const auto& key_size_pair : key_size_pairs)
+      key_ids.push_back(registry.key_ids.emplace(key_size_pair.first, registry.key_ids.size()).first->second);
+    layout = std::unique_ptr<ParameterLayout>(new ParameterLayout(key_size_pairs, std::move(key_ids)));
+  }
+  known_layouts.emplace(std::move(key_size_pairs), layout.get());
+  return *layout;
+} // ... make(...)
+
+const ParameterLayout& ParameterLayout::with(const std::string& key, const size_t sz) const
+{
+  auto key_size_pairs = this->key_size_pairs();
+  const auto key_slot = slot(key);
+  if (key_slot == npos)
+    key_size_pairs.emplace_back(key, sz);
+  else
+    key_size_pairs[key_slot].second = sz;
+  return make(std::move(key_size_pairs));
+}
+
+std::vector<std::pair<std::string, size_t>> ParameterLayout::key_size_pairs() const
+{
+  std::vector<std::pair<std::string, size_t>> ret;
+  for (size_t ii = 0; ii < keys_.size(); ++ii)
+    ret.emplace_back(keys_[ii], sizes_[ii]);
+  return ret;
+}
 
 
 } // namespace internal
@@ -41,58 +122,106 @@ template class SimpleDict<std::vector<double>>;
 // =========================
 // ===== ParameterType =====
 // =========================
+ParameterType::ParameterType()
+  : layout_(&internal::ParameterLayout::empty())
+{
+}
+
 ParameterType::ParameterType(const std::string& key)
-  : BaseType(key, 1)
+  : ParameterType(key, 1)
 {
 }
 
 ParameterType::ParameterType(const std::string& key, const size_t& sz)
-  : BaseType(key, sz)
+  : ParameterType(std::vector<std::pair<std::string, size_t>>{{key, sz}})
 {
 }
 
 ParameterType::ParameterType(const std::pair<std::string, size_t>& key_size_pair)
-  : BaseType(key_size_pair.first, key_size_pair.second)
+  : ParameterType(key_size_pair.first, key_size_pair.second)
 {
 }
 
 ParameterType::ParameterType(const std::pair<const char*, int>& key_size_pair)
-  : BaseType(std::string(key_size_pair.first), numeric_cast<size_t>(key_size_pair.second))
+  : ParameterType(std::string(key_size_pair.first), numeric_cast<size_t>(key_size_pair.second))
 {
 }
 
 ParameterType::ParameterType(const std::vector<std::pair<std::string, size_t>>& key_size_pairs)
-  : BaseType(key_size_pairs)
+  : layout_(&internal::ParameterLayout::make(key_size_pairs))
+{
+}
+
+ParameterType::ParameterType(const internal::ParameterLayout& layout)
+  : layout_(&layout)
+{
+}
+
+void ParameterType::clear()
+{
+  layout_ = &internal::ParameterLayout::empty();
+}
+
+void ParameterType::set(const std::string& key, const size_t& value, const bool overwrite)
+{
+  DUNE_THROW_IF(key.empty(), Exceptions::parameter_error, "Given key must not be empty!");
+  DUNE_THROW_IF(!overwrite && has_key(key),
+                Exceptions::parameter_error,
+                "You are trying to overwrite the key '"
+                    << key << "' (although a value is already set), and overwrite is false!");
+  layout_ = &layout_->with(key, value);
+}
+
+const size_t& ParameterType::get(const std::string& key) const
 {
+  const auto slot = layout_->slot(key);
+  DUNE_THROW_IF(
+      slot == internal::ParameterLayout::npos, Exceptions::parameter_error, "Key '" << key << "' does not exist!");
+  return layout_->size(slot);
 }
 
-ParameterType::ParameterType(BaseType&& source)
-  : BaseType(std::move(source))
+ParameterHandle ParameterType::handle(const std::string& key) const
 {
+  const auto slot = layout_->slot(key);
+  DUNE_THROW_IF(
+      slot == internal::ParameterLayout::npos, Exceptions::parameter_error, "Key '" << key << "' does not exist!");
+  return ParameterHandle(*layout_, slot);
 }
 
 ParameterType ParameterType::operator+(const ParameterType& other) const
 {
-  return this->merge(
-      other,
-      [](const auto& left, const auto& right) { return left == right; },
-      [](const auto& /*left*/, const auto& /*right*/) {
-        return "cannot add parameter types which contain the same key with different sizes:";
-      });
+  if (this->empty() || layout_ == other.layout_)
+    return other;
+  if (other.empty())
+    return *this;
+  auto key_size_pairs = layout_->key_size_pairs();
+  for (size_t ii = 0; ii < other.layout_->num_keys(); ++ii) {
+    const auto& other_key = other.layout_->key(ii);
+    const auto& other_size = other.layout_->size(ii);
+    const auto this_slot = layout_->slot(other_key);
+    if (this_slot == internal::ParameterLayout::npos)
+      key_size_pairs.emplace_back(other_key, other_size);
+    else
+      DUNE_THROW_IF(layout_->size(this_slot) != other_size,
+                    Exceptions::parameter_error,
+                    "cannot add parameter types which contain the same key with different sizes:"
+                        << "\n   this->get(\"" << other_key << "\") = " << layout_->size(this_slot)
+                        << "\n   other.get(\"" << other_key << "\") = " << other_size);
+  }
+  return ParameterType(internal::ParameterLayout::make(std::move(key_size_pairs)));
 } // ... operator+(...)
 
 bool ParameterType::operator==(const ParameterType& other) const
 {
   if (this->size() == 1 && other.size() == 1) {
-    const auto& this_single_element = *this->dict_.begin();
-    const auto& other_single_element = *other.dict_.begin();
-    if (this_single_element.first == other_single_element.first || this_single_element.first == "__unspecified__"
-        || other_single_element.first == "__unspecified__") {
-      return this_single_element.second == other_single_element.second;
+    if (layout_->key(0) == other.layout_->key(0) || layout_->key(0) == "__unspecified__"
+        || other.layout_->key(0) == "__unspecified__") {
+      return layout_->size(0) == other.layout_->size(0);
     }
     return false;
   }
-  return this->dict_ == other.dict_;
+  // the layouts are interned
+  return layout_ == other.layout_;
 } // ... operator==(...)
 
 bool ParameterType::operator!=(const ParameterType& other) const
@@ -102,16 +231,13 @@ bool ParameterType::operator!=(const ParameterType& other) const
 
 bool ParameterType::operator<(const ParameterType& other) const
 {
-  if (this->dict_.size() >= other.dict_.size())
+  if (this->size() >= other.size())
     return false;
-  for (const auto& this_element : this->dict_) {
-    const auto& this_key = this_element.first;
-    const auto& this_keys_lenght = this_element.second;
-    const auto other_key_search_result = other.dict_.find(this_key);
-    if (other_key_search_result == other.dict_.end())
+  for (size_t ii = 0; ii < layout_->num_keys(); ++ii) {
+    const auto other_slot = other.layout_->slot(layout_->key(ii));
+    if (other_slot == internal::ParameterLayout::npos)
       return false;
-    const auto& other_key_lenght = other_key_search_result->second;
-    if (other_key_lenght != this_keys_lenght)
+    if (other.layout_->size(other_slot) != layout_->size(ii))
       return false;
   }
   // now we know that
@@ -128,8 +254,19 @@ bool ParameterType::operator<=(const ParameterType& other) const
 
 std::string ParameterType::report() const
 {
-  return "ParameterType(" + BaseType::report("ParameterType(") + ")";
-}
+  std::stringstream ss;
+  ss << "ParameterType(";
+  if (empty())
+    ss << "{}";
+  else {
+    const auto whitespaced_prefix = whitespaceify("ParameterType(");
+    for (size_t ii = 0; ii < size(); ++ii)
+      ss << (ii == 0 ? "{" : ",\n" + whitespaced_prefix + " ") << layout_->key(ii) << ": " << layout_->size(ii);
+    ss << "}";
+  }
+  ss << ")";
+  return ss.str();
+} // ... report(...)
 
 
 std::ostream& operator<<(std::ostream& out, const ParameterType& param_type)
@@ -143,73 +280,208 @@ std::ostream& operator<<(std::ostream& out, const ParameterType& param_type)
 // ===== Parameter =====
 // =====================
 Parameter::Parameter(const double& value)
-  : BaseType("__unspecified__", {value})
+  : Parameter("__unspecified__", ValueType{value})
 {
 }
 
 Parameter::Parameter(const std::vector<double>& value)
-  : BaseType("__unspecified__", value)
+  : Parameter("__unspecified__", value)
 {
 }
 
 Parameter::Parameter(const std::string& key, const double& value)
-  : BaseType(key, {value})
+  : Parameter(key, ValueType{value})
 {
 }
 
 Parameter::Parameter(const std::string& key, const ValueType& value)
-  : BaseType(key, value)
+  : Parameter(std::vector<std::pair<std::string, ValueType>>{{key, value}})
 {
 }
 
 Parameter::Parameter(const std::vector<std::pair<std::string, ValueType>>& key_value_pairs)
-  : BaseType(key_value_pairs)
+  : layout_(&internal::ParameterLayout::empty())
+  , inline_values_{}
 {
-}
+  if (key_value_pairs.empty())
+    return;
+  std::vector<std::pair<std::string, size_t>> key_size_pairs;
+  for (const auto& key_value_pair : key_value_pairs) {
+    DUNE_THROW_IF(key_value_pair.first.empty(), Exceptions::parameter_error, "Given key must not be empty!");
+    key_size_pairs.emplace_back(key_value_pair.first, key_value_pair.second.size());
+  }
+  relayout(internal::ParameterLayout::make(std::move(key_size_pairs)));
+  // as for duplicate keys in the layout, the first value wins
+  std::vector<bool> slot_is_set(layout_->num_keys(), false);
+  for (const auto& key_value_pair : key_value_pairs) {
+    const auto slot = layout_->slot(key_value_pair.first);
+    if (!slot_is_set[slot]) {
+      std::copy(key_value_pair.second.begin(), key_value_pair.second.end(), data() + layout_->offset(slot));
+      slot_is_set[slot] = true;
+    }
+  }
+} // Parameter(...)
 
 Parameter::Parameter(const std::initializer_list<std::pair<std::string, ValueType>>& key_value_pairs)
-  : BaseType(key_value_pairs)
+  : Parameter(std::vector<std::pair<std::string, ValueType>>(key_value_pairs))
+{
+}
+
+Parameter::Parameter(const internal::ParameterLayout& layout, const Parameter& values)
+  : Parameter(values)
+{
+  DXT_ASSERT(layout.value_size() == values.layout_->value_size());
+  layout_ = &layout;
+}
+
+void Parameter::clear()
+{
+  layout_ = &internal::ParameterLayout::empty();
+  heap_values_.clear();
+}
+
+void Parameter::set(const std::string& key, const ValueType& value, const bool overwrite)
+{
+  DUNE_THROW_IF(key.empty(), Exceptions::parameter_error, "Given key must not be empty!");
+  auto slot = layout_->slot(key);
+  DUNE_THROW_IF(!overwrite && slot != internal::ParameterLayout::npos,
+                Exceptions::parameter_error,
+                "You are trying to overwrite the key '"
+                    << key << "' (although a value is already set), and overwrite is false!");
+  if (slot == internal::ParameterLayout::npos || layout_->size(slot) != value.size()) {
+    relayout(layout_->with(key, value.size()));
+    slot = layout_->slot(key);
+  }
+  std::copy(value.begin(), value.end(), data() + layout_->offset(slot));
+} // ... set(...)
+
+Parameter::ValueType Parameter::get(const std::string& key) const
 {
+  const auto slot = layout_->slot(key);
+  DUNE_THROW_IF(
+      slot == internal::ParameterLayout::npos, Exceptions::parameter_error, "Key '" << key << "' does not exist!");
+  const auto* begin = data() + layout_->offset(slot);
+  return ValueType(begin, begin + layout_->size(slot));
 }
 
-Parameter::Parameter(BaseType&& source)
-  : BaseType(std::move(source))
+ParameterHandle Parameter::handle(const std::string& key) const
 {
+  return type().handle(key);
 }
 
+void Parameter::set(const ParameterHandle& handle, const ValueType& value)
+{
+  DUNE_THROW_IF(value.size() != handle.size_,
+                Exceptions::parameter_error,
+                "Key '" << handle.key() << "' has " << handle.size_ << " values, not " << value.size() << "!");
+  std::copy(value.begin(), value.end(), data() + offset(handle));
+}
+
+size_t Parameter::offset_of_foreign(const ParameterHandle& handle) const
+{
+  DUNE_THROW_IF(handle.layout_ == nullptr, Exceptions::parameter_error, "This handle was default constructed!");
+  const auto slot = layout_->slot_of_id(handle.key_id_);
+  DUNE_THROW_IF(slot == internal::ParameterLayout::npos,
+                Exceptions::parameter_error,
+                "Key '" << handle.key() << "' does not exist!\n   this = " << *this);
+  DUNE_THROW_IF(layout_->size(slot) != handle.size_,
+                Exceptions::parameter_error,
+                "Key '" << handle.key() << "' has " << layout_->size(slot) << " values, the handle expects "
+                        << handle.size_ << "!");
+  return layout_->offset(slot);
+} // ... offset_of_foreign(...)
+
+void Parameter::relayout(const internal::ParameterLayout& new_layout)
+{
+  if (&new_layout == layout_)
+    return;
+  std::array<double, num_inline_values> new_inline_values{};
+  std::vector<double> new_heap_values(
+      (new_layout.value_size() <= num_inline_values) ? 0 : new_layout.value_size(), 0.);
+  double* new_data =
+      (new_layout.value_size() <= num_inline_values) ? new_inline_values.data() : new_heap_values.data();
+  for (size_t ii = 0; ii < new_layout.num_keys(); ++ii) {
+    const auto old_slot = layout_->slot_of_id(new_layout.key_id(ii));
+    if (old_slot != internal::ParameterLayout::npos && layout_->size(old_slot) == new_layout.size(ii))
+      std::copy_n(data() + layout_->offset(old_slot), new_layout.size(ii), new_data + new_layout.offset(ii));
+  }
+  layout_ = &new_layout;
+  inline_values_ = new_inline_values;
+  heap_values_ = std::move(new_heap_values);
+} // ... relayout(...)
+
 Parameter Parameter::operator+(const Parameter& other) const
 {
-  return this->merge(
-      other,
-      [](const auto& left, const auto& right) {
-        if (left.size() != right.size())
-          return false;
-        return FloatCmp::eq(left, right);
-      },
-      [](const auto& left, const auto& right) {
-        if (left.size() != right.size())
-          return "cannot add parameters which contain the same key with different sizes:";
-        return "cannot add parameters which contain the same key with different values:";
-      });
+  if (this->empty())
+    return other;
+  if (other.empty())
+    return *this;
+  Parameter ret = *this;
+  for (size_t ii = 0; ii < other.layout_->num_keys(); ++ii) {
+    const auto& other_key = other.layout_->key(ii);
+    const auto other_value = other.get(other_key);
+    if (!this->has_key(other_key))
+      ret.set(other_key, other_value);
+    else {
+      // key of other is also present in this, the values have to agree
+      const auto this_value = this->get(other_key);
+      DUNE_THROW_IF(this_value.size() != other_value.size() || !FloatCmp::eq(this_value, other_value),
+                    Exceptions::parameter_error,
+                    ((this_value.size() != other_value.size())
+                         ? "cannot add parameters which contain the same key with different sizes:"
+                         : "cannot add parameters which contain the same key with different values:")
+                        << "\n   this->get(\"" << other_key << "\") = " << this_value << "\n   other.get(\""
+                        << other_key << "\") = " << other_value);
+    }
+  }
+  return ret;
 } // ... operator+(...)
 
 bool Parameter::operator<(const Parameter& other) const
 {
-  return this->dict_ < other.dict_;
-}
+  // compares lexicographically, as a std::map<std::string, std::vector<double>> would
+  for (size_t ii = 0; ii < std::min(this->size(), other.size()); ++ii) {
+    const auto& this_key = layout_->key(ii);
+    const auto& other_key = other.layout_->key(ii);
+    if (this_key != other_key)
+      return this_key < other_key;
+    const auto* this_values = data() + layout_->offset(ii);
+    const auto* other_values = other.data() + other.layout_->offset(ii);
+    if (std::lexicographical_compare(this_values,
+                                     this_values + layout_->size(ii),
+                                     other_values,
+                                     other_values + other.layout_->size(ii)))
+      return true;
+    if (std::lexicographical_compare(other_values,
+                                     other_values + other.layout_->size(ii),
+                                     this_values,
+                                     this_values + layout_->size(ii)))
+      return false;
+  }
+  return this->size() < other.size();
+} // ... operator<(...)
 
 ParameterType Parameter::type() const
 {
-  ParameterType ret;
-  for (const auto& key_value_pairs : dict_)
-    ret.set(key_value_pairs.first, key_value_pairs.second.size());
-  return ret;
+  return ParameterType(*layout_);
 }
 
 std::string Parameter::report() const
 {
-  return "Parameter(" + BaseType::report("Parameter(") + ")";
-}
+  std::stringstream ss;
+  ss << "Parameter(";
+  if (empty())
+    ss << "{}";
+  else {
+    const auto whitespaced_prefix = whitespaceify("Parameter(");
+    for (size_t ii = 0; ii < size(); ++ii)
+      ss << (ii == 0 ? "{" : ",\n" + whitespaced_prefix + " ") << layout_->key(ii) << ": "
+         << get(layout_->key(ii));
+    ss << "}";
+  }
+  ss << ")";
+  return ss.str();
+} // ... report(...)
 
 
 std::ostream& operator<<(std::ostream& out, const Parameter& mu)
@@ -240,7 +512,10 @@ const ParameterType& ParametricInterface::parameter_type() const
 Parameter ParametricInterface::parse_parameter(const Parameter& mu) const
 {
   const auto& this_type = this->parameter_type();
-  const auto& mus_type = mu.type();
+  // the common cases, which are pointer comparisons since the layouts are interned
+  if (this_type.empty() || this_type.layout_ == mu.layout_)
+    return mu;
+  const auto mus_type = mu.type();
   if (this_type.size() == 1 && mus_type.size() == 1) {
     // both have only one key, so either key might be '__unspecified__'
     const auto this_single_key = this_type.keys().at(0);
@@ -251,6 +526,8 @@ Parameter ParametricInterface::parse_parameter(const Parameter& mu) const
       return mu;
     }
     if (mus_single_key == "__unspecified__") {
+      if (this_type.layout_->value_size() == mu.layout_->value_size())
+        return Parameter(*this_type.layout_, mu);
       return Parameter(this_single_key, mu.get("__unspecified__"));
     }
     // both have only one key, but the keys don't match and neither is '__unspecified__'
@@ -16,182 +16,241 @@
 #define DUNE_XT_COMMON_PARAMETER_HH
 
 #include <algorithm>
-#include <map>
+#include <array>
+#include <limits>
 #include <iosfwd>
 #include <vector>
 #include <string>
 
+#include <dune/xt/common/exceptions.hh>
+
 #include "string.hh"
 
 namespace Dune::XT::Common {
+
+
+// forwards, required for the friend declarations below
+class ParameterType;
+class Parameter;
+class ParametricInterface;
+
+
 namespace internal {
 
 
-template <class ValueType>
-class SimpleDict
+/**
+ * \brief Sorted keys together with the sizes of their values and the offsets of these values in a contiguous buffer.
+ *
+ * Layouts are interned (see make()) and never destroyed: two layouts describe the same keys and sizes if and only if
+ * they are the same object. Comparing and copying ParameterType and Parameter thus only compares and copies a pointer
+ * to their layout, and each key is assigned a unique integer id once and for all.
+ */
+class ParameterLayout
 {
 public:
-  SimpleDict() = default;
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  static const ParameterLayout& empty();
+
+  /**
+   * \brief Returns the unique layout for the given keys and sizes (in any order).
+   * \note  Duplicate keys are ignored, the first occurrence wins.
+   * \note  Thread safe. Each thread caches the layouts it has already seen, the global registry is only locked for new
+   *        layouts.
+   */
+  static const ParameterLayout& make(std::vector<std::pair<std::string, size_t>> key_size_pairs);
 
-  SimpleDict(const SimpleDict& other) = default;
+  ParameterLayout(const ParameterLayout&) = delete;
 
-  SimpleDict(SimpleDict&& source) noexcept = default;
+  ParameterLayout& operator=(const ParameterLayout&) = delete;
 
-  SimpleDict(const std::string& key, const ValueType& value)
-    : dict_({std::make_pair(key, value)})
+  size_t num_keys() const
   {
-    update_keys();
+    return keys_.size();
   }
 
-  SimpleDict(const std::vector<std::pair<std::string, ValueType>>& key_value_pairs)
+  const std::vector<std::string>& keys() const
   {
-    for (const auto& key_value_pair : key_value_pairs)
-      dict_.emplace(key_value_pair);
-    update_keys();
+    return keys_;
   }
 
-  SimpleDict& operator=(const SimpleDict& other) = default;
+  const std::string& key(const size_t slot) const
+  {
+    return keys_[slot];
+  }
 
-  SimpleDict& operator=(SimpleDict&& source) noexcept
+  size_t key_id(const size_t slot) const
   {
-    dict_ = std::move(source.dict_);
-    keys_ = std::move(source.keys_);
-    return *this;
+    return key_ids_[slot];
   }
 
-  const std::vector<std::string>& keys() const
+  const size_t& size(const size_t slot) const
   {
-    return keys_;
+    return sizes_[slot];
   }
 
-  void clear()
+  size_t offset(const size_t slot) const
   {
-    keys_.clear();
-    dict_.clear();
+    return offsets_[slot];
   }
 
-  bool empty() const
+  /// \brief The sum of the sizes of all keys, i.e. the length of the contiguous buffer.
+  size_t value_size() const
   {
-    return dict_.size() == 0;
+    return offsets_.back();
   }
 
-  bool has_key(const std::string& key) const
+  /// \brief Returns the slot of key or npos.
+  size_t slot(const std::string& key) const
+  {
+    const auto result = std::lower_bound(keys_.begin(), keys_.end(), key);
+    if (result == keys_.end() || *result != key)
+      return npos;
+    return static_cast<size_t>(result - keys_.begin());
+  }
+
+  /// \brief Returns the slot of the key with the given id or npos (a linear search beats anything else for a few keys).
+  size_t slot_of_id(const size_t key_id) const
   {
-    return dict_.find(key) != dict_.end();
+    for (size_t ii = 0; ii < key_ids_.size(); ++ii)
+      if (key_ids_[ii] == key_id)
+        return ii;
+    return npos;
   }
 
-  void set(const std::string& key, const ValueType& value, const bool overwrite = false)
+  /// \brief Returns the layout with key added (or, if present, with the size of key replaced).
+  const ParameterLayout& with(const std::string& key, const size_t sz) const;
+
+  std::vector<std::pair<std::string, size_t>> key_size_pairs() const;
+
+private:
+  ParameterLayout(const std::vector<std::pair<std::string, size_t>>& sorted_key_size_pairs,
+                  std::vector<size_t>&& key_ids);
+
+  std::vector<std::string> keys_;
+  std::vector<size_t> key_ids_;
+  std::vector<size_t> sizes_;
+  std::vector<size_t> offsets_;
+}; // class ParameterLayout
+
+
+} // namespace internal
+
+
+/**
+ * \brief Constant time access to the values of one key of a Parameter, see ParameterType::handle().
+ *
+ * A handle stores the offset of the values in the layout it was obtained from. If used with a Parameter of the same
+ * type, this offset is used directly. Otherwise the key is looked up by its interned id, without comparing strings.
+ * Obtain handles once (e.g., in a constructor) and use them in loops instead of Parameter::get(key).
+ */
+class ParameterHandle
+{
+public:
+  ParameterHandle()
+    : layout_(nullptr)
+    , slot_(0)
+    , key_id_(0)
+    , offset_(0)
+    , size_(0)
   {
-    if (key.empty())
-      DUNE_THROW(Exceptions::parameter_error, "Given key must not be empty!");
-    const bool key_was_present = has_key(key);
-    if (!overwrite && key_was_present)
-      DUNE_THROW(Exceptions::parameter_error,
-                 "You are trying to overwrite the key '"
-                     << key << "' (although a value is already set), and overwrite is false!");
-    dict_[key] = value;
-    if (!key_was_present)
-      update_keys();
-  } // ... set(...)
+  }
 
-  const ValueType& get(const std::string& key) const
+  const std::string& key() const
   {
-    const auto result = dict_.find(key);
-    if (result == dict_.end())
-      DUNE_THROW(Exceptions::parameter_error, "Key '" << key << "' does not exist!");
-    return result->second;
+    DUNE_THROW_IF(layout_ == nullptr, Exceptions::parameter_error, "This handle was default constructed!");
+    return layout_->key(slot_);
   }
 
+  /// \brief The number of values of the key.
   size_t size() const
   {
-    return dict_.size();
+    return size_;
   }
 
-protected:
-  std::string report(const std::string& prefix) const
-  {
-    if (dict_.empty())
-      return "{}";
-    DXT_ASSERT(!keys_.empty());
-    const auto whitespaced_prefix = whitespaceify(prefix);
-    std::stringstream ss;
-    ss << "{" << keys_[0] << ": " << dict_.at(keys_[0]);
-    for (size_t ii = 1; ii < keys_.size(); ++ii) {
-      ss << ",\n" << whitespaced_prefix << " " << keys_[ii] << ": " << dict_.at(keys_[ii]);
-    }
-    ss << "}";
-    return ss.str();
-  } // ... report(...)
-
-  SimpleDict merge(const SimpleDict& other,
-                   std::function<bool(ValueType, ValueType)> value_comparator,
-                   std::function<std::string(ValueType, ValueType)> error_msg_prefix) const
-  {
-    if (this->empty())
-      return other;
-    if (other.empty())
-      return *this;
-    SimpleDict<ValueType> ret = *this;
-    for (const auto& other_element : other.dict_) {
-      const auto& other_key = other_element.first;
-      const auto& other_value = other_element.second;
-      const auto this_key_search_result = dict_.find(other_key);
-      if (this_key_search_result == dict_.end()) {
-        // key of others is not contained in this, just add to ret
-        ret.set(other_key, other_value);
-      } else {
-        // key of other is also present in this
-        const auto& this_value = this_key_search_result->second;
-        DUNE_THROW_IF(!value_comparator(this_value, other_value),
-                      Exceptions::parameter_error,
-                      error_msg_prefix(this_value, other_value)
-                          << "\n   this->get(\"" << other_key << "\") = " << this_value << "\n   other.get(\""
-                          << other_value << "\")");
-        // and the respective values agree, so no need to do something
-      }
-    }
-    return ret;
-  } // ... merge(...)
-
-  void update_keys()
-  {
-    keys_.resize(dict_.size());
-    size_t ii = 0;
-    for (const auto& key_value_pair : dict_) {
-      keys_[ii] = key_value_pair.first;
-      ++ii;
-    }
-    std::sort(keys_.begin(), keys_.end());
-  } // ... update_keys(...)
-
-  std::map<std::string, ValueType> dict_;
-  std::vector<std::string> keys_;
-}; // class SimpleDict
+private:
+  friend class ParameterType;
+  friend class Parameter;
+
+  ParameterHandle(const internal::ParameterLayout& layout, const size_t slot)
+    : layout_(&layout)
+    , slot_(slot)
+    , key_id_(layout.key_id(slot))
+    , offset_(layout.offset(slot))
+    , size_(layout.size(slot))
+  {
+  }
 
+  const internal::ParameterLayout* layout_;
+  size_t slot_;
+  size_t key_id_;
+  size_t offset_;
+  size_t size_;
+}; // class ParameterHandle
 
-extern template class SimpleDict<size_t>;
-extern template class SimpleDict<std::vector<double>>;
 
+/// \brief A read-only view on contiguously stored parameter values, only valid as long as the Parameter is unchanged.
+class ParameterValues
+{
+public:
+  ParameterValues(const double* data, const size_t sz)
+    : data_(data)
+    , size_(sz)
+  {
+  }
 
-} // namespace internal
+  size_t size() const
+  {
+    return size_;
+  }
+
+  bool empty() const
+  {
+    return size_ == 0;
+  }
+
+  const double& operator[](const size_t ii) const
+  {
+    return data_[ii];
+  }
+
+  const double& at(const size_t ii) const
+  {
+    DUNE_THROW_IF(ii >= size_, Exceptions::index_out_of_range, "ii = " << ii << "\n   size() = " << size_);
+    return data_[ii];
+  }
+
+  const double* data() const
+  {
+    return data_;
+  }
+
+  const double* begin() const
+  {
+    return data_;
+  }
+
+  const double* end() const
+  {
+    return data_ + size_;
+  }
+
+private:
+  const double* data_;
+  size_t size_;
+}; // class ParameterValues
 
 
 /// \brief Describes the type of a Parameter as a set of named keys with their respective value sizes.
-class ParameterType : public internal::SimpleDict<size_t>
+class ParameterType
 {
-  using BaseType = internal::SimpleDict<size_t>;
-
 public:
-  ParameterType() = default;
+  ParameterType();
 
   ParameterType(const ParameterType& other) = default;
 
   ParameterType(ParameterType&& source) = default;
 
-private:
-  ParameterType(BaseType&& source);
-
-public:
   ParameterType(const std::string& key);
 
   ParameterType(const std::string& key, const size_t& sz);
@@ -202,10 +261,44 @@ public:
 
   ParameterType(const std::vector<std::pair<std::string, size_t>>& key_size_pairs);
 
+private:
+  explicit ParameterType(const internal::ParameterLayout& layout);
+
+public:
   ParameterType& operator=(const ParameterType& other) = default;
 
   ParameterType& operator=(ParameterType&& source) = default;
 
+  /// \brief The keys, in lexicographical order.
+  const std::vector<std::string>& keys() const
+  {
+    return layout_->keys();
+  }
+
+  void clear();
+
+  bool empty() const
+  {
+    return layout_->num_keys() == 0;
+  }
+
+  bool has_key(const std::string& key) const
+  {
+    return layout_->slot(key) != internal::ParameterLayout::npos;
+  }
+
+  void set(const std::string& key, const size_t& value, const bool overwrite = false);
+
+  const size_t& get(const std::string& key) const;
+
+  size_t size() const
+  {
+    return layout_->num_keys();
+  }
+
+  /// \brief Returns a handle for constant time access to the values of key in Parameters of this type.
+  ParameterHandle handle(const std::string& key) const;
+
   ParameterType operator+(const ParameterType& other) const;
 
   /**
@@ -226,6 +319,12 @@ public:
   bool operator<=(const ParameterType& other) const;
 
   std::string report() const;
+
+private:
+  friend class Parameter;
+  friend class ParametricInterface;
+
+  const internal::ParameterLayout* layout_;
 }; // class ParameterType
 
 
@@ -233,19 +332,35 @@ public:
 std::ostream& operator<<(std::ostream& out, const ParameterType& param_type);
 
 
-/// \brief A named collection of (vector-valued) parameter values, e.g. mapping "t" or "mu" to their current values.
-class Parameter : public internal::SimpleDict<std::vector<double>>
+/**
+ * \brief A named collection of (vector-valued) parameter values, e.g. mapping "t" or "mu" to their current values.
+ *
+ * The keys are given by an interned layout (see ParameterType), the values of all keys are stored contiguously (in the
+ * order of the keys) and, for a few values, without any heap allocation. Copying a Parameter thus copies a pointer and
+ * a few doubles. Use handle() and get/set with a ParameterHandle for constant time access in loops, e.g.
+\code
+Parameter param({{"t", {0.}}, {"dt", {0.}}});
+const auto t = param.handle("t");
+for (...) {
+  param.set(t, current_time); // neither allocates nor compares strings
+  op.apply(source, range, param);
+}
+\endcode
+ */
+class Parameter
 {
-  using BaseType = internal::SimpleDict<std::vector<double>>;
   using ValueType = std::vector<double>;
 
+  static constexpr size_t num_inline_values = 8;
+
 public:
   Parameter(const Parameter& other) = default;
 
   Parameter(Parameter&& source) = default;
 
 private:
-  Parameter(BaseType&& source);
+  /// \note Requires layout.value_size() == values.layout_->value_size().
+  Parameter(const internal::ParameterLayout& layout, const Parameter& values);
 
 public:
   /// \note this is somehow necessary to make clang 3.8 happy (and cannot be defaulted)
@@ -270,6 +385,60 @@ public:
 
   Parameter& operator=(Parameter&& source) = default;
 
+  /// \brief The keys, in lexicographical order.
+  const std::vector<std::string>& keys() const
+  {
+    return layout_->keys();
+  }
+
+  void clear();
+
+  bool empty() const
+  {
+    return layout_->num_keys() == 0;
+  }
+
+  bool has_key(const std::string& key) const
+  {
+    return layout_->slot(key) != internal::ParameterLayout::npos;
+  }
+
+  void set(const std::string& key, const ValueType& value, const bool overwrite = false);
+
+  /// \note Returns a copy, use get(handle) to avoid this.
+  ValueType get(const std::string& key) const;
+
+  size_t size() const
+  {
+    return layout_->num_keys();
+  }
+
+  /// \brief Returns a handle for constant time access to the values of key, \sa ParameterType::handle
+  ParameterHandle handle(const std::string& key) const;
+
+  ParameterValues get(const ParameterHandle& handle) const
+  {
+    return ParameterValues(data() + offset(handle), handle.size_);
+  }
+
+  /// \brief Sets the single value of the key of handle, does not change the type.
+  void set(const ParameterHandle& handle, const double& value)
+  {
+    DUNE_THROW_IF(handle.size_ != 1,
+                  Exceptions::parameter_error,
+                  "Key '" << handle.key() << "' has " << handle.size_ << " values, not one!");
+    data()[offset(handle)] = value;
+  }
+
+  /// \brief Sets the values of the key of handle, does not change the type.
+  void set(const ParameterHandle& handle, const ValueType& value);
+
+  /// \brief All values, ordered as keys().
+  ParameterValues values() const
+  {
+    return ParameterValues(data(), layout_->value_size());
+  }
+
   Parameter operator+(const Parameter& other) const;
 
   bool operator<(const Parameter& other) const;
@@ -277,6 +446,35 @@ public:
   ParameterType type() const;
 
   std::string report() const;
+
+private:
+  friend class ParametricInterface;
+
+  const double* data() const
+  {
+    return (layout_->value_size() <= num_inline_values) ? inline_values_.data() : heap_values_.data();
+  }
+
+  double* data()
+  {
+    return (layout_->value_size() <= num_inline_values) ? inline_values_.data() : heap_values_.data();
+  }
+
+  size_t offset(const ParameterHandle& handle) const
+  {
+    if (handle.layout_ == layout_)
+      return handle.offset_;
+    return offset_of_foreign(handle);
+  }
+
+  size_t offset_of_foreign(const ParameterHandle& handle) const;
+
+  /// \brief Changes the layout, keeping the values of all keys present in both layouts with the same size.
+  void relayout(const internal::ParameterLayout& new_layout);
+
+  const internal::ParameterLayout* layout_;
+  std::array<double, num_inline_values> inline_values_;
+  std::vector<double> heap_values_;
 }; // class Parameter
 
 
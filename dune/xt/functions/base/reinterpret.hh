@@ -17,6 +17,8 @@
 #ifndef DUNE_XT_FUNCTIONS_BASE_REINTERPRET_HH
 #define DUNE_XT_FUNCTIONS_BASE_REINTERPRET_HH
 
+#include <memory>
+
 #include <dune/geometry/referenceelements.hh>
 
 #include <dune/xt/grid/search.hh>
@@ -34,6 +36,10 @@ namespace Dune::XT::Functions {
  *        local_function to provide an evaluation for a point on the new grid layer. Zero is returned if no element is
  *        found. The physical domain covered by the new grid layer should thus be contained in the physical domain of
  *        the original grid layer. This is mainly used in the context of prolongations.
+ *
+ *        The source elements are found using an XT::Grid::EntityBoundingBoxIndex of the original grid layer, which is
+ *        built once in the constructor and shared by all copies and local functions of this function (also between
+ *        threads).
  */
 template <class SourceGridView,
           class TargetElement = XT::Grid::extract_entity_t<SourceGridView>,
@@ -55,11 +61,13 @@ public:
   using typename BaseType::R;
 
   using SourceType = GridFunctionInterface<XT::Grid::extract_entity_t<SourceGridView>, r, rC, R>;
+  using SourceElementIndexType = XT::Grid::EntityBoundingBoxIndex<SourceGridView>;
 
   ReinterpretLocalizableFunction(const SourceType& source, const SourceGridView& source_grid_view)
     : BaseType(source.parameter_type())
     , source_(source.copy_as_grid_function())
     , source_grid_view_(source_grid_view)
+    , source_element_index_(std::make_shared<const SourceElementIndexType>(source_grid_view_))
   {
   }
 
@@ -67,6 +75,7 @@ public:
     : BaseType(other)
     , source_(other.source_->copy_as_grid_function())
     , source_grid_view_(other.source_grid_view_)
+    , source_element_index_(other.source_element_index_)
   {
   }
 
@@ -87,7 +96,7 @@ public:
 
   std::unique_ptr<LocalFunctionType> local_function() const final
   {
-    return std::make_unique<ReinterpretLocalfunction>(*source_, source_grid_view_);
+    return std::make_unique<ReinterpretLocalfunction>(*source_, source_grid_view_, *source_element_index_);
   }
 
   std::string name() const override
@@ -107,11 +116,13 @@ private:
     using typename BaseType::DomainType;
     using typename BaseType::RangeReturnType;
 
-    ReinterpretLocalfunction(const SourceType& source, const SourceGridView& source_grid_view)
+    ReinterpretLocalfunction(const SourceType& source,
+                             const SourceGridView& source_grid_view,
+                             const SourceElementIndexType& source_element_index)
       : BaseType(source.parameter_type())
       , source_(source.copy_as_grid_function())
       , source_grid_view_(source_grid_view)
-      , source_element_search_(source_grid_view_)
+      , source_element_index_(source_element_index)
       , local_source_(source_->local_function())
       , source_element_which_contains_complete_target_element_(nullptr)
       , source_element_which_contains_some_point_of_target_element_(nullptr)
@@ -122,42 +133,34 @@ private:
   protected:
     void post_bind(const TargetElement& target_element)
     {
+      source_element_which_contains_complete_target_element_ = nullptr;
+      source_element_which_contains_some_point_of_target_element_ = nullptr;
       // See if we find a source element which contais target_element completely. Therefore
       // * collect all vertices
       const auto reference_element = ReferenceElements<D, d>::general(target_element.type());
-      const auto num_vertices = reference_element.size(1);
+      const auto num_vertices = reference_element.size(d);
       if (vertices_.size() != num_vertices)
         vertices_.resize(num_vertices);
       for (int ii = 0; ii < num_vertices; ++ii)
-        vertices_[ii] = target_element.geometry().global(reference_element.position(ii, 1));
-      // * search for a source element for each vertex
-      auto source_element_ptrs = source_element_search_(vertices_);
-      DUNE_THROW_IF(source_element_ptrs.size() != num_vertices,
-                    Exceptions::reinterpretation_error,
-                    "source_element_ptrs.size() = " << source_element_ptrs.size()
-                                                    << "\n   num_vertices = " << num_vertices);
-      if (source_element_ptrs[0] == nullptr) // The search failed: abort! local_source_valid_for_this_point_ is false
-        return;
-      // * and check if these are all the same
-      if (num_vertices == 1) {
-        source_element_which_contains_complete_target_element_ = std::move(source_element_ptrs[0]);
-        source_element_which_contains_some_point_of_target_element_ = nullptr;
+        vertices_[ii] = target_element.geometry().global(reference_element.position(ii, d));
+      // * search for the source element which contains the center (a vertex might lie on the boundary of several
+      //   source elements, only one of which may contain target_element)
+      typename SourceElementIndexType::SeedType seed;
+      if (!source_element_index_.find(target_element.geometry().center(), seed)) // The search failed: abort!
+        return; // Each point is searched later.
+      auto source_element = std::make_unique<SourceElementType>(source_grid_view_.grid().entity(seed));
+      // * and check if it contains all vertices (which suffices for convex elements)
+      bool contains_all_vertices = true;
+      const auto& source_geometry = source_element->geometry();
+      for (int ii = 0; ii < num_vertices && contains_all_vertices; ++ii)
+        contains_all_vertices = XT::Grid::CheckInside<0>::check(source_geometry, vertices_[ii]);
+      if (contains_all_vertices) {
+        source_element_which_contains_complete_target_element_ = std::move(source_element);
         local_source_->bind(*source_element_which_contains_complete_target_element_);
       } else {
-        int is_same_as_first_one = 0;
-        for (int ii = 1; ii < num_vertices; ++ii)
-          if (source_element_ptrs[ii] == source_element_ptrs[0])
-            ++is_same_as_first_one;
-        if (is_same_as_first_one == num_vertices - 1) {
-          source_element_which_contains_complete_target_element_ = std::move(source_element_ptrs[0]);
-          source_element_which_contains_some_point_of_target_element_ = nullptr;
-          local_source_->bind(*source_element_which_contains_complete_target_element_);
-        } else {
-          // We could not find a single source element which contains target_element completely.
-          source_element_which_contains_complete_target_element_ = nullptr;
-          source_element_which_contains_some_point_of_target_element_ = std::move(source_element_ptrs[0]);
-          local_source_->bind(*source_element_which_contains_some_point_of_target_element_);
-        }
+        // We could not find a single source element which contains target_element completely.
+        source_element_which_contains_some_point_of_target_element_ = std::move(source_element);
+        local_source_->bind(*source_element_which_contains_some_point_of_target_element_);
       }
     } // ... post_bind(...)
 
@@ -222,35 +225,38 @@ private:
         local_source_valid_for_this_point_ = true;
         return;
       }
-      if (single_point_.size() != 1)
-        single_point_.resize(1);
-      single_point_[0] = this->element().geometry().global(point_in_target_reference_element);
-      auto source_element_ptrs = source_element_search_(single_point_);
-      DUNE_THROW_IF(source_element_ptrs.size() != 1,
-                    Exceptions::reinterpretation_error,
-                    "source_element_ptrs.size() = " << source_element_ptrs.size());
-      if (source_element_ptrs[0] != nullptr) {
-        source_element_which_contains_some_point_of_target_element_ = std::move(source_element_ptrs[0]);
+      const auto point = this->element().geometry().global(point_in_target_reference_element);
+      // consecutive points are likely to lie in the same source element
+      if (source_element_which_contains_some_point_of_target_element_
+          && XT::Grid::CheckInside<0>::check(source_element_which_contains_some_point_of_target_element_->geometry(),
+                                             point)) {
+        local_source_valid_for_this_point_ = true;
+        return;
+      }
+      typename SourceElementIndexType::SeedType seed;
+      if (source_element_index_.find(point, seed)) {
+        source_element_which_contains_some_point_of_target_element_ =
+            std::make_unique<SourceElementType>(source_grid_view_.grid().entity(seed));
         local_source_->bind(*source_element_which_contains_some_point_of_target_element_);
         local_source_valid_for_this_point_ = true;
       }
     } // ... try_to_bind_local_source_for_this_point(...)
 
+    using SourceElementType = XT::Grid::extract_entity_t<SourceGridView>;
+
     const std::unique_ptr<SourceType> source_;
     const SourceGridView& source_grid_view_;
-    mutable XT::Grid::EntityInlevelSearch<SourceGridView> source_element_search_;
+    const SourceElementIndexType& source_element_index_;
     mutable std::unique_ptr<typename SourceType::LocalFunctionType> local_source_;
-    mutable std::unique_ptr<XT::Grid::extract_entity_t<SourceGridView>>
-        source_element_which_contains_complete_target_element_;
-    mutable std::unique_ptr<XT::Grid::extract_entity_t<SourceGridView>>
-        source_element_which_contains_some_point_of_target_element_;
+    mutable std::unique_ptr<SourceElementType> source_element_which_contains_complete_target_element_;
+    mutable std::unique_ptr<SourceElementType> source_element_which_contains_some_point_of_target_element_;
     mutable bool local_source_valid_for_this_point_;
     mutable std::vector<DomainType> vertices_;
-    mutable std::vector<DomainType> single_point_;
   }; // class ReinterpretLocalfunction
 
   std::unique_ptr<SourceType> source_;
   const SourceGridView& source_grid_view_;
+  std::shared_ptr<const SourceElementIndexType> source_element_index_;
 }; // class ReinterpretLocalizableFunction
 
 
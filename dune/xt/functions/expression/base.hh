@@ -22,7 +22,6 @@
 #include <cassert>
 #include <iostream>
 #include <memory>
-#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -101,7 +100,6 @@ public:
   void evaluate(const Dune::FieldVector<DomainFieldType, domain_dim>& arg,
                 Dune::FieldVector<RangeFieldType, range_dim>& ret) const
   {
-    std::lock_guard<std::mutex> guard(mutex_);
     std::array<double, domain_dim> values{};
     for (size_t ii = 0; ii < domain_dim; ++ii)
       values[ii] = static_cast<double>(arg[ii]);
@@ -113,7 +111,6 @@ public:
    */
   void evaluate(const Dune::DynamicVector<DomainFieldType>& arg, Dune::DynamicVector<RangeFieldType>& ret) const
   {
-    std::lock_guard<std::mutex> guard(mutex_);
     assert(arg.size() > 0);
     if (ret.size() != range_dim)
       ret = Dune::DynamicVector<RangeFieldType>(range_dim);
@@ -126,7 +123,6 @@ public:
   void evaluate(const Dune::FieldVector<DomainFieldType, domain_dim>& arg,
                 Dune::DynamicVector<RangeFieldType>& ret) const
   {
-    std::lock_guard<std::mutex> guard(mutex_);
     if (ret.size() != range_dim)
       ret = Dune::DynamicVector<RangeFieldType>(range_dim);
     std::array<double, domain_dim> values{};
@@ -141,7 +137,6 @@ public:
   void evaluate(const Dune::DynamicVector<DomainFieldType>& arg,
                 Dune::FieldVector<RangeFieldType, range_dim>& ret) const
   {
-    std::lock_guard<std::mutex> guard(mutex_);
     assert(arg.size() > 0);
     std::array<double, domain_dim> values{};
     for (size_t ii = 0; ii < std::min(domain_dim, arg.size()); ++ii)
@@ -149,6 +144,30 @@ public:
     evaluate_into(values.data(), domain_dim, ret);
   }
 
+  /**
+   *  \brief Evaluates the expressions at num_points points at once.
+   *
+   *  Equivalent to calling evaluate(points[pp], results[pp]) for all pp, but hands the points to the engine in chunks
+   *  to avoid the per-call overhead.
+   *  \attention results has to hold num_points vectors of size range_dim!
+   */
+  template <class DomainVectorType, class RangeVectorType>
+  void evaluate_batch(const DomainVectorType* points, const size_t num_points, RangeVectorType* results) const
+  {
+    std::array<double, batch_chunk_size * domain_dim> values{};
+    std::array<double, batch_chunk_size * range_dim> chunk_results{};
+    for (size_t first = 0; first < num_points; first += batch_chunk_size) {
+      const size_t chunk_size = std::min(batch_chunk_size, num_points - first);
+      for (size_t pp = 0; pp < chunk_size; ++pp)
+        for (size_t ii = 0; ii < domain_dim; ++ii)
+          values[pp * domain_dim + ii] = static_cast<double>(points[first + pp][ii]);
+      engine_->evaluate_batch(values.data(), chunk_size, domain_dim, chunk_results.data(), range_dim);
+      for (size_t pp = 0; pp < chunk_size; ++pp)
+        for (size_t ii = 0; ii < range_dim; ++ii)
+          results[first + pp][ii] = static_cast<RangeFieldType>(chunk_results[pp * range_dim + ii]);
+    }
+  } // ... evaluate_batch(...)
+
   void report(const std::string& _name = "function.mathexpressionbase",
               std::ostream& stream = std::cout,
               const std::string& _prefix = "") const
@@ -167,6 +186,8 @@ public:
   } // void report(const std::string, std::ostream&, const std::string&) const
 
 private:
+  static constexpr size_t batch_chunk_size = 64;
+
   void setup()
   {
     // fill variables (i.e. "x[0]", "x[1]", ...)
@@ -189,7 +210,6 @@ private:
   std::string variable_;
   Common::FieldVector<std::string, range_dim> expressions_;
   std::unique_ptr<internal::MathExpressionEngine> engine_;
-  mutable std::mutex mutex_;
 }; // class MathExpressionBase
 
 
@@ -235,7 +255,6 @@ public:
 
   void evaluate(const DynamicVector<DomainFieldType>& arg, FieldVector<RangeFieldType, range_dim>& ret) const
   {
-    std::lock_guard<std::mutex> guard(mutex_);
     // check for sizes
     if (arg.size() != variables_.size())
       DUNE_THROW(Common::Exceptions::shapes_do_not_match,
@@ -280,7 +299,6 @@ private:
   std::vector<std::string> variables_;
   std::vector<std::string> expressions_;
   std::unique_ptr<internal::MathExpressionEngine> engine_;
-  mutable std::mutex mutex_;
 }; // class DynamicMathExpressionBase
 
 
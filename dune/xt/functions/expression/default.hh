@@ -382,6 +382,19 @@ public:
     return ret;
   } // ... evaluate(...)
 
+  /**
+   * \brief Evaluates the function at num_points points at once, see MathExpressionBase::evaluate_batch().
+   * \attention results has to hold num_points values!
+   */
+  void evaluate_batch(const DomainType* points_in_global_coordinates,
+                      const size_t num_points,
+                      RangeReturnType* results) const
+  {
+    function_.evaluate_batch(points_in_global_coordinates, num_points, results);
+    for (size_t pp = 0; pp < num_points; ++pp)
+      check_value(points_in_global_coordinates[pp], results[pp]);
+  }
+
   using BaseType::jacobian;
 
   DerivativeRangeReturnType jacobian(const DomainType& point_in_global_coordinates,
@@ -11,11 +11,16 @@
 
 #include "engine.hh"
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cmath>
+#include <cstdlib>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/parallel/threadstorage.hh>
 
 // ExprTk is a large header that triggers many warnings; silence them (it is also added as a SYSTEM
 // include in CMake, but we keep this wrapper for compilers/configurations not covered by that).
@@ -23,16 +28,81 @@
 #include <exprtk.hpp>
 #include <dune/xt/common/reenable_warnings.hh>
 
+#include "native.hh"
+
 namespace Dune::XT::Functions::internal {
+namespace {
+
+
+std::atomic<bool>& native_compilation_flag()
+{
+  static std::atomic<bool> flag([] {
+    const char* value = std::getenv("DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE");
+    if (value == nullptr)
+      return false;
+    const std::string str(value);
+    return str == "1" || str == "ON" || str == "on" || str == "true" || str == "TRUE";
+  }());
+  return flag;
+}
+
+
+} // namespace
 
 
 class MathExpressionEngine::Impl
 {
+  /**
+   * \brief The compiled expressions, bound to their own buffer of variable values.
+   *
+   * ExprTk reads the variables of a compiled expression from the buffer registered in its symbol table, so an
+   * instance may only be used by one thread at a time. The buffer is never resized, so the pointers ExprTk stores
+   * into it remain valid for the lifetime of the instance.
+   */
+  class CompiledExpressions
+  {
+  public:
+    CompiledExpressions(const std::vector<std::string>& placeholders,
+                        const std::vector<std::string>& translated_expressions,
+                        const std::vector<std::string>& expressions)
+      : values_(placeholders.size(), 0.)
+      , compiled_(translated_expressions.size())
+    {
+      for (std::size_t ii = 0; ii < placeholders.size(); ++ii)
+        symbol_table_.add_variable(placeholders[ii], values_[ii]);
+      symbol_table_.add_constants(); // adds pi, epsilon and inf
+      // ExprTk does not define e, add it as in native.cc (unless a placeholder is named e, which takes precedence)
+      symbol_table_.add_constant("e", 0x1.5bf0a8b145769p+1);
+      exprtk::parser<double> parser;
+      for (std::size_t ii = 0; ii < translated_expressions.size(); ++ii) {
+        compiled_[ii].register_symbol_table(symbol_table_);
+        if (!parser.compile(translated_expressions[ii], compiled_[ii]))
+          DUNE_THROW(Common::Exceptions::wrong_input_given,
+                     "Could not parse the expression '" << expressions[ii]
+                                                        << "'!\n   ExprTk reported: " << parser.error());
+      }
+    }
+
+    CompiledExpressions(const CompiledExpressions&) = delete;
+    CompiledExpressions& operator=(const CompiledExpressions&) = delete;
+
+    void evaluate(const double* values, double* results)
+    {
+      std::copy(values, values + values_.size(), values_.begin());
+      for (std::size_t ii = 0; ii < compiled_.size(); ++ii)
+        results[ii] = compiled_[ii].value();
+    }
+
+  private:
+    std::vector<double> values_;
+    exprtk::symbol_table<double> symbol_table_;
+    std::vector<exprtk::expression<double>> compiled_;
+  }; // class CompiledExpressions
+
 public:
   Impl(std::vector<std::string> variables, std::vector<std::string> expressions)
     : variables_(std::move(variables))
     , expressions_(std::move(expressions))
-    , values_(variables_.size(), 0.)
   {
     // Gather every identifier already present in the variable names or the source expressions, so the
     // synthetic placeholders bound below can be chosen disjoint from them. Otherwise a user expression
@@ -44,9 +114,7 @@ public:
     for (const auto& expr : expressions_)
       collect_identifiers(expr, reserved);
 
-    // Map every (possibly bracketed) variable name to a collision-free placeholder identifier and bind
-    // that placeholder to our value buffer. The buffer is never resized, so the pointers ExprTk stores
-    // into it remain valid for the lifetime of this object.
+    // Map every (possibly bracketed) variable name to a collision-free placeholder identifier.
     std::size_t counter = 0;
     for (std::size_t ii = 0; ii < variables_.size(); ++ii) {
       std::string placeholder;
@@ -55,19 +123,21 @@ public:
       } while (reserved.count(placeholder) > 0);
       reserved.insert(placeholder);
       name_to_placeholder_[variables_[ii]] = placeholder;
-      symbol_table_.add_variable(placeholder, values_[ii]);
+      placeholders_.push_back(placeholder);
     }
-    symbol_table_.add_constants(); // adds pi (and e, epsilon, inf)
-
-    exprtk::parser<double> parser;
-    compiled_.resize(expressions_.size());
-    for (std::size_t ii = 0; ii < expressions_.size(); ++ii) {
-      compiled_[ii].register_symbol_table(symbol_table_);
-      const std::string translated = translate(expressions_[ii]);
-      if (!parser.compile(translated, compiled_[ii]))
-        DUNE_THROW(Common::Exceptions::wrong_input_given,
-                   "Could not parse the expression '" << expressions_[ii]
-                                                      << "'!\n   ExprTk reported: " << parser.error());
+    for (const auto& expr : expressions_)
+      translated_expressions_.push_back(translate(expr));
+
+    // Compile once for the constructing thread right away, so invalid expressions are reported here. All other
+    // threads compile their own copy on their first evaluation, see local().
+    *compiled_ = std::make_unique<CompiledExpressions>(placeholders_, translated_expressions_, expressions_);
+
+    if (native_compilation_flag()) {
+      native_ = compile_native_expressions(variables_, expressions_);
+      // the translation to C++ mimics ExprTk's syntax, but we do not want to rely on getting every corner case (e.g.,
+      // the associativity of ^) right, so fall back to ExprTk on any disagreement
+      if (native_ != nullptr && !native_coincides_with_exprtk())
+        native_ = nullptr;
     }
   }
 
@@ -83,19 +153,86 @@ public:
 
   void evaluate(const double* values, std::size_t num_values, double* results, std::size_t num_results) const
   {
-    if (num_values != values_.size())
+    check_sizes(num_values, num_results);
+    if (native_ != nullptr)
+      native_(values, results);
+    else
+      local().evaluate(values, results);
+  }
+
+  bool native() const
+  {
+    return native_ != nullptr;
+  }
+
+  void evaluate_batch(const double* values,
+                      std::size_t num_points,
+                      std::size_t num_values,
+                      double* results,
+                      std::size_t num_results) const
+  {
+    check_sizes(num_values, num_results);
+    if (native_ != nullptr) {
+      for (std::size_t pp = 0; pp < num_points; ++pp)
+        native_(values + pp * num_values, results + pp * num_results);
+      return;
+    }
+    auto& compiled = local();
+    for (std::size_t pp = 0; pp < num_points; ++pp)
+      compiled.evaluate(values + pp * num_values, results + pp * num_results);
+  }
+
+private:
+  void check_sizes(std::size_t num_values, std::size_t num_results) const
+  {
+    if (num_values != variables_.size())
       DUNE_THROW(Common::Exceptions::shapes_do_not_match,
-                 "num_values: " << num_values << "\n   variables.size(): " << values_.size());
-    if (num_results != compiled_.size())
+                 "num_values: " << num_values << "\n   variables.size(): " << variables_.size());
+    if (num_results != expressions_.size())
       DUNE_THROW(Common::Exceptions::shapes_do_not_match,
-                 "num_results: " << num_results << "\n   expressions.size(): " << compiled_.size());
-    for (std::size_t ii = 0; ii < num_values; ++ii)
-      values_[ii] = values[ii];
-    for (std::size_t ii = 0; ii < num_results; ++ii)
-      results[ii] = compiled_[ii].value();
+                 "num_results: " << num_results << "\n   expressions.size(): " << expressions_.size());
+  }
+
+  //! Compares the native and the ExprTk evaluation at a few points in (0, 1)^num_variables, and at a few points of
+  //! mixed sign and magnitude in (-4, 4)^num_variables (e.g., to cover the branches of abs, min and max).
+  bool native_coincides_with_exprtk() const
+  {
+    std::vector<double> values(variables_.size());
+    std::vector<double> native_results(expressions_.size());
+    std::vector<double> exprtk_results(expressions_.size());
+    for (std::size_t pp = 0; pp < 16; ++pp) {
+      for (std::size_t ii = 0; ii < values.size(); ++ii) {
+        const double sample = std::fmod(0.6180339887498949 * double(1 + pp * values.size() + ii), 1.);
+        values[ii] = (pp < 8) ? 0.1 + 0.8 * sample : 8. * sample - 4.;
+      }
+      native_(values.data(), native_results.data());
+      local().evaluate(values.data(), exprtk_results.data());
+      for (std::size_t ii = 0; ii < expressions_.size(); ++ii) {
+        const double native_result = native_results[ii];
+        const double exprtk_result = exprtk_results[ii];
+        if (std::isnan(native_result) || std::isnan(exprtk_result)) {
+          if (std::isnan(native_result) != std::isnan(exprtk_result))
+            return false;
+        } else if (std::isinf(native_result) || std::isinf(exprtk_result)) {
+          if (native_result != exprtk_result)
+            return false;
+        } else if (std::abs(native_result - exprtk_result)
+                   > 1e-12 * std::max({1., std::abs(native_result), std::abs(exprtk_result)}))
+          return false;
+      }
+    }
+    return true;
+  } // ... native_coincides_with_exprtk(...)
+
+  //! The compiled expressions of the calling thread, compiled on first use.
+  CompiledExpressions& local() const
+  {
+    auto& compiled = *compiled_;
+    if (!compiled)
+      compiled = std::make_unique<CompiledExpressions>(placeholders_, translated_expressions_, expressions_);
+    return *compiled;
   }
 
-private:
   //! Candidate placeholder identifier; a plain alphanumeric token (ExprTk rejects names starting with an
   //! underscore). The caller skips candidates that collide with identifiers present in the source.
   static std::string make_placeholder(std::size_t index)
@@ -210,10 +347,11 @@ private:
 
   std::vector<std::string> variables_;
   std::vector<std::string> expressions_;
-  mutable std::vector<double> values_;
   std::unordered_map<std::string, std::string> name_to_placeholder_;
-  exprtk::symbol_table<double> symbol_table_;
-  std::vector<exprtk::expression<double>> compiled_;
+  std::vector<std::string> placeholders_;
+  std::vector<std::string> translated_expressions_;
+  mutable Common::PerThreadValue<std::unique_ptr<CompiledExpressions>> compiled_;
+  NativeExpressionsType native_ = nullptr;
 }; // class MathExpressionEngine::Impl
 
 
@@ -242,5 +380,29 @@ void MathExpressionEngine::evaluate(const double* values,
   impl_->evaluate(values, num_values, results, num_results);
 }
 
+void MathExpressionEngine::evaluate_batch(const double* values,
+                                          std::size_t num_points,
+                                          std::size_t num_values,
+                                          double* results,
+                                          std::size_t num_results) const
+{
+  impl_->evaluate_batch(values, num_points, num_values, results, num_results);
+}
+
+bool MathExpressionEngine::native() const
+{
+  return impl_->native();
+}
+
+void MathExpressionEngine::enable_native_compilation(const bool enabled)
+{
+  native_compilation_flag() = enabled;
+}
+
+bool MathExpressionEngine::native_compilation_enabled()
+{
+  return native_compilation_flag();
+}
+
 
 } // namespace Dune::XT::Functions::internal
@@ -36,6 +36,11 @@ namespace Dune::XT::Functions::internal {
  * \note Implicit multiplication by juxtaposition is supported, e.g. "x[0]t" means "x[0]*t",
  *       "x[0]2" means "x[0]*2" and "sin(t)(x)" means "sin(t)*(x)". An explicit \c * is still
  *       recommended for readability.
+ *
+ * Optionally (see enable_native_compilation()), the expressions are additionally translated to C++ and compiled to
+ * native code on construction (see compile_native_expressions() for the compiler and the disk cache used), which is
+ * then used for all evaluations. If the expressions cannot be compiled, or if the native evaluation does not coincide
+ * with ExprTk's at a few sample points, ExprTk is used as usual.
  */
 class MathExpressionEngine
 {
@@ -65,11 +70,36 @@ public:
    * \a values holds one entry per variable (in the order given to the constructor) and \a results one
    * entry per expression.
    *
-   * \note Not thread-safe: callers must serialize access (the wrappers hold a mutex), matching the
-   *       behavior of the previously bundled parser.
+   * \note Thread-safe: each thread evaluates its own copy of the compiled expressions (created on the first
+   *       evaluation in that thread), so concurrent calls do not need to be serialized.
    */
   void evaluate(const double* values, std::size_t num_values, double* results, std::size_t num_results) const;
 
+  /**
+   * \brief Evaluate all expressions at \a num_points sets of variable values at once.
+   *
+   * \a values holds num_points * num_values entries (the values of all variables for the first point, then for
+   * the second point, ...) and \a results num_points * num_results entries in the same layout. Equivalent to
+   * calling evaluate() for each point, but looks up the thread-local expressions only once.
+   */
+  void evaluate_batch(const double* values,
+                      std::size_t num_points,
+                      std::size_t num_values,
+                      double* results,
+                      std::size_t num_results) const;
+
+  //! True if this engine evaluates natively compiled code instead of ExprTk.
+  bool native() const;
+
+  /**
+   * \brief Enables or disables the native compilation of all subsequently constructed engines.
+   *
+   * Disabled by default, unless the environment variable DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE is set to 1 (or ON, true).
+   */
+  static void enable_native_compilation(bool enabled = true);
+
+  static bool native_compilation_enabled();
+
 private:
   class Impl;
   std::unique_ptr<Impl> impl_;
@@ -0,0 +1,501 @@
+// This file is part of the dune-xt project:
+//   https://zivgitlab.uni-muenster.de/ag-ohlberger/dune-community/dune-xt
+// Copyright 2009-2021 dune-xt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include "config.h"
+
+#include "native.hh"
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+#include <dune/xt/common/filesystem.hh>
+
+#if HAVE_MPI
+#  include <mpi.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <dlfcn.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE 1
+#else
+#  define DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE 0
+#endif
+
+namespace Dune::XT::Functions::internal {
+namespace {
+
+
+/**
+ * \brief Recursive descent translation of a single expression to C++.
+ *
+ * Grammar (whitespace is ignored between tokens):
+ * \code
+ * sum     := product (('+' | '-') product)*
+ * product := unary (('*' | '/') unary | power)*    (the second alternative is implicit multiplication)
+ * unary   := ('-' | '+') unary | power
+ * power   := primary ('^' unary)?
+ * primary := number | variable | constant | function '(' sum (',' sum)* ')' | '(' sum ')'
+ * \endcode
+ * Every translated subexpression is parenthesized, so the C++ compiler sees exactly the structure parsed here.
+ */
+class CppTranslator
+{
+public:
+  CppTranslator(const std::string& expression, const std::unordered_map<std::string, size_t>& variable_indices)
+    : expression_(expression)
+    , variable_indices_(variable_indices)
+  {
+  }
+
+  bool translate(std::string& result)
+  {
+    pos_ = 0;
+    if (!parse_sum(result))
+      return false;
+    skip_whitespace();
+    return pos_ == expression_.size();
+  }
+
+private:
+  char peek()
+  {
+    skip_whitespace();
+    return pos_ < expression_.size() ? expression_[pos_] : '\0';
+  }
+
+  void skip_whitespace()
+  {
+    while (pos_ < expression_.size() && (std::isspace(static_cast<unsigned char>(expression_[pos_])) != 0))
+      ++pos_;
+  }
+
+  static bool is_identifier_start(const char c)
+  {
+    return (std::isalpha(static_cast<unsigned char>(c)) != 0) || c == '_';
+  }
+
+  static bool is_digit(const char c)
+  {
+    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+  }
+
+  static bool starts_primary(const char c)
+  {
+    return is_identifier_start(c) || is_digit(c) || c == '.' || c == '(';
+  }
+
+  bool parse_sum(std::string& result)
+  {
+    if (!parse_product(result))
+      return false;
+    for (char op = peek(); op == '+' || op == '-'; op = peek()) {
+      ++pos_;
+      std::string rhs;
+      if (!parse_product(rhs))
+        return false;
+      result = "(" + result + " " + op + " " + rhs + ")";
+    }
+    return true;
+  } // ... parse_sum(...)
+
+  bool parse_product(std::string& result)
+  {
+    if (!parse_unary(result))
+      return false;
+    while (true) {
+      const char op = peek();
+      std::string rhs;
+      if (op == '*' || op == '/') {
+        ++pos_;
+        if (!parse_unary(rhs))
+          return false;
+        result = "(" + result + " " + op + " " + rhs + ")";
+      } else if (starts_primary(op)) {
+        if (!parse_power(rhs))
+          return false;
+        result = "(" + result + " * " + rhs + ")";
+      } else
+        return true;
+    }
+  } // ... parse_product(...)
+
+  bool parse_unary(std::string& result)
+  {
+    const char op = peek();
+    if (op == '-' || op == '+') {
+      ++pos_;
+      std::string operand;
+      if (!parse_unary(operand))
+        return false;
+      result = std::string("(") + op + operand + ")";
+      return true;
+    }
+    return parse_power(result);
+  }
+
+  bool parse_power(std::string& result)
+  {
+    if (!parse_primary(result))
+      return false;
+    if (peek() != '^')
+      return true;
+    ++pos_;
+    std::string exponent;
+    if (!parse_unary(exponent))
+      return false;
+    result = "std::pow(" + result + ", " + exponent + ")";
+    return true;
+  }
+
+  bool parse_primary(std::string& result)
+  {
+    const char c = peek();
+    if (c == '(') {
+      ++pos_;
+      if (!parse_sum(result) || peek() != ')')
+        return false;
+      ++pos_;
+      result = "(" + result + ")";
+      return true;
+    }
+    if (is_digit(c) || c == '.')
+      return parse_number(result);
+    if (is_identifier_start(c))
+      return parse_identifier(result);
+    return false;
+  } // ... parse_primary(...)
+
+  bool parse_number(std::string& result)
+  {
+    const char* begin = expression_.c_str() + pos_;
+    char* end = nullptr;
+    const double value = std::strtod(begin, &end);
+    // strtod also accepts hexadecimal literals, infinities and the like, which are no numbers in our syntax
+    for (const char* it = begin; it != end; ++it)
+      if (!is_digit(*it) && *it != '.' && *it != 'e' && *it != 'E' && *it != '+' && *it != '-')
+        return false;
+    if (end == begin || !std::isfinite(value))
+      return false;
+    pos_ += static_cast<size_t>(end - begin);
+    // hexadecimal floating point literals represent the parsed value exactly
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%a", value);
+    result = buffer;
+    return true;
+  } // ... parse_number(...)
+
+  bool parse_identifier(std::string& result)
+  {
+    // same tokenization as in MathExpressionEngine: an identifier, optionally followed by a bracketed integer index
+    const size_t begin = pos_;
+    ++pos_;
+    while (pos_ < expression_.size()
+           && ((std::isalnum(static_cast<unsigned char>(expression_[pos_])) != 0) || expression_[pos_] == '_'))
+      ++pos_;
+    if (pos_ < expression_.size() && expression_[pos_] == '[') {
+      size_t kk = pos_ + 1;
+      while (kk < expression_.size() && is_digit(expression_[kk]))
+        ++kk;
+      if (kk < expression_.size() && expression_[kk] == ']' && kk > pos_ + 1)
+        pos_ = kk + 1;
+    }
+    const std::string name = expression_.substr(begin, pos_ - begin);
+    const auto variable = variable_indices_.find(name);
+    if (variable != variable_indices_.end()) {
+      result = "values[" + std::to_string(variable->second) + "]";
+      return true;
+    }
+    if (peek() == '(')
+      return parse_function_call(name, result);
+    if (name == "pi") {
+      result = "0x1.921fb54442d18p+1";
+      return true;
+    }
+    if (name == "e") {
+      result = "0x1.5bf0a8b145769p+1";
+      return true;
+    }
+    return false;
+  } // ... parse_identifier(...)
+
+  bool parse_function_call(const std::string& name, std::string& result)
+  {
+    static const std::map<std::string, std::pair<std::string, size_t>> functions{{"sin", {"std::sin", 1}},
+                                                                                 {"cos", {"std::cos", 1}},
+                                                                                 {"tan", {"std::tan", 1}},
+                                                                                 {"asin", {"std::asin", 1}},
+                                                                                 {"acos", {"std::acos", 1}},
+                                                                                 {"atan", {"std::atan", 1}},
+                                                                                 {"sinh", {"std::sinh", 1}},
+                                                                                 {"cosh", {"std::cosh", 1}},
+                                                                                 {"tanh", {"std::tanh", 1}},
+                                                                                 {"exp", {"std::exp", 1}},
+                                                                                 {"log", {"std::log", 1}},
+                                                                                 {"ln", {"std::log", 1}},
+                                                                                 {"log10", {"std::log10", 1}},
+                                                                                 {"sqrt", {"std::sqrt", 1}},
+                                                                                 {"abs", {"std::abs", 1}},
+                                                                                 {"floor", {"std::floor", 1}},
+                                                                                 {"ceil", {"std::ceil", 1}},
+                                                                                 {"pow", {"std::pow", 2}},
+                                                                                 {"atan2", {"std::atan2", 2}},
+                                                                                 {"min", {"std::fmin", 2}},
+                                                                                 {"max", {"std::fmax", 2}}};
+    const auto function = functions.find(name);
+    if (function == functions.end())
+      return false;
+    ++pos_; // the '('
+    result = function->second.first + "(";
+    for (size_t ii = 0; ii < function->second.second; ++ii) {
+      std::string argument;
+      if (!parse_sum(argument))
+        return false;
+      result += (ii > 0 ? ", " : "") + argument;
+      if (peek() != (ii + 1 < function->second.second ? ',' : ')'))
+        return false;
+      ++pos_;
+    }
+    result += ")";
+    return true;
+  } // ... parse_function_call(...)
+
+  const std::string& expression_;
+  const std::unordered_map<std::string, size_t>& variable_indices_;
+  size_t pos_ = 0;
+}; // class CppTranslator
+
+
+const char* const native_symbol_name = "dune_xt_functions_native_expressions";
+
+
+//! 64 bit FNV-1a hash, stable across platforms and runs (unlike std::hash).
+std::uint64_t stable_hash(const std::string& str)
+{
+  std::uint64_t hash = 14695981039346656037ull;
+  for (const char c : str) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+
+std::string environment_variable(const char* name)
+{
+  const char* value = std::getenv(name);
+  return (value != nullptr) ? std::string(value) : std::string();
+}
+
+
+//! The cache directory, or an empty path if there is no per-user location (a shared one, e.g. in /tmp, is not used).
+boost::filesystem::path cache_directory()
+{
+  const std::string dir = environment_variable("DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_CACHE_DIR");
+  if (!dir.empty())
+    return dir;
+  const std::string xdg_cache_home = environment_variable("XDG_CACHE_HOME");
+  if (!xdg_cache_home.empty())
+    return boost::filesystem::path(xdg_cache_home) / "dune-xt" / "expressions";
+  const std::string home = environment_variable("HOME");
+  if (!home.empty())
+    return boost::filesystem::path(home) / ".cache" / "dune-xt" / "expressions";
+  return {};
+} // ... cache_directory(...)
+
+
+#if DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE
+
+
+//! Whether we may not start the compiler, since forking is not safe within a running parallel MPI program.
+bool inside_mpi_run()
+{
+#  if HAVE_MPI
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  if (initialized == 0 || finalized != 0)
+    return false;
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size > 1;
+#  else
+  return false;
+#  endif
+} // ... inside_mpi_run(...)
+
+
+//! Whether path is owned by us and nobody else may write to it (else anybody could plant code we would load).
+bool is_private(const boost::filesystem::path& path, const bool directory)
+{
+  struct stat status;
+  if (lstat(path.c_str(), &status) != 0)
+    return false;
+  if ((directory ? S_ISDIR(status.st_mode) : S_ISREG(status.st_mode)) == 0)
+    return false;
+  // directories have to be accessible by us only (mode 0700), files must not be writable by others
+  const mode_t forbidden = directory ? (S_IRWXG | S_IRWXO) : (S_IWGRP | S_IWOTH);
+  return status.st_uid == geteuid() && (status.st_mode & forbidden) == 0;
+}
+
+
+//! Creates the cache directory with mode 0700, returns false if it is not private to us.
+bool prepare_cache_directory(const boost::filesystem::path& directory)
+{
+  struct stat status;
+  if (lstat(directory.c_str(), &status) != 0) {
+    Common::create_directory(directory.string());
+    if (chmod(directory.c_str(), S_IRWXU) != 0)
+      return false;
+  } else if (S_ISDIR(status.st_mode) && status.st_uid == geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0) {
+    // ours, and nobody else could have put anything in there, so we may restrict it
+    if (chmod(directory.c_str(), S_IRWXU) != 0)
+      return false;
+  }
+  return is_private(directory, /*directory=*/true);
+} // ... prepare_cache_directory(...)
+
+
+#endif // DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE
+
+
+std::string quoted(const std::string& str)
+{
+  std::string result = "'";
+  for (const char c : str)
+    result += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+  return result + "'";
+}
+
+
+} // namespace
+
+
+std::string translate_expressions_to_cpp(const std::vector<std::string>& variables,
+                                         const std::vector<std::string>& expressions)
+{
+  std::unordered_map<std::string, size_t> variable_indices;
+  for (size_t ii = 0; ii < variables.size(); ++ii)
+    variable_indices[variables[ii]] = ii;
+  std::ostringstream result;
+  for (size_t ii = 0; ii < expressions.size(); ++ii) {
+    std::string translation;
+    if (!CppTranslator(expressions[ii], variable_indices).translate(translation))
+      return "";
+    result << "  results[" << ii << "] = " << translation << ";\n";
+  }
+  return result.str();
+} // ... translate_expressions_to_cpp(...)
+
+
+NativeExpressionsType compile_native_expressions(const std::vector<std::string>& variables,
+                                                 const std::vector<std::string>& expressions)
+{
+#if DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE
+  const std::string statements = translate_expressions_to_cpp(variables, expressions);
+  if (statements.empty())
+    return nullptr;
+  std::ostringstream source;
+  // the expressions are only documented in a block comment, where a trailing backslash cannot continue the line
+  source << "/* generated by dune-xt, do not edit\n";
+  for (const auto& expression : expressions) {
+    std::string text;
+    for (const char c : expression) {
+      if (c == '/' && !text.empty() && text.back() == '*')
+        text += ' ';
+      text += (c == '\n' || c == '\r') ? ' ' : c;
+    }
+    source << " *   " << text << "\n";
+  }
+  source << " */\n#include <cmath>\n\n"
+         << "extern \"C\" void " << native_symbol_name << "(const double* values, double* results)\n"
+         << "{\n"
+         << statements << "}\n";
+  std::string compiler = environment_variable("DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_COMPILER");
+  if (compiler.empty())
+    compiler = "c++";
+  const std::string flags = "-std=c++17 -O2 -fPIC -shared";
+  char hash[17];
+  std::snprintf(hash,
+                sizeof(hash),
+                "%016llx",
+                static_cast<unsigned long long>(stable_hash(compiler + "\n" + flags + "\n" + source.str())));
+  const auto directory = cache_directory();
+  if (directory.empty())
+    return nullptr;
+  const auto library = directory / ("expressions_" + std::string(hash) + ".so");
+
+  // all native expressions of this process are loaded under this lock, and never unloaded
+  static std::mutex mutex;
+  static std::map<std::string, NativeExpressionsType> loaded;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    const auto search_result = loaded.find(library.string());
+    if (search_result != loaded.end())
+      return search_result->second;
+  }
+  // compile without holding the lock (other threads may load other expressions meanwhile), concurrent compilations of
+  // the same expressions are harmless, see below
+  try {
+    if (!prepare_cache_directory(directory))
+      return nullptr;
+    if (!boost::filesystem::exists(library)) {
+      if (inside_mpi_run())
+        return nullptr;
+      // compile to a unique temporary name and rename afterwards, so that concurrent processes never load a partially
+      // written library
+      const auto unique = boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%").string();
+      const auto source_file = directory / ("expressions_" + std::string(hash) + "." + unique + ".cc");
+      const auto temporary_library = directory / ("expressions_" + std::string(hash) + "." + unique + ".so");
+      *Common::make_ofstream(source_file) << source.str();
+      const std::string command = compiler + " " + flags + " -o " + quoted(temporary_library.string()) + " "
+                                  + quoted(source_file.string()) + " > /dev/null 2>&1";
+      const int status = std::system(command.c_str());
+      boost::filesystem::remove(source_file);
+      if (status != 0 || !boost::filesystem::exists(temporary_library)) {
+        boost::filesystem::remove(temporary_library);
+        return nullptr;
+      }
+      boost::filesystem::rename(temporary_library, library);
+    }
+  } catch (const boost::filesystem::filesystem_error&) {
+    return nullptr;
+  }
+  if (!is_private(library, /*directory=*/false))
+    return nullptr;
+  std::lock_guard<std::mutex> guard(mutex);
+  const auto search_result = loaded.find(library.string());
+  if (search_result != loaded.end())
+    return search_result->second;
+  void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle == nullptr)
+    return nullptr;
+  const auto symbol = reinterpret_cast<NativeExpressionsType>(dlsym(handle, native_symbol_name));
+  if (symbol == nullptr) {
+    dlclose(handle);
+    return nullptr;
+  }
+  loaded[library.string()] = symbol;
+  return symbol;
+#else // DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_AVAILABLE
+  return nullptr;
+#endif
+} // ... compile_native_expressions(...)
+
+
+} // namespace Dune::XT::Functions::internal
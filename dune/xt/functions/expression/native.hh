@@ -0,0 +1,69 @@
+// This file is part of the dune-xt project:
+//   https://zivgitlab.uni-muenster.de/ag-ohlberger/dune-community/dune-xt
+// Copyright 2009-2021 dune-xt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/// \file
+/// \brief Compiles mathematical expression strings to native code (via the system C++ compiler), with a disk cache.
+
+#ifndef DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_HH
+#define DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_HH
+
+#include <string>
+#include <vector>
+
+namespace Dune::XT::Functions::internal {
+
+
+/**
+ * \brief Natively compiled expressions: \a values holds one entry per variable, \a results one entry per expression.
+ *
+ * Such a function has no state and may be called concurrently from any number of threads.
+ */
+using NativeExpressionsType = void (*)(const double* values, double* results);
+
+
+/**
+ * \brief Translates \a expressions (in the syntax accepted by MathExpressionEngine) to C++ statements.
+ *
+ * The result assigns the value of the ii-th expression to results[ii], reading the variables from values[jj] (in the
+ * order of \a variables). Only the operators \c + \c - \c * \c / \c ^, implicit multiplication, the constants \c pi
+ * and \c e and the functions \c sin, \c cos, \c tan, \c asin, \c acos, \c atan, \c sinh, \c cosh, \c tanh, \c exp,
+ * \c log (alias \c ln), \c log10, \c sqrt, \c abs, \c floor, \c ceil, \c pow, \c atan2, \c min and \c max are
+ * supported.
+ *
+ * \return The translation, or an empty string if an expression contains anything else.
+ */
+std::string translate_expressions_to_cpp(const std::vector<std::string>& variables,
+                                         const std::vector<std::string>& expressions);
+
+
+/**
+ * \brief Compiles \a expressions to native code, see translate_expressions_to_cpp().
+ *
+ * The translation is compiled into a shared object by the system C++ compiler, which is loaded into the running
+ * process. Shared objects are cached on disk, keyed by a hash of the generated source and the compiler command, so
+ * the same expressions are only compiled once across runs (and processes). The following environment variables are
+ * respected:
+ * - DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_COMPILER: the compiler to use (default: c++),
+ * - DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_CACHE_DIR: the cache directory (default: ${XDG_CACHE_HOME}/dune-xt/expressions
+ *   or ${HOME}/.cache/dune-xt/expressions).
+ *
+ * Shared objects are only loaded from a cache directory which belongs to the current user and is not accessible by
+ * anybody else (mode 0700, a new one is created that way), and only if nobody else may write to them. Within an MPI
+ * program running on several ranks, the compiler is not started (forking is not safe there), but shared objects
+ * cached by earlier runs are still loaded.
+ *
+ * \return The compiled expressions, or nullptr if the expressions cannot be translated, there is no suitable cache
+ *         directory, no compiler is available, the compilation fails or the platform does not support loading shared
+ *         objects.
+ */
+NativeExpressionsType compile_native_expressions(const std::vector<std::string>& variables,
+                                                 const std::vector<std::string>& expressions);
+
+
+} // namespace Dune::XT::Functions::internal
+
+#endif // DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_HH
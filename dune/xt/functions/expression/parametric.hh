@@ -143,11 +143,10 @@ public:
     }
     DynamicVector<D> args(num_parameter_variables_ + domain_dim);
     size_t II = 0;
-    for (const auto& key : this->parameter_type().keys()) {
-      for (const auto& value : parsed_param.get(key)) {
-        args[II] = value;
-        ++II;
-      }
+    // parsed_param is of our type, so its contiguous values are ordered as our keys
+    for (const auto& value : parsed_param.values()) {
+      args[II] = value;
+      ++II;
     }
     for (size_t ii = 0; ii < domain_dim; ++ii) {
       args[II] = point_in_global_coordinates[ii];
@@ -24,6 +24,7 @@
 
 #include <dune/common/fvector.hh>
 
+#include <dune/geometry/quadraturerules.hh>
 #include <dune/geometry/referenceelements.hh>
 
 #include <dune/xt/common/float_cmp.hh>
@@ -219,6 +220,36 @@ assert(max_set_size <= local_function_set.max_size());
           "This set of element functions does not provide arbitrary derivatives, override the 'derivatives' method!");
   }
 
+  /**
+   * \brief Variant of evaluate() at the point_index-th point of the given quadrature rule.
+   *
+   * Sets of functions whose values on the reference element do not depend on the element (e.g., finite element bases)
+   * may override this to serve the values from a tabulation instead of evaluating them at each call.
+   *
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void evaluate_at_quadrature_point(const QuadratureRule<D, d>& quadrature,
+                                            const size_t point_index,
+                                            std::vector<RangeType>& result,
+                                            const Common::Parameter& param = {}) const
+  {
+    this->evaluate(quadrature[point_index].position(), result, param);
+  }
+
+  /**
+   * \brief Variant of jacobians() at the point_index-th point of the given quadrature rule.
+   *
+   * \sa evaluate_at_quadrature_point
+   * \note Will throw Exceptions::not_bound_to_an_element_yet error if not bound yet!
+   **/
+  virtual void jacobians_at_quadrature_point(const QuadratureRule<D, d>& quadrature,
+                                             const size_t point_index,
+                                             std::vector<DerivativeRangeType>& result,
+                                             const Common::Parameter& param = {}) const
+  {
+    this->jacobians(quadrature[point_index].position(), result, param);
+  }
+
   /**
    * \{
    * \name ´´These methods are provided for convenience and should not be used within library code.''
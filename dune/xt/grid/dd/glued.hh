@@ -19,9 +19,16 @@
 #include <algorithm>
 #include <memory>
 #include <map>
+#include <optional>
+#include <vector>
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <dune/common/parallel/mpihelper.hh>
+
 #include <dune/grid/common/rangegenerators.hh>
 
 #if HAVE_DUNE_GRID_GLUE
@@ -163,6 +170,20 @@ class Glued
   static_assert(allowed_local_grid<LocalGridImp>::value,
                 "This local grid is known to fail, enable on your onw risk by disabling this check!");
 
+  // Grids created by a GridFactory may rely on global state (UGGrid does), so only local grids known to be
+  // independent of each other are created concurrently.
+  template <class G, bool anything = true>
+  struct local_grids_are_independent
+  {
+    static constexpr bool value = false;
+  };
+
+  template <int dim, class Coordinates, bool anything>
+  struct local_grids_are_independent<YaspGrid<dim, Coordinates>, anything>
+  {
+    static constexpr bool value = true;
+  };
+
 public:
   using MacroGridType = MacroGridImp;
   using MacroGridProviderType = XT::Grid::GridProvider<MacroGridType>;
@@ -188,6 +209,26 @@ public:
   using GlueType = GridGlue::GridGlue<LocalExtractorType, LocalExtractorType>;
 
 private:
+  using MacroSeedType = typename MacroGridType::template Codim<0>::EntitySeed;
+  using MicroSeedType = typename LocalGridType::template Codim<0>::EntitySeed;
+
+  // A coupling glue, together with its number of broken coupling intersections (counted on first demand).
+  struct GlueEntry
+  {
+    std::shared_ptr<GlueType> glue;
+    std::optional<size_t> num_broken_intersections;
+  };
+
+  // The glues of one coupling, i.e. of an ordered pair of neighboring macro entities: for Layers::level, one per pair
+  // of local levels (the level of the neighbor being the fast index), for Layers::leaf, a single one, which is valid as
+  // long as the local leaf views have the recorded sizes.
+  struct CouplingGlues
+  {
+    std::array<size_t, 2> num_local_levels = {{0, 0}};
+    std::array<size_t, 2> local_leaf_sizes = {{0, 0}};
+    std::vector<GlueEntry> glues;
+  };
+
   template <class GridView, class MacroIntersectionType>
   class CouplingFaceDescriptor
   {
@@ -237,14 +278,9 @@ public:
     , macro_leaf_view_(macro_grid_.leaf_view())
     , macro_leaf_view_size_(macro_leaf_view_.indexSet().size(0))
     , local_grids_(macro_leaf_view_.indexSet().size(0), nullptr)
-    , glues_(macro_leaf_view_.indexSet().size(0))
   {
-    setup_local_grids();
-    if (num_local_refinements > 0)
-      for (auto& local_grid_provider : local_grids_) {
-        assert(local_grid_provider);
-        local_grid_provider->grid().globalRefine(boost::numeric_cast<int>(num_local_refinements));
-      }
+    setup_couplings();
+    setup_local_grids(num_local_refinements);
     if (prepare_glues)
       setup_glues(allow_for_broken_orientation_of_coupling_intersections);
   } // Glued(...)
@@ -260,14 +296,9 @@ public:
     , macro_leaf_view_(macro_grid_.leaf_view())
     , macro_leaf_view_size_(macro_leaf_view_.indexSet().size(0))
     , local_grids_(macro_leaf_view_.indexSet().size(0), nullptr)
-    , glues_(macro_leaf_view_.indexSet().size(0))
   {
-    setup_local_grids(num_elements_per_subdomain);
-    if (num_local_refinements > 0)
-      for (auto& local_grid_provider : local_grids_) {
-        assert(local_grid_provider);
-        local_grid_provider->grid().globalRefine(boost::numeric_cast<int>(num_local_refinements));
-      }
+    setup_couplings();
+    setup_local_grids(num_elements_per_subdomain, num_local_refinements);
     if (prepare_glues)
       setup_glues(allow_for_broken_orientation_of_coupling_intersections);
   } // Glued(...)
@@ -307,10 +338,10 @@ public:
     return global_grid_->level_view(global_grid_->grid().maxLevel());
   }
 
+  /// \brief Maps (subdomain, local element index) to the index of the element in the global micro grid.
+  /// \note  The global micro grid and the maps of indices are built once, on first demand.
   const std::vector<std::vector<size_t>>& local_to_global_indices()
   {
-    auto logger = XT::Common::TimedLogger().get("grid-multiscale.glued.local_to_global_indices");
-    logger.warn() << "Requiring inefficient access to global micro grid!" << std::endl;
     assert_macro_grid_state();
     prepare_global_grid();
     return *local_to_global_indices_;
@@ -324,57 +355,42 @@ public:
 
   MicroEntityType local_to_global_entity(const size_t subd, const size_t local_entity_index)
   {
-    auto logger = XT::Common::TimedLogger().get("grid-multiscale.glued.local_to_global_entity");
-    logger.warn() << "Requiring inefficient access to global micro grid!" << std::endl;
     assert_macro_grid_state();
     prepare_global_grid();
+    DUNE_THROW_IF(subd >= local_to_global_indices_->size()
+                      || local_entity_index >= local_to_global_indices_->operator[](subd).size(),
+                  XT::Common::Exceptions::wrong_input_given,
+                  "subdomain: " << subd << "\n"
+                                << "local_entity_index: " << local_entity_index);
     const size_t global_index_of_local_entity = local_to_global_indices_->operator[](subd)[local_entity_index];
-    const auto global_micro_grid_view = global_grid_view();
-    for (auto&& entity : elements(global_micro_grid_view)) {
-      if (global_micro_grid_view.indexSet().index(entity) == global_index_of_local_entity)
-        return entity;
-    }
-    DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
-               "subdomain: " << subd << "\n"
-                             << "local_entity_index: " << local_entity_index << "\n"
-                             << "global_index_of_local_entity: " << global_index_of_local_entity);
-    return *global_micro_grid_view.template begin<0>();
+    return global_grid_->grid().entity(global_entity_seeds_[global_index_of_local_entity]);
   } // ... local_to_global_entity(...)
 
   MicroEntityType global_to_local_entity(const MicroEntityType& micro_entity)
   {
     assert_macro_grid_state();
     prepare_global_grid();
-    return global_to_local_entity(global_grid_view().indexSet().index(micro_entity));
+    return global_to_local_entity(global_grid_->leaf_view().indexSet().index(micro_entity));
   }
 
   MicroEntityType global_to_local_entity(const size_t micro_entity_index)
   {
-    auto logger = XT::Common::TimedLogger().get("grid-multiscale.glued.global_to_local_entity");
-    logger.warn() << "Requiring inefficient access to global micro grid!" << std::endl;
     assert_macro_grid_state();
     prepare_global_grid();
-    auto subdomain_and_local_entity_index = global_to_local_indices_->operator[](micro_entity_index);
+    DUNE_THROW_IF(micro_entity_index >= global_to_local_indices_->size(),
+                  XT::Common::Exceptions::wrong_input_given,
+                  "micro_entity_index: " << micro_entity_index << "\n"
+                                         << "global_to_local_indices().size(): " << global_to_local_indices_->size());
+    const auto& subdomain_and_local_entity_index = global_to_local_indices_->operator[](micro_entity_index);
     const auto subd = subdomain_and_local_entity_index.first;
     const auto local_index_of_global_entity = subdomain_and_local_entity_index.second;
-    const auto local_grid_view = extract_local_view<layer>()(*local_grids_[subd], max_local_level(subd));
-    for (auto&& entity : elements(local_grid_view)) {
-      if (local_grid_view.indexSet().index(entity) == local_index_of_global_entity)
-        return entity;
-    }
-    DUNE_THROW(XT::Common::Exceptions::wrong_input_given,
-               "micro_entity_index: " << micro_entity_index
-                                      << "\n"
-                                         "subdomain: "
-                                      << subd << "\n"
-                                      << "local_index_of_global_entity: " << local_index_of_global_entity);
-    return *local_grid_view.template begin<0>();
+    return local_grids_[subd]->grid().entity(local_entity_seeds_[subd][local_index_of_global_entity]);
   } // ... global_to_local_entity(...)
 
+  /// \brief Maps the index of an element of the global micro grid to (subdomain, local element index).
+  /// \note  The global micro grid and the maps of indices are built once, on first demand.
   const std::vector<std::pair<size_t, size_t>>& global_to_local_indices()
   {
-    auto logger = XT::Common::TimedLogger().get("grid-multiscale.glued.global_to_local_indices");
-    logger.warn() << "Requiring inefficient access to global micro grid!" << std::endl;
     assert_macro_grid_state();
     prepare_global_grid();
     assert(global_to_local_indices_);
@@ -413,8 +429,8 @@ public:
    * \brief Returns (and creates, if it does not exist) the coupling glue between the local grid view of level
    *        local_level_macro_entity on macro_entity and the local grid view of level local_level_macro_neighbor on
    * macro_neighbor.
-   * \note  Access is not implemented efficiently. This could be improved by using std::map::find instead of
-   *        std::map::operator[].
+   * \note  The glues are stored in one flat table, with one slot per coupling (found by a binary search among the few
+   *        neighbors of macro_entity) and pair of local levels, and the orientation of each glue is checked only once.
    */
   const GlueType& coupling(const MacroEntityType& macro_entity,
                            const int local_level_macro_entity,
@@ -435,8 +451,6 @@ public:
                  "max_local_level(macro_neighbor): " << max_local_level(macro_neighbor) << "\n"
                                                      << "   local_level_macro_neighbor:      "
                                                      << local_level_macro_neighbor);
-    int local_entity_grid_level = local_level_macro_entity;
-    int local_neighbor_grid_level = local_level_macro_neighbor;
     // in case of local level views, the local_level_macro... have to be non-negative
     if (layer == Layers::level) {
       if (local_level_macro_entity < 0)
@@ -453,55 +467,23 @@ public:
       if (local_level_macro_neighbor != -1)
         DUNE_THROW(XT::Common::Exceptions::you_are_using_this_wrong,
                    "local_level_macro_neighbor has to be -1 (is " << local_level_macro_neighbor << ")!");
-      // since the local leaf views may have been adapted, we use their respective sizes as keys for the glue map
-      local_entity_grid_level *= local_grid(macro_entity).leaf_view().indexSet().size(0);
-      local_neighbor_grid_level *= local_grid(macro_neighbor).leaf_view().indexSet().size(0);
     }
     const auto entity_index = macro_index_set.index(macro_entity);
     const auto neighbor_index = macro_index_set.index(macro_neighbor);
-    auto& glues_for_this_entity_neighbor = glues_[entity_index][neighbor_index];
-    if (glues_for_this_entity_neighbor[local_entity_grid_level][local_neighbor_grid_level] == nullptr) {
-      if (layer == Layers::leaf) {
-        // if the glue for the current leaf sizes does not exist, but for other leaf sizes, then those are not valid any
-        // more and we can get rid of them
-        if (glues_for_this_entity_neighbor.size() > 0)
-          glues_for_this_entity_neighbor.clear();
-      }
+    auto& entry = glue_entry(entity_index, neighbor_index, local_level_macro_entity, local_level_macro_neighbor);
+    if (!entry.glue) {
       // find the corresponding macro intersection ...
       for (auto&& macro_intersection : intersections(macro_leaf_view_, macro_entity)) {
         if (!macro_intersection.neighbor() || macro_intersection.boundary())
           continue;
-        const auto real_neighbor_ptr = macro_intersection.outside();
-#  if DUNE_VERSION_GTE(DUNE_GRID, 2, 4)
-        const auto& real_neighbor = real_neighbor_ptr;
-#  else
-        const auto& real_neighbor = *real_neighbor_ptr;
-#  endif
-        if (macro_index_set.index(real_neighbor) == neighbor_index)
-          glues_for_this_entity_neighbor[local_entity_grid_level][local_neighbor_grid_level] =
-              create_glue(macro_entity,
-                          macro_neighbor,
-                          macro_intersection,
-                          (layer == Layers::level) ? local_entity_grid_level : -1,
-                          (layer == Layers::level) ? local_neighbor_grid_level : -1);
+        if (macro_index_set.index(macro_intersection.outside()) == neighbor_index)
+          entry.glue = create_glue(
+              macro_entity, macro_neighbor, macro_intersection, local_level_macro_entity, local_level_macro_neighbor);
       } // ... find the corresponding macro intersection
     }
-
-    const auto& glue = *(glues_for_this_entity_neighbor[local_entity_grid_level][local_neighbor_grid_level]);
-    if (!allow_for_broken_orientation_of_coupling_intersections) {
-      const size_t brocken_intersections = check_for_broken_coupling_intersections(glue);
-      if (brocken_intersections > 0)
-        DUNE_THROW(Exceptions::intersection_orientation_is_broken,
-                   "The coupling glue between the grid views of\n"
-                       << "     level " << local_entity_grid_level << " on macro entity   "
-                       << macro_leaf_view_.indexSet().index(macro_entity) << " and\n"
-                       << "     level " << local_neighbor_grid_level << " on macro neighbor "
-                       << macro_leaf_view_.indexSet().index(macro_neighbor) << "\n"
-                       << "   contains\n"
-                       << "     " << brocken_intersections << "/" << glue.size()
-                       << " intersections with wrong orientation!");
-    }
-    return glue;
+    if (!allow_for_broken_orientation_of_coupling_intersections)
+      check_orientation(entry, entity_index, local_level_macro_entity, neighbor_index, local_level_macro_neighbor);
+    return *entry.glue;
   } // ... coupling(...)
 
   const GlueType& coupling(const MacroEntityType& macro_entity,
@@ -804,30 +786,157 @@ private:
     return create_grid_of_cube(macro_entity, num_elements);
   }
 
-  void setup_local_grids()
+  // The local grids live on the world communicator (and GridGlue::build() queries it), so the local grids, their
+  // glues and anything else using them from several threads are only handled concurrently if there is no other rank
+  // to communicate with and if the local grids are known to be independent of each other.
+  static bool local_grids_may_be_created_concurrently()
   {
-    const auto& macro_index_set = macro_leaf_view_.indexSet();
-    for (auto&& macro_entity : elements(macro_leaf_view_)) {
-      auto macro_entity_index = macro_index_set.index(macro_entity);
-      if (macro_entity.type().isSimplex())
-        local_grids_[macro_entity_index] = create_grid_of_simplex(macro_entity);
-      else if (macro_entity.type().isCube())
-        local_grids_[macro_entity_index] = create_grid_of_cube(macro_entity);
-      else
-        DUNE_THROW(GridError, "Unknown entity.type() encountered: " << macro_entity.type());
-    }
-  } // ... setup_local_grids()
+    return MPIHelper::getCommunication().size() == 1 && local_grids_are_independent<LocalGridType>::value;
+  }
 
-  void setup_local_grids(const std::array<unsigned int, dimDomain>& num_elements_per_subdomain)
+  // Calls functor(macro_entity, macro_entity_index) for each macro entity, concurrently if requested.
+  template <class Functor>
+  void for_each_macro_entity(Functor&& functor, const bool concurrently) const
+  {
+    const auto apply_to_range = [&](const size_t begin, const size_t end) {
+      for (size_t ii = begin; ii < end; ++ii)
+        functor(macro_grid_.grid().entity(macro_entity_seeds_[ii]), ii);
+    };
+    if (concurrently)
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, macro_entity_seeds_.size()),
+                        [&](const tbb::blocked_range<size_t>& range) { apply_to_range(range.begin(), range.end()); });
+    else
+      apply_to_range(0, macro_entity_seeds_.size());
+  } // ... for_each_macro_entity(...)
+
+  // Stores the seeds of the macro entities and, for each macro entity, the sorted indices of its macro neighbors
+  // (compressed row storage), where the position of a neighbor identifies the coupling and thus its glues.
+  void setup_couplings()
   {
     const auto& macro_index_set = macro_leaf_view_.indexSet();
+    macro_entity_seeds_.resize(macro_leaf_view_size_);
+    std::vector<std::vector<size_t>> macro_neighbors(macro_leaf_view_size_);
     for (auto&& macro_entity : elements(macro_leaf_view_)) {
-      DUNE_THROW_IF(!macro_entity.type().isCube(),
-                    GridError,
-                    "Prescribing number of elements for local subdomain grids only suitable for cubic subdomains!");
-      auto macro_entity_index = macro_index_set.index(macro_entity);
-      local_grids_[macro_entity_index] = create_grid_of_cube(macro_entity, num_elements_per_subdomain);
+      const auto macro_entity_index = macro_index_set.index(macro_entity);
+      macro_entity_seeds_[macro_entity_index] = macro_entity.seed();
+      auto& neighbors = macro_neighbors[macro_entity_index];
+      for (auto&& macro_intersection : intersections(macro_leaf_view_, macro_entity))
+        if (macro_intersection.neighbor() && !macro_intersection.boundary())
+          neighbors.push_back(macro_index_set.index(macro_intersection.outside()));
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+    coupling_offsets_.assign(macro_leaf_view_size_ + 1, 0);
+    for (size_t ii = 0; ii < macro_leaf_view_size_; ++ii)
+      coupling_offsets_[ii + 1] = coupling_offsets_[ii] + macro_neighbors[ii].size();
+    coupling_neighbors_.clear();
+    coupling_neighbors_.reserve(coupling_offsets_.back());
+    for (const auto& neighbors : macro_neighbors)
+      coupling_neighbors_.insert(coupling_neighbors_.end(), neighbors.begin(), neighbors.end());
+    coupling_glues_ = std::vector<CouplingGlues>(coupling_offsets_.back());
+  } // ... setup_couplings(...)
+
+  size_t coupling_index(const size_t macro_entity_index, const size_t macro_neighbor_index) const
+  {
+    const auto begin = coupling_neighbors_.begin() + coupling_offsets_[macro_entity_index];
+    const auto end = coupling_neighbors_.begin() + coupling_offsets_[macro_entity_index + 1];
+    const auto it = std::lower_bound(begin, end, macro_neighbor_index);
+    DUNE_THROW_IF(it == end || *it != macro_neighbor_index,
+                  XT::Common::Exceptions::you_are_using_this_wrong,
+                  "There is no coupling between macro entity " << macro_entity_index << " and macro entity "
+                                                               << macro_neighbor_index << ", they are not neighbors!");
+    return boost::numeric_cast<size_t>(it - coupling_neighbors_.begin());
+  } // ... coupling_index(...)
+
+  // Returns the slot of the glue between the given local levels of the given coupling. For Layers::level, the table of
+  // the coupling is enlarged if the local grids have been refined in the meantime, for Layers::leaf, the slot is
+  // cleared if the local leaf views have been adapted in the meantime.
+  GlueEntry& glue_entry(const size_t macro_entity_index,
+                        const size_t macro_neighbor_index,
+                        const int local_entity_level,
+                        const int local_neighbor_level)
+  {
+    auto& coupling_glues = coupling_glues_[coupling_index(macro_entity_index, macro_neighbor_index)];
+    auto& glues = coupling_glues.glues;
+    if (layer == Layers::leaf) {
+      const std::array<size_t, 2> local_leaf_sizes{
+          {local_grids_[macro_entity_index]->leaf_view().indexSet().size(0),
+           local_grids_[macro_neighbor_index]->leaf_view().indexSet().size(0)}};
+      if (glues.empty() || local_leaf_sizes != coupling_glues.local_leaf_sizes) {
+        glues.assign(1, GlueEntry());
+        coupling_glues.local_leaf_sizes = local_leaf_sizes;
+      }
+      return glues[0];
+    }
+    const auto entity_level = boost::numeric_cast<size_t>(local_entity_level);
+    const auto neighbor_level = boost::numeric_cast<size_t>(local_neighbor_level);
+    auto& num_levels = coupling_glues.num_local_levels;
+    if (entity_level >= num_levels[0] || neighbor_level >= num_levels[1]) {
+      const std::array<size_t, 2> new_num_levels{
+          {std::max(entity_level + 1, num_levels[0]), std::max(neighbor_level + 1, num_levels[1])}};
+      std::vector<GlueEntry> new_glues(new_num_levels[0] * new_num_levels[1]);
+      for (size_t ii = 0; ii < num_levels[0]; ++ii)
+        for (size_t jj = 0; jj < num_levels[1]; ++jj)
+          new_glues[ii * new_num_levels[1] + jj] = std::move(glues[ii * num_levels[1] + jj]);
+      glues = std::move(new_glues);
+      num_levels = new_num_levels;
     }
+    return glues[entity_level * num_levels[1] + neighbor_level];
+  } // ... glue_entry(...)
+
+  void check_orientation(GlueEntry& entry,
+                         const size_t macro_entity_index,
+                         const int local_entity_level,
+                         const size_t macro_neighbor_index,
+                         const int local_neighbor_level) const
+  {
+    assert(entry.glue);
+    if (!entry.num_broken_intersections)
+      entry.num_broken_intersections = check_for_broken_coupling_intersections(*entry.glue);
+    if (*entry.num_broken_intersections > 0)
+      DUNE_THROW(Exceptions::intersection_orientation_is_broken,
+                 "The coupling glue between the grid views of\n"
+                     << "     level " << local_entity_level << " on macro entity   " << macro_entity_index << " and\n"
+                     << "     level " << local_neighbor_level << " on macro neighbor " << macro_neighbor_index << "\n"
+                     << "   contains\n"
+                     << "     " << *entry.num_broken_intersections << "/" << entry.glue->size()
+                     << " intersections with wrong orientation!");
+  } // ... check_orientation(...)
+
+  void refine_local_grid(const size_t macro_entity_index, const size_t num_local_refinements)
+  {
+    assert(local_grids_[macro_entity_index]);
+    if (num_local_refinements > 0)
+      local_grids_[macro_entity_index]->grid().globalRefine(boost::numeric_cast<int>(num_local_refinements));
+  }
+
+  void setup_local_grids(const size_t num_local_refinements)
+  {
+    for_each_macro_entity(
+        [&](const MacroEntityType& macro_entity, const size_t macro_entity_index) {
+          if (macro_entity.type().isSimplex())
+            local_grids_[macro_entity_index] = create_grid_of_simplex(macro_entity);
+          else if (macro_entity.type().isCube())
+            local_grids_[macro_entity_index] = create_grid_of_cube(macro_entity);
+          else
+            DUNE_THROW(GridError, "Unknown entity.type() encountered: " << macro_entity.type());
+          refine_local_grid(macro_entity_index, num_local_refinements);
+        },
+        local_grids_may_be_created_concurrently());
+  } // ... setup_local_grids()
+
+  void setup_local_grids(const std::array<unsigned int, dimDomain>& num_elements_per_subdomain,
+                         const size_t num_local_refinements)
+  {
+    for_each_macro_entity(
+        [&](const MacroEntityType& macro_entity, const size_t macro_entity_index) {
+          DUNE_THROW_IF(!macro_entity.type().isCube(),
+                        GridError,
+                        "Prescribing number of elements for local subdomain grids only suitable for cubic subdomains!");
+          local_grids_[macro_entity_index] = create_grid_of_cube(macro_entity, num_elements_per_subdomain);
+          refine_local_grid(macro_entity_index, num_local_refinements);
+        },
+        local_grids_may_be_created_concurrently());
   } // ... setup_local_grids()
 
   template <Layers l, bool anything = true>
@@ -886,48 +995,49 @@ private:
   } // ... create_glue(...)
 
   // Creates the glue between the given local levels of a single macro entity/neighbor pair and stores it.
-  template <class EntityGluesType, class MacroNeighborIndexType, class MacroIntersectionType>
-  void setup_glue_for_local_levels(EntityGluesType& entity_glues,
-                                   const MacroEntityType& macro_entity,
+  template <class MacroIntersectionType>
+  void setup_glue_for_local_levels(const MacroEntityType& macro_entity,
+                                   const size_t macro_entity_index,
                                    const MacroEntityType& macro_neighbor,
-                                   const MacroNeighborIndexType macro_neighbor_index,
+                                   const size_t macro_neighbor_index,
                                    const MacroIntersectionType& macro_intersection,
                                    const int local_entity_level,
                                    const int local_neighbor_level,
                                    const bool allow_for_broken_orientation_of_coupling_intersections)
   {
-    auto glue = create_glue(macro_entity, macro_neighbor, macro_intersection, local_entity_level, local_neighbor_level);
-    if (!allow_for_broken_orientation_of_coupling_intersections) {
-      const size_t brocken_intersections = check_for_broken_coupling_intersections(*glue);
-      if (brocken_intersections > 0)
-        DUNE_THROW(Exceptions::intersection_orientation_is_broken,
-                   "The coupling glue between the grid views of\n"
-                       << "  level " << local_entity_level << " on macro entity   "
-                       << macro_leaf_view_.indexSet().index(macro_entity) << " and\n"
-                       << "  level " << local_neighbor_level << " on macro neighbor "
-                       << macro_leaf_view_.indexSet().index(macro_neighbor) << "\n"
-                       << "contains\n"
-                       << "  " << brocken_intersections << "/" << glue->size() << " intersections with wrong"
-                       << "orientation!");
-    }
-    entity_glues[macro_neighbor_index][local_entity_level][local_neighbor_level] = glue;
+    auto& entry = glue_entry(macro_entity_index, macro_neighbor_index, local_entity_level, local_neighbor_level);
+    entry.glue =
+        create_glue(macro_entity, macro_neighbor, macro_intersection, local_entity_level, local_neighbor_level);
+    entry.num_broken_intersections.reset();
+    if (!allow_for_broken_orientation_of_coupling_intersections)
+      check_orientation(entry, macro_entity_index, local_entity_level, macro_neighbor_index, local_neighbor_level);
   } // ... setup_glue_for_local_levels(...)
 
   // Creates the glues between all local levels of a single macro entity/neighbor pair and stores them.
-  template <class EntityGluesType, class MacroNeighborIndexType, class MacroIntersectionType>
-  void setup_glues_for_macro_pair(EntityGluesType& entity_glues,
-                                  const MacroEntityType& macro_entity,
+  template <class MacroIntersectionType>
+  void setup_glues_for_macro_pair(const MacroEntityType& macro_entity,
                                   const size_t macro_entity_index,
                                   const MacroEntityType& macro_neighbor,
-                                  const MacroNeighborIndexType macro_neighbor_index,
+                                  const size_t macro_neighbor_index,
                                   const MacroIntersectionType& macro_intersection,
                                   const bool allow_for_broken_orientation_of_coupling_intersections)
   {
+    if (layer == Layers::leaf) {
+      setup_glue_for_local_levels(macro_entity,
+                                  macro_entity_index,
+                                  macro_neighbor,
+                                  macro_neighbor_index,
+                                  macro_intersection,
+                                  -1,
+                                  -1,
+                                  allow_for_broken_orientation_of_coupling_intersections);
+      return;
+    }
     for (auto local_entity_level : XT::Common::value_range(local_grids_[macro_entity_index]->grid().maxLevel() + 1))
       for (auto local_neighbor_level :
            XT::Common::value_range(local_grids_[macro_neighbor_index]->grid().maxLevel() + 1))
-        setup_glue_for_local_levels(entity_glues,
-                                    macro_entity,
+        setup_glue_for_local_levels(macro_entity,
+                                    macro_entity_index,
                                     macro_neighbor,
                                     macro_neighbor_index,
                                     macro_intersection,
@@ -938,36 +1048,36 @@ private:
 
   void setup_glues(const bool allow_for_broken_orientation_of_coupling_intersections = false)
   {
+    // size the glue tables of all couplings first, then each macro entity only touches the slots of its own couplings
+    // and the glues can be created concurrently (if the local grids allow for it)
+    for (size_t ii = 0; ii < macro_leaf_view_size_; ++ii)
+      for (size_t cc = coupling_offsets_[ii]; cc < coupling_offsets_[ii + 1]; ++cc)
+        glue_entry(ii, coupling_neighbors_[cc], max_local_level(ii), max_local_level(coupling_neighbors_[cc]));
     const auto& macro_index_set = macro_leaf_view_.indexSet();
-    for (auto&& macro_entity : elements(macro_leaf_view_)) {
-      const auto macro_entity_index = macro_index_set.index(macro_entity);
-      auto& entity_glues = glues_[macro_entity_index];
-      // walk the neighbors ...
-      for (auto&& macro_intersection : intersections(macro_leaf_view_, macro_entity)) {
-        if (!macro_intersection.neighbor() || macro_intersection.boundary())
-          continue;
-        const auto macro_neighbor_ptr = macro_intersection.outside();
-#  if DUNE_VERSION_GTE(DUNE_GRID, 2, 4)
-        const auto& macro_neighbor = macro_neighbor_ptr;
-#  else
-        const auto& macro_neighbor = *macro_neighbor_ptr;
-#  endif
-        const auto macro_neighbor_index = macro_index_set.index(macro_neighbor);
-        setup_glues_for_macro_pair(entity_glues,
-                                   macro_entity,
-                                   macro_entity_index,
-                                   macro_neighbor,
-                                   macro_neighbor_index,
-                                   macro_intersection,
-                                   allow_for_broken_orientation_of_coupling_intersections);
-      } // ... walk the neighbors
-    }
+    for_each_macro_entity(
+        [&](const MacroEntityType& macro_entity, const size_t macro_entity_index) {
+          // walk the neighbors ...
+          for (auto&& macro_intersection : intersections(macro_leaf_view_, macro_entity)) {
+            if (!macro_intersection.neighbor() || macro_intersection.boundary())
+              continue;
+            const auto macro_neighbor = macro_intersection.outside();
+            setup_glues_for_macro_pair(macro_entity,
+                                       macro_entity_index,
+                                       macro_neighbor,
+                                       macro_index_set.index(macro_neighbor),
+                                       macro_intersection,
+                                       allow_for_broken_orientation_of_coupling_intersections);
+          } // ... walk the neighbors
+        },
+        local_grids_may_be_created_concurrently());
   } // ... setup_glues(...)
 
   void prepare_global_grid()
   {
     if (global_grid_)
       return;
+    auto logger = XT::Common::TimedLogger().get("grid-multiscale.glued.prepare_global_grid");
+    logger.warn() << "Requiring inefficient access to global micro grid!" << std::endl;
     const auto& macro_index_set = macro_leaf_view_.indexSet();
     std::vector<FieldVector<ctype, dimDomain>> vertices;
     std::vector<std::vector<std::vector<unsigned int>>> entity_to_vertex_ids(local_grids_.size());
@@ -1024,40 +1134,41 @@ private:
     } // try
     global_grid_ = std::make_unique<XT::Grid::GridProvider<LocalGridType>>(global_factory.createGrid());
 
-    // build maps of indices, relating the local to the global grid
+    // build maps of indices (and the seeds of all elements, for direct access), relating the local to the global grid,
+    // therefore
+    // * index the bounding boxes of the global elements, so that each local element is found by one point query
     const auto global_view = global_grid_->leaf_view();
-    local_to_global_indices_ = std::make_unique<std::vector<std::vector<size_t>>>(macro_leaf_view_.indexSet().size(0));
+    const auto& global_index_set = global_view.indexSet();
+    const auto global_elements = XT::Grid::make_entity_bounding_box_index(global_view);
+    local_to_global_indices_ = std::make_unique<std::vector<std::vector<size_t>>>(local_grids_.size());
     auto& local_to_global_inds = *local_to_global_indices_;
-    global_to_local_indices_ = std::make_unique<std::vector<std::pair<size_t, size_t>>>(global_view.indexSet().size(0));
+    global_to_local_indices_ = std::make_unique<std::vector<std::pair<size_t, size_t>>>(global_index_set.size(0));
     auto& global_to_local_inds = *global_to_local_indices_;
-    // therefore
-    // * create a search on the global view: if all is fine, we only need to walk that one once
-    std::vector<FieldVector<ctype, dimDomain>> local_entity_center{FieldVector<ctype, dimDomain>(0.0)};
-    auto global_search = XT::Grid::make_entity_in_level_search(global_view);
-    // * walk the macro grid
-    for (auto&& macro_entity : elements(macro_leaf_view_)) {
-      const size_t subd = macro_leaf_view_.indexSet().index(macro_entity);
-      const auto local_leaf_view = local_grid(macro_entity).leaf_view();
+    local_entity_seeds_ = std::vector<std::vector<MicroSeedType>>(local_grids_.size());
+    global_entity_seeds_ = std::vector<MicroSeedType>(global_index_set.size(0));
+    // * walk the local grids, each local element corresponds to another global element
+    MicroSeedType global_seed;
+    for (size_t subd = 0; subd < local_grids_.size(); ++subd) {
+      const auto local_leaf_view = local_grids_[subd]->leaf_view();
       const auto& local_index_set = local_leaf_view.indexSet();
       local_to_global_inds[subd] = std::vector<size_t>(local_index_set.size(0));
-      // * walk the local grid
+      local_entity_seeds_[subd] = std::vector<MicroSeedType>(local_index_set.size(0));
       for (auto&& local_entity : elements(local_leaf_view)) {
         const size_t local_entity_index = local_index_set.index(local_entity);
-        local_entity_center[0] = local_entity.geometry().center();
-        const auto global_entity_ptr_unique_ptrs = global_search(local_entity_center);
         // the search has to be successfull, since the global grid has been constructed to exactly contain each local
         // entity
-        assert(global_entity_ptr_unique_ptrs.size() == 1);
-        const auto& global_entity_ptr_unique_ptr = global_entity_ptr_unique_ptrs.at(0);
-        assert(global_entity_ptr_unique_ptr);
-        const auto& global_entity_ptr = *global_entity_ptr_unique_ptr;
-        const auto& global_entity = *global_entity_ptr;
-        const size_t global_entity_index = global_view.indexSet().index(global_entity);
+        DUNE_THROW_IF(!global_elements.find(local_entity.geometry().center(), global_seed),
+                      InvalidStateException,
+                      "No element of the global grid contains local element " << local_entity_index
+                                                                              << " of subdomain " << subd << "!");
+        const size_t global_entity_index = global_index_set.index(global_grid_->grid().entity(global_seed));
         // store information
         local_to_global_inds[subd][local_entity_index] = global_entity_index;
         global_to_local_inds[global_entity_index] = {subd, local_entity_index};
-      } // * walk the local grid
-    } // * walk the macro grid
+        local_entity_seeds_[subd][local_entity_index] = local_entity.seed();
+        global_entity_seeds_[global_entity_index] = global_seed;
+      }
+    }
   } // ... prepare_global_grid(...)
 
   size_t find_insert_vertex(std::vector<FieldVector<ctype, dimDomain>>& vertices,
@@ -1087,12 +1198,17 @@ private:
   MacroGridViewType macro_leaf_view_;
   const size_t macro_leaf_view_size_;
   std::vector<std::shared_ptr<LocalGridProviderType>> local_grids_;
-  std::vector<std::map<size_t, std::map<int, std::map<int, std::shared_ptr<GlueType>>>>> glues_;
+  std::vector<MacroSeedType> macro_entity_seeds_;
+  std::vector<size_t> coupling_offsets_;
+  std::vector<size_t> coupling_neighbors_;
+  std::vector<CouplingGlues> coupling_glues_;
   std::map<size_t, std::map<int, std::vector<std::pair<MicroEntityType, std::vector<int>>>>>
       macro_entity_to_local_level_to_boundary_entity_ptrs_with_local_intersections_;
   std::unique_ptr<LocalGridProviderType> global_grid_;
   std::unique_ptr<std::vector<std::vector<size_t>>> local_to_global_indices_;
   std::unique_ptr<std::vector<std::pair<size_t, size_t>>> global_to_local_indices_;
+  std::vector<std::vector<MicroSeedType>> local_entity_seeds_;
+  std::vector<MicroSeedType> global_entity_seeds_;
 }; // class Glued
 
 
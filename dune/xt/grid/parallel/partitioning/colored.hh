@@ -0,0 +1,135 @@
+// This file is part of the dune-xt project:
+//   https://zivgitlab.uni-muenster.de/ag-ohlberger/dune-community/dune-xt
+// Copyright 2009-2021 dune-xt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+/// \file
+/// \brief Provides ColoredPartitioning, a greedy coloring of the elements of a grid view such that elements of the same
+/// color do not share any vertex (optionally including their face neighbors).
+
+#ifndef DUNE_XT_GRID_PARALLEL_PARTITIONING_COLORED_HH
+#define DUNE_XT_GRID_PARALLEL_PARTITIONING_COLORED_HH
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <dune/xt/grid/type_traits.hh>
+
+namespace Dune::XT::Grid {
+
+
+/**
+ * \brief Colors the elements of a grid view, such that no two elements of the same color touch the same vertex.
+ *
+ * Every DoF shared between two elements is attached to a common subentity and thus to a common vertex. Element functors
+ * which only write DoFs of the element they are applied to may thus be applied to all elements of one color
+ * concurrently without any write conflicts (see Walker::walk_colored()).
+ *
+ * If include_face_neighbors is true (the default), the vertices of all face neighbors of an element are taken into
+ * account as well. This is required for intersection functors, which also write DoFs of the outside element of an
+ * intersection (e.g., coupling bilinear form assemblers).
+ *
+ * The coloring is computed greedily in the order of the grid view's element iteration, and the elements of each color
+ * are stored as entity seeds.
+ */
+template <class GV>
+class ColoredPartitioning
+{
+  static_assert(is_view<GV>::value);
+
+public:
+  using GridViewType = GV;
+  using ElementType = extract_entity_t<GV>;
+  using SeedType = typename ElementType::EntitySeed;
+  static constexpr int d = GV::dimension;
+
+  explicit ColoredPartitioning(const GridViewType& grid_view, const bool include_face_neighbors = true)
+    : grid_view_(grid_view)
+  {
+    const auto& index_set = grid_view_.indexSet();
+    // collect the vertices each element writes to
+    std::vector<std::vector<size_t>> element_vertices(index_set.size(0));
+    for (auto&& element : elements(grid_view_)) {
+      auto& vertices = element_vertices[index_set.index(element)];
+      add_vertices(element, vertices);
+      if (include_face_neighbors)
+        for (auto&& intersection : intersections(grid_view_, element))
+          if (intersection.neighbor())
+            add_vertices(intersection.outside(), vertices);
+      std::sort(vertices.begin(), vertices.end());
+      vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    }
+    // invert to find all elements writing to a vertex
+    std::vector<std::vector<size_t>> vertex_elements(index_set.size(d));
+    for (size_t ee = 0; ee < element_vertices.size(); ++ee)
+      for (const auto& vv : element_vertices[ee])
+        vertex_elements[vv].push_back(ee);
+    // greedy coloring: use the smallest color not used by any conflicting element
+    std::vector<size_t> element_colors(index_set.size(0), no_color());
+    std::vector<size_t> color_used_by(1, no_color());
+    for (auto&& element : elements(grid_view_)) {
+      const size_t ee = index_set.index(element);
+      for (const auto& vv : element_vertices[ee])
+        for (const auto& other : vertex_elements[vv])
+          if (element_colors[other] != no_color())
+            color_used_by[element_colors[other]] = ee;
+      size_t color = 0;
+      while (color < color_used_by.size() && color_used_by[color] == ee)
+        ++color;
+      if (color == color_used_by.size())
+        color_used_by.push_back(no_color());
+      element_colors[ee] = color;
+      if (color >= seeds_.size())
+        seeds_.resize(color + 1);
+      seeds_[color].push_back(element.seed());
+    }
+  } // ColoredPartitioning(...)
+
+  const GridViewType& grid_view() const
+  {
+    return grid_view_;
+  }
+
+  /// \brief The number of colors.
+  size_t colors() const
+  {
+    return seeds_.size();
+  }
+
+  /// \brief The seeds of all elements of the given color.
+  const std::vector<SeedType>& color(const size_t cc) const
+  {
+    return seeds_.at(cc);
+  }
+
+  ElementType element(const SeedType& seed) const
+  {
+    return grid_view_.grid().entity(seed);
+  }
+
+private:
+  static constexpr size_t no_color()
+  {
+    return std::numeric_limits<size_t>::max();
+  }
+
+  void add_vertices(const ElementType& element, std::vector<size_t>& vertices) const
+  {
+    const auto& index_set = grid_view_.indexSet();
+    for (unsigned int ii = 0; ii < element.subEntities(d); ++ii)
+      vertices.push_back(index_set.subIndex(element, ii, d));
+  }
+
+  const GridViewType grid_view_;
+  std::vector<std::vector<SeedType>> seeds_;
+}; // class ColoredPartitioning
+
+
+} // namespace Dune::XT::Grid
+
+#endif // DUNE_XT_GRID_PARALLEL_PARTITIONING_COLORED_HH
@@ -15,10 +15,17 @@
 #ifndef DUNE_XT_GRID_SEARCH_HH
 #define DUNE_XT_GRID_SEARCH_HH
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <vector>
 
 #include <boost/range/iterator_range.hpp>
 
+#include <dune/common/fvector.hh>
+
 #include <dune/geometry/referenceelements.hh>
 
 #include <dune/grid/common/rangegenerators.hh>
@@ -253,6 +260,206 @@ private:
 }; // class FallbackEntityInlevelSearch
 
 
+/**
+ * \brief Immutable spatial index of the elements of a grid layer, to find the elements containing given points.
+ *
+ * The bounding boxes of all elements are sorted into a uniform grid of buckets covering the grid layer (with about one
+ * element per bucket), and a query only checks the elements whose bounding box contains the point and lies in the same
+ * bucket. Thus, searching N points costs O(N) for shape regular grids, instead of O(N * |grid layer|) in the worst case
+ * of EntityInlevelSearch. The index is built once in the constructor and stores the elements as entity seeds, all
+ * queries are const, so a single index may be shared between threads.
+ *
+ * \note The bounding boxes are computed from the corners of the elements, which is exact for affine and multilinear
+ *       geometries.
+ * \note The index is invalidated by any modification of the grid.
+ **/
+template <class GridLayerType>
+class EntityBoundingBoxIndex : public EntitySearchBase<GridLayerType>
+{
+  using BaseType = EntitySearchBase<GridLayerType>;
+
+public:
+  using typename BaseType::EntityType;
+  using typename BaseType::EntityVectorType;
+  using typename BaseType::GlobalCoordinateType;
+  using SeedType = typename EntityType::EntitySeed;
+
+private:
+  using D = typename GlobalCoordinateType::value_type;
+  static constexpr size_t dimworld = GlobalCoordinateType::dimension;
+  using BoxCornerType = FieldVector<D, dimworld>;
+
+public:
+  explicit EntityBoundingBoxIndex(const GridLayerType& grid_layer)
+    : grid_layer_(grid_layer)
+    , lower_(std::numeric_limits<D>::max())
+    , upper_(std::numeric_limits<D>::lowest())
+    , num_buckets_total_(0)
+  {
+    // collect the elements and their bounding boxes
+    for (auto&& element : elements(grid_layer_)) {
+      const auto& geometry = element.geometry();
+      BoxCornerType lower(std::numeric_limits<D>::max());
+      BoxCornerType upper(std::numeric_limits<D>::lowest());
+      for (int ii = 0; ii < geometry.corners(); ++ii) {
+        const auto corner = geometry.corner(ii);
+        for (size_t dd = 0; dd < dimworld; ++dd) {
+          lower[dd] = std::min(lower[dd], D(corner[dd]));
+          upper[dd] = std::max(upper[dd], D(corner[dd]));
+        }
+      }
+      for (size_t dd = 0; dd < dimworld; ++dd) {
+        lower_[dd] = std::min(lower_[dd], lower[dd]);
+        upper_[dd] = std::max(upper_[dd], upper[dd]);
+      }
+      seeds_.emplace_back(element.seed());
+      element_lowers_.emplace_back(lower);
+      element_uppers_.emplace_back(upper);
+    }
+    if (seeds_.empty())
+      return;
+    // enlarge all boxes slightly, so that points on the boundary of an element are found despite rounding
+    const D tolerance = 1e-10 * std::max(D(1), (upper_ - lower_).infinity_norm());
+    for (size_t dd = 0; dd < dimworld; ++dd) {
+      lower_[dd] -= tolerance;
+      upper_[dd] += tolerance;
+    }
+    for (size_t ii = 0; ii < seeds_.size(); ++ii)
+      for (size_t dd = 0; dd < dimworld; ++dd) {
+        element_lowers_[ii][dd] -= tolerance;
+        element_uppers_[ii][dd] += tolerance;
+      }
+    // choose the buckets such that they have about the volume of an element (ignoring flat directions)
+    D volume = 1;
+    size_t extended_directions = 0;
+    for (size_t dd = 0; dd < dimworld; ++dd)
+      if (upper_[dd] - lower_[dd] > 2 * tolerance) {
+        volume *= upper_[dd] - lower_[dd];
+        ++extended_directions;
+      }
+    const D bucket_width =
+        (extended_directions > 0) ? std::pow(volume / seeds_.size(), D(1) / extended_directions) : D(1);
+    num_buckets_total_ = 1;
+    for (size_t dd = 0; dd < dimworld; ++dd) {
+      num_buckets_[dd] = std::max(size_t(1), size_t(std::ceil((upper_[dd] - lower_[dd]) / bucket_width)));
+      // guard against huge bucket grids for very anisotropic grid layers
+      num_buckets_[dd] = std::min(num_buckets_[dd], seeds_.size());
+      bucket_widths_[dd] = (upper_[dd] - lower_[dd]) / num_buckets_[dd];
+      num_buckets_total_ *= num_buckets_[dd];
+    }
+    // sort the elements into all buckets their bounding box overlaps (compressed row storage)
+    bucket_offsets_.assign(num_buckets_total_ + 1, 0);
+    for (size_t ii = 0; ii < seeds_.size(); ++ii)
+      for_each_bucket(element_lowers_[ii], element_uppers_[ii], [&](const size_t bucket) {
+        ++bucket_offsets_[bucket + 1];
+      });
+    for (size_t bb = 0; bb < num_buckets_total_; ++bb)
+      bucket_offsets_[bb + 1] += bucket_offsets_[bb];
+    bucket_elements_.resize(bucket_offsets_.back());
+    auto next_free = bucket_offsets_;
+    for (size_t ii = 0; ii < seeds_.size(); ++ii)
+      for_each_bucket(element_lowers_[ii], element_uppers_[ii], [&](const size_t bucket) {
+        bucket_elements_[next_free[bucket]++] = ii;
+      });
+  } // EntityBoundingBoxIndex(...)
+
+  EntityBoundingBoxIndex(const EntityBoundingBoxIndex&) = default;
+  EntityBoundingBoxIndex(EntityBoundingBoxIndex&&) = default;
+
+  /// \brief The number of indexed elements.
+  size_t size() const
+  {
+    return seeds_.size();
+  }
+
+  /// \brief Returns the seed of the element containing point, if any.
+  bool find(const GlobalCoordinateType& point, SeedType& seed) const
+  {
+    if (seeds_.empty())
+      return false;
+    size_t bucket = 0;
+    for (size_t dd = 0; dd < dimworld; ++dd) {
+      if (point[dd] < lower_[dd] || point[dd] > upper_[dd])
+        return false;
+      bucket = bucket * num_buckets_[dd] + bucket_coordinate(dd, point[dd]);
+    }
+    for (size_t jj = bucket_offsets_[bucket]; jj < bucket_offsets_[bucket + 1]; ++jj) {
+      const auto ii = bucket_elements_[jj];
+      bool inside_box = true;
+      for (size_t dd = 0; dd < dimworld && inside_box; ++dd)
+        inside_box = (point[dd] >= element_lowers_[ii][dd] && point[dd] <= element_uppers_[ii][dd]);
+      if (inside_box && CheckInside<0>::check(grid_layer_.grid().entity(seeds_[ii]).geometry(), point)) {
+        seed = seeds_[ii];
+        return true;
+      }
+    }
+    return false;
+  } // ... find(...)
+
+  /**
+   * \brief Batched query, like EntityInlevelSearch::operator().
+   * \return a vector of size points.size(), with a nullptr for each point which is not contained in any element
+   **/
+  template <class PointContainerType>
+  EntityVectorType operator()(const PointContainerType& points) const
+  {
+    EntityVectorType ret(points.size());
+    SeedType seed;
+    size_t idx = 0;
+    for (const auto& point : points) {
+      if (find(point, seed))
+        ret[idx] = std::make_unique<EntityType>(grid_layer_.grid().entity(seed));
+      ++idx;
+    }
+    return ret;
+  } // ... operator()(...)
+
+private:
+  size_t bucket_coordinate(const size_t dd, const D& xx) const
+  {
+    // the upper boundary belongs to the last bucket
+    return std::min(num_buckets_[dd] - 1, size_t(std::max(D(0), (xx - lower_[dd]) / bucket_widths_[dd])));
+  }
+
+  template <class BucketFunctor>
+  void for_each_bucket(const BoxCornerType& lower, const BoxCornerType& upper, BucketFunctor&& functor) const
+  {
+    std::array<size_t, dimworld> begin, end, current;
+    for (size_t dd = 0; dd < dimworld; ++dd) {
+      begin[dd] = bucket_coordinate(dd, lower[dd]);
+      end[dd] = bucket_coordinate(dd, upper[dd]) + 1;
+      current[dd] = begin[dd];
+    }
+    while (true) {
+      size_t bucket = 0;
+      for (size_t dd = 0; dd < dimworld; ++dd)
+        bucket = bucket * num_buckets_[dd] + current[dd];
+      functor(bucket);
+      // advance the multi-index, the last direction being the fastest
+      size_t dd = dimworld;
+      while (dd > 0 && ++current[dd - 1] == end[dd - 1]) {
+        current[dd - 1] = begin[dd - 1];
+        --dd;
+      }
+      if (dd == 0)
+        return;
+    }
+  } // ... for_each_bucket(...)
+
+  const GridLayerType grid_layer_;
+  BoxCornerType lower_;
+  BoxCornerType upper_;
+  std::array<size_t, dimworld> num_buckets_;
+  BoxCornerType bucket_widths_;
+  size_t num_buckets_total_;
+  std::vector<SeedType> seeds_;
+  std::vector<BoxCornerType> element_lowers_;
+  std::vector<BoxCornerType> element_uppers_;
+  std::vector<size_t> bucket_offsets_;
+  std::vector<size_t> bucket_elements_;
+}; // class EntityBoundingBoxIndex
+
+
 /// \brief Searches for entities containing given points by descending the grid hierarchy from a start level.
 template <class GridLayerType>
 class EntityHierarchicSearch : public EntitySearchBase<GridLayerType>
@@ -317,6 +524,14 @@ EntityInlevelSearch<GV, codim> make_entity_in_level_search(const GV& grid_view)
 }
 
 
+/// \brief Creates an EntityBoundingBoxIndex for the given grid view.
+template <class GV>
+EntityBoundingBoxIndex<GV> make_entity_bounding_box_index(const GV& grid_view)
+{
+  return EntityBoundingBoxIndex<GV>(grid_view);
+}
+
+
 /// \brief Creates an EntityHierarchicSearch for the given grid view.
 template <class GV>
 EntityHierarchicSearch<GV> make_entity_hierarchic_search(const GV& grid_view)
@@ -15,10 +15,13 @@
 #ifndef DUNE_XT_GRID_VIEW_PERIODIC_HH
 #define DUNE_XT_GRID_VIEW_PERIODIC_HH
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <iterator>
+#include <memory>
+#include <optional>
 #include <tuple>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -39,13 +42,58 @@ namespace Dune::XT::Grid {
 namespace internal {
 
 
+/// \brief The periodic neighbor across one face of an element, \sa PeriodicNeighborTable
+template <class BaseIntersectionImp>
+struct PeriodicNeighbor
+{
+  using ElementType = typename BaseIntersectionImp::Entity;
+  using LocalGeometry = typename BaseIntersectionImp::LocalGeometry;
+
+  size_t inside_index;
+  int index_in_inside;
+  size_t outside_index;
+  int index_in_outside;
+  ElementType outside;
+  LocalGeometry geometry_in_outside;
+}; // struct PeriodicNeighbor
+
+
+/**
+ * \brief Flat table of all periodic neighbors of a PeriodicGridViewWrapper, built once in its update().
+ *
+ * The neighbors are ordered by the geometry type and the index of the inside element and by the local face number.
+ * The neighbors of the element with index ii (of the geometry type with global type index tt) are thus given by
+ * neighbors[offsets[tt][ii]], ..., neighbors[offsets[tt][ii + 1] - 1], which are at most a few (one per periodic
+ * face), so that finding the neighbor of an intersection requires neither hashing nor searching the grid, but only a
+ * linear scan of these few neighbors.
+ */
+template <class BaseGridViewType>
+struct PeriodicNeighborTable
+{
+  using NeighborType = PeriodicNeighbor<extract_intersection_t<BaseGridViewType>>;
+  static constexpr size_t num_geometries = GlobalGeometryTypeIndex::size(BaseGridViewType::dimension);
+
+  std::pair<const NeighborType*, const NeighborType*> neighbors_of(const size_t type_index, const size_t index) const
+  {
+    const auto& type_offsets = offsets[type_index];
+    if (type_offsets.empty())
+      return {nullptr, nullptr};
+    return {neighbors.data() + type_offsets[index], neighbors.data() + type_offsets[index + 1]};
+  }
+
+  std::vector<NeighborType> neighbors;
+  std::array<std::vector<size_t>, num_geometries> offsets;
+}; // struct PeriodicNeighborTable
+
+
 template <class BaseGridViewType, bool codim_iters_provided, int codim>
 class IndexMapCreator
 {
 public:
   using ElementType = XT::Grid::extract_entity_t<BaseGridViewType, 0>;
   using EntityType = XT::Grid::extract_entity_t<BaseGridViewType, codim>;
-  using ElementPtrVectorType = std::vector<std::shared_ptr<const ElementType>>;
+  using PeriodicNeighborTableType = PeriodicNeighborTable<BaseGridViewType>;
+  using PeriodicNeighborType = typename PeriodicNeighborTableType::NeighborType;
   using IndexType = typename extract_index_set_t<BaseGridViewType>::IndexType;
   static constexpr size_t dimDomain = BaseGridViewType::dimension;
   static constexpr size_t num_geometries = GlobalGeometryTypeIndex::size(dimDomain);
@@ -59,8 +107,7 @@ public:
                   std::array<size_t, num_geometries>& type_counts,
                   std::array<std::unordered_set<IndexType>, num_geometries>& entities_to_skip,
                   std::array<std::vector<IndexType>, num_geometries>& new_indices,
-                  std::array<std::unordered_map<IndexType, ElementPtrVectorType>, num_geometries>&
-                      boundary_entity_to_periodic_neighbors_maps)
+                  PeriodicNeighborTableType& periodic_neighbors)
     : lower_left_(lower_left)
     , upper_right_(upper_right)
     , periodic_directions_(periodic_directions)
@@ -71,13 +118,15 @@ public:
     , entities_to_skip_(entities_to_skip)
     , new_indices_(new_indices)
     , current_new_index_({})
-    , boundary_entity_to_periodic_neighbors_maps_(boundary_entity_to_periodic_neighbors_maps)
+    , periodic_neighbors_(periodic_neighbors)
   {
     for (const auto& geometry_type : base_index_set_.types(codim)) {
       const auto type_index = GlobalGeometryTypeIndex::index(geometry_type);
       const auto num_type_entities = base_index_set_.size(geometry_type);
-      if constexpr (codim == 0)
+      if constexpr (codim == 0) {
         type_counts_[GlobalGeometryTypeIndex::index(geometry_type)] = num_type_entities;
+        periodic_neighbors_.offsets[type_index].assign(num_type_entities + 1, 0);
+      }
       new_indices_[type_index].resize(num_type_entities);
     }
   }
@@ -148,11 +197,10 @@ private:
               assert(num_boundary_coords == 1);
               periodic_coords_.push_back(periodic_neighbor_coords);
               periodic_coords_index_.push_back(std::make_tuple(type_index, index_in_base, index_in_inside));
+              intersection_centers_.push_back(intersection.geometry().center());
             }
           }
         }
-        boundary_entity_to_periodic_neighbors_maps_[type_index][index_in_base] =
-            ElementPtrVectorType(entity.subEntities(1), nullptr);
       } // if (entity.hasBoundaryIntersections)
     } else {
       // check if entity is on right-hand periodic boundary, in that case it will be identified with its periodically
@@ -195,6 +243,7 @@ private:
                               FallbackEntityInlevelSearch<BaseGridViewType, codim>>::type
         entity_search_codim(base_grid_view_);
     auto periodic_entity_ptrs = entity_search_codim(periodic_coords_);
+    std::vector<PeriodicNeighborType> unordered_neighbors;
     for (size_t vector_index = 0; vector_index < periodic_entity_ptrs.size(); ++vector_index) {
       const auto& index = periodic_coords_index_[vector_index];
       auto& periodic_entity_ptr = periodic_entity_ptrs[vector_index];
@@ -203,10 +252,32 @@ private:
       const auto& type_index = std::get<0>(index);
       const auto& entity_index = std::get<1>(index);
       if constexpr (codim == 0) {
-        // store periodic neighbor for intersection
+        // find the intersection of the periodic neighbor on the opposite boundary, i.e. the one that differs only in
+        // one coordinate
         const auto& local_intersection_index = std::get<2>(index);
-        boundary_entity_to_periodic_neighbors_maps_[type_index][entity_index][local_intersection_index] =
-            std::move(periodic_entity_ptr);
+        bool found_intersection_in_outside = false;
+        for (const auto& outside_intersection : Dune::intersections(base_grid_view_, *periodic_entity_ptr)) {
+          if (!outside_intersection.boundary())
+            continue;
+          const auto coord_diff = outside_intersection.geometry().center() - intersection_centers_[vector_index];
+          size_t coord_diff_count = 0;
+          for (const auto& entry : coord_diff)
+            if (Common::FloatCmp::ne(entry, 0.))
+              ++coord_diff_count;
+          if (coord_diff_count == 1) {
+            unordered_neighbors.push_back({static_cast<size_t>(entity_index),
+                                           local_intersection_index,
+                                           static_cast<size_t>(base_index_set_.index(*periodic_entity_ptr)),
+                                           outside_intersection.indexInInside(),
+                                           *periodic_entity_ptr,
+                                           outside_intersection.geometryInInside()});
+            found_intersection_in_outside = true;
+            break;
+          }
+        }
+        DUNE_THROW_IF(!found_intersection_in_outside,
+                      Dune::InvalidStateException,
+                      "Could not find outside intersection!");
       } else {
         // assign index of periodic equivalent entity to entities that are replaced
         const auto periodic_entity_index = base_index_set_.index(*periodic_entity_ptr);
@@ -214,8 +285,41 @@ private:
         new_indices_[type_index][entity_index] = new_indices_[periodic_entity_type_index][periodic_entity_index];
       }
     }
+    if constexpr (codim == 0)
+      fill_periodic_neighbor_table(unordered_neighbors);
   } // after_loop()
 
+  // orders the neighbors by geometry type, inside index and face and computes the offsets
+  void fill_periodic_neighbor_table(const std::vector<PeriodicNeighborType>& unordered_neighbors)
+  {
+    const auto key = [&](const size_t ii) {
+      return std::make_tuple(std::get<0>(periodic_coords_index_[ii]),
+                             unordered_neighbors[ii].inside_index,
+                             unordered_neighbors[ii].index_in_inside);
+    };
+    std::vector<size_t> order(unordered_neighbors.size());
+    for (size_t ii = 0; ii < order.size(); ++ii)
+      order[ii] = ii;
+    std::sort(order.begin(), order.end(), [&](const auto& left, const auto& right) { return key(left) < key(right); });
+    auto& neighbors = periodic_neighbors_.neighbors;
+    neighbors.clear();
+    neighbors.reserve(order.size());
+    for (const auto& ii : order)
+      neighbors.push_back(unordered_neighbors[ii]);
+    size_t position = 0;
+    for (size_t type_index = 0; type_index < num_geometries; ++type_index) {
+      auto& type_offsets = periodic_neighbors_.offsets[type_index];
+      for (size_t index = 0; index < type_offsets.size(); ++index) {
+        while (position < order.size()
+               && std::make_tuple(std::get<0>(periodic_coords_index_[order[position]]),
+                                  neighbors[position].inside_index)
+                      < std::make_tuple(type_index, index))
+          ++position;
+        type_offsets[index] = position;
+      }
+    }
+  } // ... fill_periodic_neighbor_table(...)
+
   const DomainType& lower_left_;
   const DomainType& upper_right_;
   const std::bitset<dimDomain>& periodic_directions_;
@@ -227,9 +331,9 @@ private:
   std::array<std::vector<IndexType>, num_geometries>& new_indices_;
   std::vector<DomainType> periodic_coords_;
   std::vector<std::tuple<size_t, IndexType, int>> periodic_coords_index_;
+  std::vector<DomainType> intersection_centers_;
   std::array<IndexType, num_geometries> current_new_index_;
-  std::array<std::unordered_map<IndexType, ElementPtrVectorType>, num_geometries>&
-      boundary_entity_to_periodic_neighbors_maps_;
+  PeriodicNeighborTableType& periodic_neighbors_;
   std::array<std::unordered_set<IndexType>, GlobalGeometryTypeIndex::size(dimDomain)> visited_entities_;
 }; // struct IndexMapCreator< ... >
 
@@ -353,10 +457,10 @@ private:
 /** \brief Intersection implementation for PeriodicGridViewWrapper
  *
  * PeriodicIntersectionImp is derived from the Intersection of the underlying grid view. On the inside of the grid or
- * if periodic_ is false, the PeriodicIntersection will behave exactly like its BaseType. If periodic_ is true, the
+ * if periodic_neighbor_ is nullptr, the PeriodicIntersection will behave exactly like its BaseType. Otherwise, the
  * PeriodicIntersection will return neighbor == true even if it actually is on the boundary. In this case, outside(),
  * geometryInOutside() and indexInOutside() are well-defined and give the information from the periodically adjacent
- * entity.
+ * entity, which is precomputed in the PeriodicNeighborTable of the grid view.
  *
  * \see PeriodicGridView
  */
@@ -368,22 +472,19 @@ class PeriodicIntersectionImp : public BaseIntersectionImp
 public:
   using typename BaseType::LocalGeometry;
   using ElementType = typename BaseType::Entity;
+  using PeriodicNeighborType = PeriodicNeighbor<BaseIntersectionImp>;
 
   //! \brief Constructor from base intersection
-  template <class BaseGridViewType>
-  PeriodicIntersectionImp(BaseType base_intersection,
-                          const BaseGridViewType& base_grid_view,
-                          const ElementType* periodic_neighbor)
+  PeriodicIntersectionImp(BaseType base_intersection, const PeriodicNeighborType* periodic_neighbor)
     : BaseType(base_intersection)
     , periodic_neighbor_(periodic_neighbor)
   {
-    if (periodic_neighbor_)
-      intersection_in_outside_ = find_intersection_in_outside(base_grid_view);
   }
 
   //! \brief Default constructor
   PeriodicIntersectionImp()
     : BaseType()
+    , periodic_neighbor_(nullptr)
   {
   }
 
@@ -403,49 +504,26 @@ public:
   ElementType outside() const
   {
     if (periodic_neighbor_)
-      return *periodic_neighbor_;
+      return periodic_neighbor_->outside;
     return ElementType(BaseType::outside());
   } // ... outside() const
 
   LocalGeometry geometryInOutside() const
   {
     if (periodic_neighbor_)
-      return intersection_in_outside_->geometryInInside();
+      return periodic_neighbor_->geometry_in_outside;
     return BaseType::geometryInOutside();
   } // ... geometryInOutside() const
 
   int indexInOutside() const
   {
     if (periodic_neighbor_)
-      return intersection_in_outside_->indexInInside();
+      return periodic_neighbor_->index_in_outside;
     return BaseType::indexInOutside();
   } // int indexInOutside() const
 
-private:
-  // tries to find intersection in outside (works only if this intersection is on the periodic boundary)
-  template <class BaseGridViewType>
-  std::shared_ptr<const BaseType> find_intersection_in_outside(const BaseGridViewType& base_grid_view) const
-  {
-    const auto coords = this->geometry().center();
-    // walk over outside intersections and find an intersection on the boundary that differs only in one coordinate
-    for (const BaseType& other_intersection : Dune::intersections(base_grid_view, *periodic_neighbor_)) {
-      if (other_intersection.boundary()) {
-        const auto coord_diff = other_intersection.geometry().center() - coords;
-        size_t coord_diff_count = 0;
-        for (const auto& entry : coord_diff)
-          if (Common::FloatCmp::ne(entry, 0.))
-            ++coord_diff_count;
-        if (coord_diff_count == 1)
-          return std::make_shared<const BaseType>(other_intersection);
-      }
-    }
-    DUNE_THROW(Dune::InvalidStateException, "Could not find outside intersection!");
-    return nullptr;
-  } // ... find_intersection_in_outside() const
-
 protected:
-  const ElementType* periodic_neighbor_;
-  std::shared_ptr<const BaseType> intersection_in_outside_;
+  const PeriodicNeighborType* periodic_neighbor_;
 }; // ... class PeriodicIntersectionImp ...
 
 
@@ -453,7 +531,8 @@ protected:
  *
  * PeriodicIntersectionIterator is derived from the IntersectionIterator of the underlying grid view and behaves
  * exactly like the underlying IntersectionIterator except that it returns a PeriodicIntersection in its operator* and
- * operator-> methods.
+ * operator-> methods. It is given the (few) periodic neighbors of its element, among which the one of the current
+ * intersection is found by a linear scan over the local face numbers, and does not allocate.
  *
  * \see PeriodicGridView
  */
@@ -469,32 +548,32 @@ public:
   using BaseIntersectionType = typename BaseType::Intersection;
   using Intersection = Dune::Intersection<extract_grid_t<BaseGridViewImp>, IntersectionImp>;
   using ElementType = extract_entity_t<BaseGridViewType, 0>;
-  using ElementPtrVectorType = std::vector<std::shared_ptr<const ElementType>>;
+  using PeriodicNeighborType = typename IntersectionImp::PeriodicNeighborType;
 
   PeriodicIntersectionIterator(BaseType base_intersection_iterator,
-                               const BaseGridViewType& base_grid_view,
-                               const ElementType& element,
-                               const ElementPtrVectorType* periodic_neighbors)
+                               const std::pair<const PeriodicNeighborType*, const PeriodicNeighborType*>&
+                                   periodic_neighbors)
     : BaseType(base_intersection_iterator)
-    , base_grid_view_(base_grid_view)
-    , element_(element)
-    , has_boundary_intersections_(element_.hasBoundaryIntersections())
-    , periodic_neighbors_(periodic_neighbors)
-    , current_intersection_(nullptr)
+    , periodic_neighbors_begin_(periodic_neighbors.first)
+    , periodic_neighbors_end_(periodic_neighbors.second)
   {
   }
 
   PeriodicIntersectionIterator(const ThisType& other)
     : BaseType(other)
-    , base_grid_view_(other.base_grid_view_)
-    , element_(other.element_)
-    , has_boundary_intersections_(other.has_boundary_intersections_)
-    , periodic_neighbors_(other.periodic_neighbors_)
-    , current_intersection_(nullptr)
+    , periodic_neighbors_begin_(other.periodic_neighbors_begin_)
+    , periodic_neighbors_end_(other.periodic_neighbors_end_)
   {
   }
 
-  ThisType& operator=(const ThisType& other) = default;
+  ThisType& operator=(const ThisType& other)
+  {
+    BaseType::operator=(other);
+    periodic_neighbors_begin_ = other.periodic_neighbors_begin_;
+    periodic_neighbors_end_ = other.periodic_neighbors_end_;
+    current_intersection_.reset();
+    return *this;
+  }
 
   PeriodicIntersectionIterator(ThisType&& other) noexcept = default;
   ThisType& operator=(ThisType&& other) noexcept = default;
@@ -502,33 +581,35 @@ public:
   // methods that differ from BaseType
   Intersection operator*() const
   {
-    return *create_current_intersection();
+    return Intersection(create_current_intersection());
   }
 
   const Intersection* operator->() const
   {
-    current_intersection_ = create_current_intersection();
-    return current_intersection_.get();
+    current_intersection_.emplace(create_current_intersection());
+    return &(*current_intersection_);
   }
 
 private:
   // create current intersection without checking if this is the end iterator
-  auto create_current_intersection() const
+  IntersectionImp create_current_intersection() const
   {
     const auto base_intersection = BaseType::operator*();
-    const int index = base_intersection.indexInInside();
-    assert(!has_boundary_intersections_ || periodic_neighbors_->size() > static_cast<size_t>(index));
-    return std::make_unique<const Intersection>(
-        IntersectionImp(base_intersection,
-                        base_grid_view_,
-                        has_boundary_intersections_ ? (*periodic_neighbors_)[index].get() : nullptr));
+    const PeriodicNeighborType* periodic_neighbor = nullptr;
+    if (periodic_neighbors_begin_ != periodic_neighbors_end_) {
+      const int index = base_intersection.indexInInside();
+      for (auto neighbor = periodic_neighbors_begin_; neighbor != periodic_neighbors_end_; ++neighbor)
+        if (neighbor->index_in_inside == index) {
+          periodic_neighbor = neighbor;
+          break;
+        }
+    }
+    return IntersectionImp(base_intersection, periodic_neighbor);
   } // ... create_current_intersection() const
 
-  const BaseGridViewType& base_grid_view_;
-  const ElementType& element_;
-  const bool has_boundary_intersections_;
-  const ElementPtrVectorType* periodic_neighbors_;
-  mutable std::unique_ptr<const Intersection> current_intersection_;
+  const PeriodicNeighborType* periodic_neighbors_begin_;
+  const PeriodicNeighborType* periodic_neighbors_end_;
+  mutable std::optional<Intersection> current_intersection_;
 }; // ... class PeriodicIntersectionIterator ...
 
 
@@ -655,7 +736,7 @@ public:
   using IndexType = typename Traits::IndexSet::IndexType;
   using DomainType = typename BaseIntersectionType::GlobalCoordinate;
   using Intersection = Dune::Intersection<Grid, PeriodicIntersectionImp<BaseIntersectionType>>;
-  using ElementPtrVectorType = std::vector<std::shared_ptr<const ElementType>>;
+  using PeriodicNeighborTableType = PeriodicNeighborTable<BaseType>;
   static constexpr size_t dimDomain = BaseType::dimension;
   static constexpr size_t num_geometries = GlobalGeometryTypeIndex::size(dimDomain);
 
@@ -726,8 +807,7 @@ public:
     }
 
     // initialize variables
-    boundary_entity_to_periodic_neighbors_maps_ =
-        std::make_shared<std::array<std::unordered_map<IndexType, ElementPtrVectorType>, num_geometries>>();
+    periodic_neighbors_ = std::make_shared<PeriodicNeighborTableType>();
     entity_counts_ = std::make_shared<std::array<size_t, dimDomain + 1>>();
     type_counts_ = std::make_shared<std::array<size_t, num_geometries>>();
     entities_to_skip_ = std::make_shared<std::array<std::unordered_set<IndexType>, num_geometries>>();
@@ -744,7 +824,7 @@ public:
                                                        *type_counts_,
                                                        *entities_to_skip_,
                                                        *new_indices_,
-                                                       *boundary_entity_to_periodic_neighbors_maps_);
+                                                       *periodic_neighbors_);
     // create index_set
     index_set_ = std::make_shared<IndexSet>(BaseType::indexSet(), *entity_counts_, *type_counts_, *new_indices_);
   }
@@ -799,39 +879,27 @@ public:
 
   IntersectionIterator ibegin(const typename Codim<0>::Entity& entity) const
   {
-    const auto& type_index = GlobalGeometryTypeIndex::index(entity.type());
-    assert(!entity.hasBoundaryIntersections()
-           || (*boundary_entity_to_periodic_neighbors_maps_)[type_index].count(index_set_->index(entity)));
-    return IntersectionIterator(
-        BaseType::ibegin(entity),
-        *this,
-        entity,
-        entity.hasBoundaryIntersections()
-            ? &(*boundary_entity_to_periodic_neighbors_maps_)[type_index][index_set_->index(entity)]
-            : nullptr);
-
-  } // ... ibegin(...)
+    return IntersectionIterator(BaseType::ibegin(entity), periodic_neighbors_of(entity));
+  }
 
   IntersectionIterator iend(const typename Codim<0>::Entity& entity) const
   {
-    const auto& type_index = GlobalGeometryTypeIndex::index(entity.type());
-    assert(!entity.hasBoundaryIntersections()
-           || (*boundary_entity_to_periodic_neighbors_maps_)[type_index].count(index_set_->index(entity)));
-    return IntersectionIterator(
-        BaseType::iend(entity),
-        *this,
-        entity,
-        entity.hasBoundaryIntersections()
-            ? &(*boundary_entity_to_periodic_neighbors_maps_)[type_index][index_set_->index(entity)]
-            : nullptr);
-  } // ... iend(...)
+    return IntersectionIterator(BaseType::iend(entity), periodic_neighbors_of(entity));
+  }
 
 private:
-  // For each geometry type in the grid, contains a map from boundary_entities to periodic neighbors
-  // The ElementPtrVector contains pointers to the periodic neighbor entity for each intersection (nullptr for
-  // non-boundary intersections)
-  std::shared_ptr<std::array<std::unordered_map<IndexType, ElementPtrVectorType>, num_geometries>>
-      boundary_entity_to_periodic_neighbors_maps_;
+  std::pair<const typename PeriodicNeighborTableType::NeighborType*,
+            const typename PeriodicNeighborTableType::NeighborType*>
+  periodic_neighbors_of(const typename Codim<0>::Entity& entity) const
+  {
+    if (!entity.hasBoundaryIntersections())
+      return {nullptr, nullptr};
+    return periodic_neighbors_->neighbors_of(GlobalGeometryTypeIndex::index(entity.type()),
+                                             BaseType::indexSet().index(entity));
+  }
+
+  // the periodic neighbors of all elements with intersections on a periodic boundary
+  std::shared_ptr<PeriodicNeighborTableType> periodic_neighbors_;
   std::bitset<dimDomain> periodic_directions_;
   // number of entities for each codimension
   std::shared_ptr<std::array<size_t, dimDomain + 1>> entity_counts_;
@@ -863,9 +931,10 @@ private:
  * The indexSet() method returns a PeriodicIndexSet which returns the same index for entities that are periodically
  * equivalent. Consequently, the PeriodicIndexSet is usually smaller than the IndexSet. The size(...) methods return
  * the corresponding sizes of the PeriodicIndexSet
- * In the constructor, PeriodicGridViewWrapper will build a map mapping intersections on a periodic boundary to the
- * corresponding outside entity. Further, periodically equivalent entities will be identified and given the same index.
- * Thus, the construction may take quite some time as several grid walks have to be done.
+ * In the constructor, PeriodicGridViewWrapper will build a flat table of the periodic neighbors (outside entity, index
+ * and geometry in outside) of all intersections on a periodic boundary, so that iterating over the intersections
+ * does not allocate and only scans the few periodic neighbors of each element. Further, periodically equivalent entities will be identified and given the same
+ * index. Thus, the construction may take quite some time as several grid walks have to be done.
  * By default, all coordinate directions will be made periodic. By supplying a std::bitset< dimension > you can decide
  * for each direction whether it should be periodic (1 means periodic, 0 means 'behave like underlying grid view in
  * that direction').
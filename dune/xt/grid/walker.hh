@@ -22,13 +22,16 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include <dune/common/version.hh>
 
 #include <dune/grid/common/rangegenerators.hh>
+#include <dune/xt/grid/parallel/partitioning/colored.hh>
 #include <dune/xt/grid/parallel/partitioning/ranged.hh>
 
 #include <dune/xt/common/memory.hh>
+#include <dune/xt/common/parallel/conflict-free-scope.hh>
 #include <dune/xt/common/parallel/threadmanager.hh>
 #include <dune/xt/common/parallel/threadstorage.hh>
 #include <dune/xt/common/ranges.hh>
@@ -677,6 +680,68 @@ public:
       clear();
   } // ... tbb_walk(...)
 
+  /**
+   * \brief Walks the grid color by color, processing all elements of one color in parallel.
+   *
+   * Since no two elements of the same color share a vertex (see ColoredPartitioning), functors which only write DoFs
+   * associated with the element they are applied to (and, if the coloring includes face neighbors, with the outside
+   * element of its intersections) can not produce concurrent write conflicts. All elements are thus processed within a
+   * Common::ConflictFreeScope, in which the dune-xt-la containers skip the locks of their single-entry updates.
+   *
+   * \note The coloring is only valid for the grid view it was created for and has to be recreated after the grid
+   *       changed.
+   */
+  void walk_colored(const ColoredPartitioning<GridViewType>& coloring, const bool clear_functors = true)
+  {
+    // prepare functors
+    prepare();
+
+    // only do something, if we have to
+    if ((element_functor_wrappers_->size() + intersection_functor_wrappers_->size()
+         + element_and_intersection_functor_wrappers_->size())
+        > 0) {
+      for (size_t cc = 0; cc < coloring.colors(); ++cc) {
+        const auto& seeds = coloring.color(cc);
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, seeds.size()),
+                          [&](const tbb::blocked_range<std::size_t>& range) {
+                            // isolated, so that this thread can not pick up unrelated tasks (e.g., of another walk)
+                            // while waiting within a functor, which would then run without locks as well
+                            tbb::this_task_arena::isolate([&]() {
+                              [[maybe_unused]] const Common::ConflictFreeScope conflict_free_scope;
+                              auto& element_functor_wrappers = *element_functor_wrappers_;
+                              auto& intersection_functor_wrappers = *intersection_functor_wrappers_;
+                              auto& element_and_intersection_functor_wrappers =
+                                  *element_and_intersection_functor_wrappers_;
+                              for (std::size_t ee = range.begin(); ee != range.end(); ++ee)
+                                walk_element(coloring.element(seeds[ee]),
+                                             element_functor_wrappers,
+                                             intersection_functor_wrappers,
+                                             element_and_intersection_functor_wrappers);
+                            });
+                          });
+      }
+    }
+
+    // finalize functors
+    finalize();
+
+    if (clear_functors)
+      clear();
+  } // ... walk_colored(...)
+
+  /**
+   * \brief Creates a suitable ColoredPartitioning and walks the grid color by color, \sa walk_colored above.
+   *
+   * Face neighbors are only taken into account in the coloring if intersection functors are present.
+   */
+  void walk_colored(const bool clear_functors = true)
+  {
+    const bool include_face_neighbors =
+        (stored_intersection_functor_wrappers_.size() + stored_element_and_intersection_functor_wrappers_.size()) > 0;
+    const ColoredPartitioning<GridViewType> coloring(grid_view_, include_face_neighbors);
+    walk_colored(coloring, clear_functors);
+  }
+
   template <class ElementRange>
   void walk_range(const ElementRange& element_range)
   {
@@ -690,31 +755,38 @@ public:
 #else
     for (auto&& element : element_range) {
 #endif
-      // apply element functors
-      apply_local(element, element_functor_wrappers, element_and_intersection_functor_wrappers);
-
-      // only walk the intersections, if there are codim1 functors present
-      if ((intersection_functor_wrappers.size() + element_and_intersection_functor_wrappers.size()) > 0) {
-        for (auto&& intersection : intersections(grid_view_, element)) {
-          if (intersection.neighbor()) {
-            const auto neighbor = intersection.outside();
-            apply_local(intersection,
-                        element,
-                        neighbor,
-                        intersection_functor_wrappers,
-                        element_and_intersection_functor_wrappers);
-          } else
-            apply_local(intersection,
-                        element,
-                        element,
-                        intersection_functor_wrappers,
-                        element_and_intersection_functor_wrappers);
-        } // walk the intersections
-      } // only walk the intersections, if there are codim1 functors present
+      walk_element(element,
+                   element_functor_wrappers,
+                   intersection_functor_wrappers,
+                   element_and_intersection_functor_wrappers);
     } // .. walk elements
   } // ... walk_range(...)
 
 protected:
+  // applies all functors to the element and (if there are codim1 functors present) to its intersections
+  void walk_element(const ElementType& element,
+                    std::list<internal::ElementFunctorWrapper<GridViewType>>& element_functor_wrappers,
+                    std::list<internal::IntersectionFunctorWrapper<GridViewType>>& intersection_functor_wrappers,
+                    std::list<internal::ElementAndIntersectionFunctorWrapper<GridViewType>>&
+                        element_and_intersection_functor_wrappers)
+  {
+    // apply element functors
+    apply_local(element, element_functor_wrappers, element_and_intersection_functor_wrappers);
+
+    // only walk the intersections, if there are codim1 functors present
+    if ((intersection_functor_wrappers.size() + element_and_intersection_functor_wrappers.size()) > 0) {
+      for (auto&& intersection : intersections(grid_view_, element)) {
+        if (intersection.neighbor()) {
+          const auto neighbor = intersection.outside();
+          apply_local(
+              intersection, element, neighbor, intersection_functor_wrappers, element_and_intersection_functor_wrappers);
+        } else
+          apply_local(
+              intersection, element, element, intersection_functor_wrappers, element_and_intersection_functor_wrappers);
+      } // walk the intersections
+    } // only walk the intersections, if there are codim1 functors present
+  } // ... walk_element(...)
+
   GridViewType grid_view_;
   // We want each thread to have its own copy of each functor. However, as we do not know in advance how many different
   // threads we will have (even if DXTC_CONFIG["threading.max_count"] is set, there may be only max_threads at a time,
@@ -17,6 +17,9 @@
 #ifndef DUNE_XT_LA_CONTAINER_COMMON_MATRIX_SPARSE_HH
 #define DUNE_XT_LA_CONTAINER_COMMON_MATRIX_SPARSE_HH
 
+#include <algorithm>
+#include <limits>
+
 #include <dune/xt/common/matrix.hh>
 
 #include <dune/xt/la/container/interfaces.hh>
@@ -357,6 +360,41 @@ public:
     entries_->operator[](get_entry_index(rr, cc)) += value;
   }
 
+  /**
+   * \brief Variant of MatrixInterface::add_to_entries which locks and accesses each row once.
+   *
+   * The column indices need not be sorted, so each entry is still found by a binary search within its row.
+   */
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    const size_t rows_end = std::min(num_rows, size_t(row_indices.size()));
+    const size_t cols_end = std::min(num_cols, size_t(col_indices.size()));
+    auto& entries = *entries_;
+    const auto& row_pointers = *row_pointers_;
+    const auto column_indices_begin = column_indices_->begin();
+    for (size_t ii = 0; ii < rows_end; ++ii) {
+      const size_t rr = row_indices[ii];
+      const auto row_begin = column_indices_begin + row_pointers[rr];
+      const auto row_end = column_indices_begin + row_pointers[rr + 1];
+      const auto& local_row = local_matrix[ii];
+      [[maybe_unused]] const internal::LockGuard lock(*mutexes_, rr, rows());
+      for (size_t jj = 0; jj < cols_end; ++jj) {
+        const size_t cc = col_indices[jj];
+        const auto entry_it = std::lower_bound(row_begin, row_end, cc);
+        DUNE_THROW_IF(entry_it == row_end || *entry_it != cc,
+                      Common::Exceptions::index_out_of_range,
+                      "Entry is not in the sparsity pattern!");
+        entries[std::distance(column_indices_begin, entry_it)] += scaling * local_row[jj];
+      }
+    }
+  } // ... add_to_entries(...)
+
   inline ScalarType get_entry(const size_t rr, const size_t cc) const
   {
     const size_t index = get_entry_index(rr, cc, false);
@@ -884,6 +922,32 @@ public:
     entries_->operator[](get_entry_index(rr, cc)) += value;
   }
 
+  /**
+   * \brief Variant of MatrixInterface::add_to_entries which locks each row once.
+   *
+   * The entries of a row are not stored contiguously, so each entry is still found by a binary search within its
+   * column.
+   */
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    const size_t rows_end = std::min(num_rows, size_t(row_indices.size()));
+    const size_t cols_end = std::min(num_cols, size_t(col_indices.size()));
+    auto& entries = *entries_;
+    for (size_t ii = 0; ii < rows_end; ++ii) {
+      const size_t rr = row_indices[ii];
+      const auto& local_row = local_matrix[ii];
+      [[maybe_unused]] const internal::LockGuard lock(*mutexes_, rr, rows());
+      for (size_t jj = 0; jj < cols_end; ++jj)
+        entries[get_entry_index(rr, col_indices[jj])] += scaling * local_row[jj];
+    }
+  } // ... add_to_entries(...)
+
   inline ScalarType get_entry(const size_t rr, const size_t cc) const
   {
     const size_t index = get_entry_index(rr, cc, false);
@@ -1327,6 +1391,20 @@ public:
     sparse_ ? sparse_matrix_.add_to_entry(rr, cc, value) : dense_matrix_.add_to_entry(rr, cc, value);
   }
 
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    if (sparse_)
+      sparse_matrix_.add_to_entries(row_indices, col_indices, local_matrix, scaling, num_rows, num_cols);
+    else
+      dense_matrix_.add_to_entries(row_indices, col_indices, local_matrix, scaling, num_rows, num_cols);
+  }
+
   inline ScalarType get_entry(const size_t rr, const size_t cc) const
   {
     return sparse_ ? sparse_matrix_.get_entry(rr, cc) : dense_matrix_.get_entry(rr, cc);
@@ -533,6 +533,20 @@ public:
     backend() -= other.backend();
   } // ... isub(...)
 
+  void lincomb(const std::vector<ScalarType>& coeffs, const std::vector<const ThisType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(size(), data(), coeffs, [&](const size_t jj) { return vectors[jj]->data(); }, false);
+  }
+
+  void multi_axpy(const std::vector<ScalarType>& coeffs, const std::vector<const ThisType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(size(), data(), coeffs, [&](const size_t jj) { return vectors[jj]->data(); }, true);
+  }
+
   // without these using declarations, the free operator+/* function in xt/common/vector.hh is chosen instead of the
   // member function
   using InterfaceType::operator+;
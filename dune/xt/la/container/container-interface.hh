@@ -26,6 +26,7 @@
 #include <dune/xt/common/crtp.hh>
 #include <dune/xt/common/math.hh>
 #include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/parallel/conflict-free-scope.hh>
 #include <dune/xt/la/type_traits.hh>
 
 namespace Dune::XT::LA {
@@ -50,12 +51,14 @@ struct VectorLockGuard
 }; // VectorLockGuard
 
 
+/// \brief Locks the mutex responsible for entry ii, unless there are no mutexes or we are in a ConflictFreeScope.
 struct LockGuard
 {
   LockGuard(std::vector<std::mutex>& mutexes, const size_t ii, const size_t container_size)
     : mutexes_(mutexes)
+    , locked_(!mutexes_.empty() && !Common::ConflictFreeScope::active())
   {
-    if (!mutexes_.empty()) {
+    if (locked_) {
       index_ = ii * mutexes_.size() / container_size;
       mutexes_[index_].lock();
     }
@@ -63,11 +66,12 @@ struct LockGuard
 
   ~LockGuard()
   {
-    if (!mutexes_.empty())
+    if (locked_)
       mutexes_[index_].unlock();
   }
 
   std::vector<std::mutex>& mutexes_;
+  const bool locked_;
   size_t index_;
 }; // LockGuard
 
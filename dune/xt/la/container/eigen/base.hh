@@ -281,6 +281,22 @@ public:
     this->template isub<Traits>(other);
   }
 
+  void lincomb(const std::vector<ScalarType>& coeffs, const std::vector<const VectorImpType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(
+        size(), backend().data(), coeffs, [&](const size_t jj) { return vectors[jj]->backend().data(); }, false);
+  }
+
+  void multi_axpy(const std::vector<ScalarType>& coeffs, const std::vector<const VectorImpType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(
+        size(), backend().data(), coeffs, [&](const size_t jj) { return vectors[jj]->backend().data(); }, true);
+  }
+
   using InterfaceType::add;
   using InterfaceType::sub;
   using InterfaceType::operator+;
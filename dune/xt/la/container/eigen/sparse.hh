@@ -16,6 +16,8 @@
 #ifndef DUNE_XT_LA_CONTAINER_EIGEN_SPARSE_HH
 #define DUNE_XT_LA_CONTAINER_EIGEN_SPARSE_HH
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -340,6 +342,53 @@ public:
     backend().coeffRef(static_cast<EIGEN_size_t>(ii), static_cast<EIGEN_size_t>(jj)) += value;
   }
 
+  /**
+   * \brief Variant of MatrixInterface::add_to_entries which locks and looks up each row once.
+   *
+   * Works directly on the compressed storage (throws if an entry is not in the sparsity pattern), falls back to
+   * coeffRef() if the backend is not compressed.
+   */
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    using StorageIndex = typename BackendType::StorageIndex;
+    const size_t rows_end = std::min(num_rows, size_t(row_indices.size()));
+    const size_t cols_end = std::min(num_cols, size_t(col_indices.size()));
+    auto& mat = backend();
+    const bool compressed = mat.isCompressed();
+    const auto* outer_index = mat.outerIndexPtr();
+    const auto* inner_index = mat.innerIndexPtr();
+    auto* values = mat.valuePtr();
+    for (size_t ii = 0; ii < rows_end; ++ii) {
+      const size_t rr = row_indices[ii];
+      assert(rr < rows());
+      const auto& local_row = local_matrix[ii];
+      [[maybe_unused]] const internal::LockGuard lock(*mutexes_, rr, rows());
+      if (compressed) {
+        const auto* row_begin = inner_index + outer_index[rr];
+        const auto* row_end = inner_index + outer_index[rr + 1];
+        for (size_t jj = 0; jj < cols_end; ++jj) {
+          const auto entry_it = std::lower_bound(row_begin, row_end, static_cast<StorageIndex>(col_indices[jj]));
+          DUNE_THROW_IF(entry_it == row_end || static_cast<size_t>(*entry_it) != col_indices[jj],
+                        Common::Exceptions::index_out_of_range,
+                        "Entry (" << rr << ", " << col_indices[jj] << ") is not in the sparsity pattern!");
+          values[entry_it - inner_index] += scaling * local_row[jj];
+        }
+      } else {
+        for (size_t jj = 0; jj < cols_end; ++jj) {
+          assert(these_are_valid_indices(rr, col_indices[jj]));
+          mat.coeffRef(static_cast<EIGEN_size_t>(rr), static_cast<EIGEN_size_t>(col_indices[jj])) +=
+              scaling * local_row[jj];
+        }
+      }
+    }
+  } // ... add_to_entries(...)
+
   void set_entry(const size_t ii, const size_t jj, const ScalarType& value)
   {
     assert(these_are_valid_indices(ii, jj));
@@ -17,6 +17,8 @@
 #ifndef DUNE_XT_LA_CONTAINER_ISTL_HH
 #define DUNE_XT_LA_CONTAINER_ISTL_HH
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 #include <initializer_list>
@@ -350,6 +352,27 @@ public:
     backend() -= other.backend();
   } // ... isub(...)
 
+  // the entries of a BlockVector of FieldVector<S, 1> are stored contiguously
+  void lincomb(const std::vector<ScalarType>& coeffs, const std::vector<const ThisType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    if (size() == 0)
+      return;
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(
+        size(), &(backend()[0][0]), coeffs, [&](const size_t jj) { return &(vectors[jj]->backend()[0][0]); }, false);
+  }
+
+  void multi_axpy(const std::vector<ScalarType>& coeffs, const std::vector<const ThisType*>& vectors) final
+  {
+    this->check_lincomb_arguments(coeffs, vectors);
+    if (size() == 0)
+      return;
+    [[maybe_unused]] const internal::VectorLockGuard guard(*mutexes_);
+    internal::fused_lincomb(
+        size(), &(backend()[0][0]), coeffs, [&](const size_t jj) { return &(vectors[jj]->backend()[0][0]); }, true);
+  }
+
   /// \}
 
   // without these using declarations, the free operator+/* function in xt/common/vector.hh is chosen instead of the
@@ -629,6 +652,35 @@ public:
     backend()[ii][jj][0][0] += value;
   }
 
+  /**
+   * \brief Variant of MatrixInterface::add_to_entries which locks and accesses each row once.
+   *
+   * The column indices need not be sorted, so each entry is still found by a binary search within its row.
+   */
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    const size_t rows_end = std::min(num_rows, size_t(row_indices.size()));
+    const size_t cols_end = std::min(num_cols, size_t(col_indices.size()));
+    auto& mat = backend();
+    for (size_t ii = 0; ii < rows_end; ++ii) {
+      const size_t rr = row_indices[ii];
+      assert(rr < rows());
+      auto& row = mat[rr];
+      const auto& local_row = local_matrix[ii];
+      [[maybe_unused]] const internal::LockGuard lock(*mutexes_, rr, rows());
+      for (size_t jj = 0; jj < cols_end; ++jj) {
+        assert(these_are_valid_indices(rr, col_indices[jj]));
+        row[col_indices[jj]][0][0] += scaling * local_row[jj];
+      }
+    }
+  } // ... add_to_entries(...)
+
   void set_entry(const size_t ii, const size_t jj, const ScalarType& value)
   {
     assert(these_are_valid_indices(ii, jj));
@@ -16,6 +16,7 @@
 #ifndef DUNE_XT_LA_CONTAINER_MATRIX_INTERFACE_HH
 #define DUNE_XT_LA_CONTAINER_MATRIX_INTERFACE_HH
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <iostream>
@@ -178,6 +179,31 @@ public:
     return result;
   }
 
+  /**
+   * \brief Adds scaling * local_matrix[ii][jj] to the entry (row_indices[ii], col_indices[jj]), for all ii < num_rows
+   *        and jj < num_cols (the sizes of row_indices and col_indices by default).
+   *
+   * This is the scatter of a local (e.g., element) matrix into this matrix. This default implementation simply calls
+   * add_to_entry() for each entry. Derived classes with a sparse storage should shadow it by a variant which looks up
+   * each row only once and takes at most one lock per row.
+   *
+   * \note Since this is not virtual, the derived variant is only called if the matrix is used as the derived type.
+   */
+  template <class RowIndicesType, class ColIndicesType, class LocalMatrixType>
+  void add_to_entries(const RowIndicesType& row_indices,
+                      const ColIndicesType& col_indices,
+                      const LocalMatrixType& local_matrix,
+                      const ScalarType& scaling = ScalarType(1),
+                      const size_t num_rows = std::numeric_limits<size_t>::max(),
+                      const size_t num_cols = std::numeric_limits<size_t>::max())
+  {
+    const size_t rows_end = std::min(num_rows, size_t(row_indices.size()));
+    const size_t cols_end = std::min(num_cols, size_t(col_indices.size()));
+    for (size_t ii = 0; ii < rows_end; ++ii)
+      for (size_t jj = 0; jj < cols_end; ++jj)
+        this->as_imp().add_to_entry(row_indices[ii], col_indices[jj], scaling * local_matrix[ii][jj]);
+  } // ... add_to_entries(...)
+
   using BaseType::operator*;
 
   template <class XX>
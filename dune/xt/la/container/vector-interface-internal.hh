@@ -15,8 +15,11 @@
 #ifndef DUNE_XT_LA_CONTAINER_VECTOR_INTERFACE_INTERNAL_HH
 #define DUNE_XT_LA_CONTAINER_VECTOR_INTERFACE_INTERNAL_HH
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include <dune/xt/common/type_traits.hh>
 #include <dune/xt/common/crtp.hh>
@@ -159,6 +162,41 @@ private:
 }; // class VectorOutputIterator
 
 
+/**
+ * \brief Computes result[ii] = (accumulate ? result[ii] : 0) + sum_jj coeffs[jj] * data(jj)[ii] for 0 <= ii < size.
+ *
+ * Works on blocks of entries, which stay in cache while the contributions of all vectors are added, so that each
+ * vector is read once and result is written once, and the innermost loops run over contiguous memory (and are thus
+ * vectorized by the compiler). The block is accumulated in a buffer on the stack, so result may coincide with any of
+ * the data(jj).
+ */
+template <class ScalarType, class DataAccessorType>
+void fused_lincomb(const size_t size,
+                   ScalarType* result,
+                   const std::vector<ScalarType>& coeffs,
+                   const DataAccessorType& data,
+                   const bool accumulate)
+{
+  static constexpr size_t block_size = 256;
+  std::array<ScalarType, block_size> block;
+  const size_t num_vectors = coeffs.size();
+  for (size_t begin = 0; begin < size; begin += block_size) {
+    const size_t length = std::min(block_size, size - begin);
+    if (accumulate)
+      std::copy_n(result + begin, length, block.begin());
+    else
+      std::fill_n(block.begin(), length, ScalarType(0));
+    for (size_t jj = 0; jj < num_vectors; ++jj) {
+      const ScalarType coeff = coeffs[jj];
+      const ScalarType* values = data(jj) + begin;
+      for (size_t kk = 0; kk < length; ++kk)
+        block[kk] += coeff * values[kk];
+    }
+    std::copy_n(block.begin(), length, result + begin);
+  }
+} // ... fused_lincomb(...)
+
+
 } // namespace internal
 } // namespace Dune::XT::LA
 
@@ -453,6 +453,38 @@ public:
       add_to_entry(ii, neg_one * other.get_unchecked_ref(ii));
   } // ... isub(...)
 
+  /**
+   *  \brief  Fused linear combination, this = sum_jj coeffs[jj] * vectors[jj], without temporary vectors.
+   *  \note   this may be contained in vectors.
+   *  \note   If you override this method please use exceptions instead of assertions (for the python bindings).
+   */
+  virtual void lincomb(const std::vector<ScalarType>& coeffs, const std::vector<const derived_type*>& vectors)
+  {
+    check_lincomb_arguments(coeffs, vectors);
+    for (size_t ii = 0; ii < size(); ++ii) {
+      ScalarType value(0);
+      for (size_t jj = 0; jj < vectors.size(); ++jj)
+        value += coeffs[jj] * vectors[jj]->get_unchecked_ref(ii);
+      set_entry(ii, value);
+    }
+  } // ... lincomb(...)
+
+  /**
+   *  \brief  Fused multi-axpy, this += sum_jj coeffs[jj] * vectors[jj], without temporary vectors.
+   *  \note   this may be contained in vectors.
+   *  \note   If you override this method please use exceptions instead of assertions (for the python bindings).
+   */
+  virtual void multi_axpy(const std::vector<ScalarType>& coeffs, const std::vector<const derived_type*>& vectors)
+  {
+    check_lincomb_arguments(coeffs, vectors);
+    for (size_t ii = 0; ii < size(); ++ii) {
+      ScalarType value(0);
+      for (size_t jj = 0; jj < vectors.size(); ++jj)
+        value += coeffs[jj] * vectors[jj]->get_unchecked_ref(ii);
+      add_to_entry(ii, value);
+    }
+  } // ... multi_axpy(...)
+
   using BaseType::operator*;
 
   /**
@@ -607,6 +639,19 @@ public:
   }
 
 protected:
+  void check_lincomb_arguments(const std::vector<ScalarType>& coeffs,
+                               const std::vector<const derived_type*>& vectors) const
+  {
+    DUNE_THROW_IF(coeffs.size() != vectors.size(),
+                  Common::Exceptions::shapes_do_not_match,
+                  "coeffs.size() = " << coeffs.size() << "\n   vectors.size() = " << vectors.size());
+    for (const auto& vector : vectors)
+      DUNE_THROW_IF(vector->size() != size(),
+                    Common::Exceptions::shapes_do_not_match,
+                    "The size of one of the vectors (" << vector->size() << ") does not match the size of this ("
+                                                       << size() << ")!");
+  } // ... check_lincomb_arguments(...)
+
   template <class T, class S>
   derived_type as_derived(const VectorInterface<T, S>& other) const
   {
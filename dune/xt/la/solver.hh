@@ -22,6 +22,7 @@
 #include <dune/xt/common/matrix.hh>
 #include <dune/xt/common/parallel/helper.hh>
 
+#include <dune/xt/la/container/vector-array/list.hh>
 #include <dune/xt/la/exceptions.hh>
 #include <dune/xt/la/type_traits.hh>
 
@@ -50,6 +51,59 @@ public:
 };
 
 
+/**
+ * \brief Copy of the sparsity pattern and the values of a compressed sparse matrix.
+ *
+ * Used by the solvers to decide whether a cached factorization (or its symbolic part) is still valid: comparing two
+ * snapshots is exact and as cheap as hashing the entries, i.e., O(nnz), which is negligible compared to factorizing.
+ *
+ * Fill it by calling push_back() for each nonzero entry of an outer (row or column) and finish_outer() after each
+ * outer.
+ */
+template <class S>
+class SparseMatrixSnapshot
+{
+public:
+  SparseMatrixSnapshot()
+    : outer_offsets_(1, 0)
+  {
+  }
+
+  void clear()
+  {
+    outer_offsets_.assign(1, 0);
+    inner_indices_.clear();
+    values_.clear();
+  }
+
+  void push_back(const size_t inner_index, const S& value)
+  {
+    inner_indices_.push_back(inner_index);
+    values_.push_back(value);
+  }
+
+  void finish_outer()
+  {
+    outer_offsets_.push_back(inner_indices_.size());
+  }
+
+  bool same_pattern(const SparseMatrixSnapshot& other) const
+  {
+    return outer_offsets_ == other.outer_offsets_ && inner_indices_ == other.inner_indices_;
+  }
+
+  bool same_values(const SparseMatrixSnapshot& other) const
+  {
+    return same_pattern(other) && values_ == other.values_;
+  }
+
+private:
+  std::vector<size_t> outer_offsets_;
+  std::vector<size_t> inner_indices_;
+  std::vector<S> values_;
+}; // class SparseMatrixSnapshot
+
+
 } // namespace internal
 
 
@@ -191,6 +245,35 @@ solve(const MatrixInterface<M, S>& A,
 }
 
 
+/**
+ * \brief Solves A*x = b for each vector b in rhs with the same solver, i.e. a direct solver only factorizes A once.
+ *
+ * Therefore, 'cache_factorization' is enabled for all solver types which support it (regardless of opts).
+ *
+ * The ii-th vector of solution holds the solution for the ii-th vector of rhs (and is used as initial guess by
+ * iterative solvers), missing vectors are appended to solution with the notes of the respective vectors of rhs.
+ */
+template <class M, class C, class V>
+void solve(const Solver<M, C>& solver,
+           const ListVectorArray<V>& rhs,
+           ListVectorArray<V>& solution,
+           const Common::Configuration& opts = Solver<M, C>::options())
+{
+  DUNE_THROW_IF(solution.dim() != rhs.dim(),
+                Common::Exceptions::shapes_do_not_match,
+                "solution.dim() = " << solution.dim() << "\n   rhs.dim() = " << rhs.dim());
+  for (size_t ii = solution.length(); ii < rhs.length(); ++ii)
+    solution.append(V(rhs.dim(), 0.), rhs[ii].note());
+  auto actual_opts = opts;
+  if (actual_opts.has_key("cache_factorization")
+      || (opts.has_key("type")
+          && Solver<M, C>::options(opts.get<std::string>("type")).has_key("cache_factorization")))
+    actual_opts.set("cache_factorization", "1", /*overwrite=*/true);
+  for (size_t ii = 0; ii < rhs.length(); ++ii)
+    solver.apply(rhs[ii].vector(), solution[ii].vector(), actual_opts);
+} // ... solve(...)
+
+
 } // namespace Dune::XT::LA
 
 #include "solver/common.hh"
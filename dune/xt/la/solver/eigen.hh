@@ -22,6 +22,8 @@
 #include <sstream>
 #include <cmath>
 #include <complex>
+#include <memory>
+#include <mutex>
 
 #include <dune/xt/common/disable_warnings.hh>
 #include <Eigen/Dense>
@@ -300,11 +302,14 @@ public:
     iterative_options += default_options;
     // direct solvers
     if (tp == "lu.sparse" || tp == "qr.sparse" || tp == "lu.umfpack" || tp == "spqr" || tp == "llt.cholmodsupernodal"
-        || tp == "superlu")
+        || tp == "superlu") {
+      default_options.set("cache_factorization", "0");
       return default_options;
+    }
     // * for symmetric matrices
     if (tp == "ldlt.simplicial" || tp == "llt.simplicial") {
       default_options.set("pre_check_symmetry", "1e-8");
+      default_options.set("cache_factorization", "0");
       return default_options;
     }
     // iterative solvers
@@ -323,6 +328,11 @@ public:
  *  \note qr.sparse will copy the matrix to column major
  *  \note ldlt.simplicial will copy the matrix to column major
  *  \note llt.simplicial will copy the matrix to column major
+ *  \note If 'cache_factorization' is set (off by default), the direct solvers (lu.sparse, qr.sparse, ldlt.simplicial,
+ *        llt.simplicial) keep their factorization and compare the matrix (which is only referenced) with the
+ *        factorized one in each call to apply(): if pattern and values coincide, only the triangular solves are
+ *        carried out, if only the values changed, the symbolic analysis of the pattern is reused. Since the check
+ *        copies the matrix, enable it only if the same matrix is used repeatedly.
  */
 template <class S, class CommunicatorType>
 class Solver<EigenRowMajorSparseMatrix<S>, CommunicatorType> : protected internal::SolverUtils
@@ -336,14 +346,28 @@ public:
 private:
   using EIGEN_size_t = typename MatrixType::BackendType::Index;
 
+  struct FactorizationCache
+  {
+    std::mutex mutex;
+    std::string type;
+    internal::SparseMatrixSnapshot<S> factorized_matrix;
+    internal::SparseMatrixSnapshot<S> current_matrix;
+    std::unique_ptr<::Eigen::SparseLU<ColMajorBackendType>> lu;
+    std::unique_ptr<::Eigen::SparseQR<ColMajorBackendType, ::Eigen::COLAMDOrdering<int>>> qr;
+    std::unique_ptr<::Eigen::SimplicialLDLT<ColMajorBackendType>> ldlt;
+    std::unique_ptr<::Eigen::SimplicialLLT<ColMajorBackendType>> llt;
+  }; // struct FactorizationCache
+
 public:
   explicit Solver(const MatrixType& matrix)
     : matrix_(matrix)
+    , cache_(std::make_unique<FactorizationCache>())
   {
   }
 
   Solver(const MatrixType& matrix, const CommunicatorType& /*communicator*/)
     : matrix_(matrix)
+    , cache_(std::make_unique<FactorizationCache>())
   {
   }
 
@@ -486,41 +510,13 @@ public:
       solution.backend() = solver.solve(rhs.backend());
       info = solver.info();
     } else if (type == "lu.sparse") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
-      using SolverType = ::Eigen::SparseLU<ColMajorBackendType>;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_direct(cache_->lu, type, rhs, solution, opts, default_opts);
     } else if (type == "qr.sparse") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
-      using SolverType = ::Eigen::SparseQR<ColMajorBackendType, ::Eigen::COLAMDOrdering<int>>;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_direct(cache_->qr, type, rhs, solution, opts, default_opts);
     } else if (type == "ldlt.simplicial") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
-      using SolverType = ::Eigen::SimplicialLDLT<ColMajorBackendType>;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_direct(cache_->ldlt, type, rhs, solution, opts, default_opts);
     } else if (type == "llt.simplicial") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
-      using SolverType = ::Eigen::SimplicialLLT<ColMajorBackendType>;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_direct(cache_->llt, type, rhs, solution, opts, default_opts);
       // #if HAVE_UMFPACK
       //     } else if (type == "lu.umfpack") {
       //       using SolverType = ::Eigen::UmfPackLU< typename MatrixType::BackendType >;
@@ -619,7 +615,53 @@ public:
   } // ... apply(...)
 
 private:
+  template <class SolverType, class T1, class T2>
+  ::Eigen::ComputationInfo apply_direct(std::unique_ptr<SolverType>& cached_solver,
+                                        const std::string& type,
+                                        const EigenBaseVector<T1, S>& rhs,
+                                        EigenBaseVector<T2, S>& solution,
+                                        const Common::Configuration& opts,
+                                        const Common::Configuration& default_opts) const
+  {
+    if (!opts.get("cache_factorization", default_opts.get<bool>("cache_factorization"))) {
+      ColMajorBackendType colmajor_copy(matrix_.backend());
+      colmajor_copy.makeCompressed();
+      SolverType solver;
+      solver.analyzePattern(colmajor_copy);
+      solver.factorize(colmajor_copy);
+      solution.backend() = solver.solve(rhs.backend());
+      return solver.info();
+    }
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    auto& snapshot = cache_->current_matrix;
+    snapshot.clear();
+    using InnerIterator = typename MatrixType::BackendType::InnerIterator;
+    for (EIGEN_size_t ii = 0; ii < matrix_.backend().outerSize(); ++ii) {
+      for (InnerIterator it(matrix_.backend(), ii); it; ++it)
+        snapshot.push_back(it.index(), it.value());
+      snapshot.finish_outer();
+    }
+    const bool same_pattern = cached_solver && type == cache_->type && snapshot.same_pattern(cache_->factorized_matrix);
+    if (!same_pattern || !snapshot.same_values(cache_->factorized_matrix)) {
+      cache_->type.clear();
+      ColMajorBackendType colmajor_copy(matrix_.backend());
+      colmajor_copy.makeCompressed();
+      if (!same_pattern) {
+        cached_solver = std::make_unique<SolverType>();
+        cached_solver->analyzePattern(colmajor_copy);
+      }
+      cached_solver->factorize(colmajor_copy);
+      if (cached_solver->info() != ::Eigen::Success)
+        return cached_solver->info();
+      std::swap(cache_->factorized_matrix, snapshot);
+      cache_->type = type;
+    }
+    solution.backend() = cached_solver->solve(rhs.backend());
+    return cached_solver->info();
+  } // ... apply_direct(...)
+
   const MatrixType& matrix_;
+  std::unique_ptr<FactorizationCache> cache_;
 }; // class Solver
 
 
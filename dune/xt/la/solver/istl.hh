@@ -18,6 +18,8 @@
 
 #include <type_traits>
 #include <cmath>
+#include <memory>
+#include <mutex>
 
 #include <dune/istl/operators.hh>
 #include <dune/istl/preconditioners.hh>
@@ -146,6 +148,10 @@ public:
       iterative_options.set("preconditioner.anisotropy_dim", "2"); // <- this should be the dimDomain of the problem!
       iterative_options.set("preconditioner.isotropy_dim", "2"); // <- this as well
       iterative_options.set("preconditioner.verbose", "0");
+      if (tp.substr(0, 13) == "bicgstab.amg.") {
+        iterative_options.set("preconditioner.reuse", "unchanged");
+        iterative_options.set("preconditioner.reuse_max_iterations", "0");
+      }
       return iterative_options;
     }
     if (tp == "bicgstab.ilut" || tp == "bicgstab.ssor") {
@@ -155,10 +161,12 @@ public:
 #if HAVE_UMFPACK
     }
     if (tp == "umfpack") {
+      general_opts.set("cache_factorization", "0");
       return general_opts;
 #endif
 #if HAVE_SUPERLU
     } else if (tp == "superlu") {
+      general_opts.set("cache_factorization", "0");
       return general_opts;
 #endif
     } else
@@ -168,7 +176,17 @@ public:
 }; // class SolverOptions
 
 
-/// \brief Linear solver for an IstlRowMajorSparseMatrix using dune-istl backends.
+/**
+ * \brief Linear solver for an IstlRowMajorSparseMatrix using dune-istl backends.
+ *
+ * \note If 'cache_factorization' is set (off by default), the direct solvers (umfpack, superlu) keep the factorization
+ *       of the matrix and only carry out the triangular solves in subsequent calls to apply(), as long as the matrix
+ *       (which is only referenced) has the same pattern and values (which is checked in each call). The dune-istl
+ *       wrappers do not allow to reuse only the symbolic factorization, so the matrix is factorized anew from scratch
+ *       if any value changed. Since the check copies the matrix, enable it only if the same matrix is used repeatedly.
+ * \note The bicgstab.amg.* solvers keep their AMG hierarchy between calls to apply(), \sa AmgApplicator for the
+ *       'preconditioner.reuse' options.
+ */
 template <class S, class CommunicatorType>
 class Solver<IstlRowMajorSparseMatrix<S>, CommunicatorType> : protected internal::SolverUtils
 {
@@ -176,15 +194,34 @@ public:
   using MatrixType = IstlRowMajorSparseMatrix<S>;
   using R = typename MatrixType::RealType;
 
+private:
+  struct FactorizationCache
+  {
+    std::mutex mutex;
+    std::string type;
+    internal::SparseMatrixSnapshot<S> factorized_matrix;
+    internal::SparseMatrixSnapshot<S> current_matrix;
+#if HAVE_UMFPACK
+    std::unique_ptr<UMFPack<typename MatrixType::BackendType>> umfpack;
+#endif
+#if HAVE_SUPERLU
+    std::unique_ptr<SuperLU<typename MatrixType::BackendType>> superlu;
+#endif
+    std::unique_ptr<AmgApplicator<S, CommunicatorType>> amg;
+  }; // struct FactorizationCache
+
+public:
   explicit Solver(const MatrixType& matrix)
     : matrix_(matrix)
     , communicator_(CommunicatorType())
+    , cache_(std::make_unique<FactorizationCache>())
   {
   }
 
   Solver(const MatrixType& matrix, const CommunicatorType& communicator)
     : matrix_(matrix)
     , communicator_(communicator)
+    , cache_(std::make_unique<FactorizationCache>())
   {
   }
 
@@ -221,6 +258,13 @@ public:
 #endif
   }
 
+  /// \brief Setup and solve timings of the bicgstab.amg.* solvers, \sa AmgApplicator
+  AmgStatistics amg_statistics() const
+  {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
+    return cache_->amg ? cache_->amg->statistics() : AmgStatistics();
+  }
+
   /**
    *  \note does a copy of the rhs
    */
@@ -246,8 +290,10 @@ public:
       IstlDenseVector<S> writable_rhs = rhs.copy();
 
       if (type.substr(0, 13) == "bicgstab.amg.") {
-        solver_result = AmgApplicator<S, CommunicatorType>(matrix_, communicator_.access())
-                            .call(writable_rhs, solution, opts, default_opts, type.substr(13));
+        std::lock_guard<std::mutex> lock(cache_->mutex);
+        if (!cache_->amg)
+          cache_->amg = std::make_unique<AmgApplicator<S, CommunicatorType>>(matrix_, communicator_.access());
+        solver_result = cache_->amg->call(writable_rhs, solution, opts, default_opts, type.substr(13));
       } else if (type == "bicgstab.ilut") {
         auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
         using SequentialPreconditionerType = SeqILU<typename MatrixType::BackendType, IstlVectorType, IstlVectorType>;
@@ -309,16 +355,27 @@ public:
         solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
 #if HAVE_UMFPACK
       } else if (type == "umfpack") {
-        UMFPack<typename MatrixType::BackendType> solver(matrix_.backend(),
-                                                         opts.get("verbose", default_opts.get<int>("verbose")));
-        solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+        std::lock_guard<std::mutex> lock(cache_->mutex);
+        if (!has_current_factorization(type, opts, default_opts)) {
+          cache_->umfpack = std::make_unique<UMFPack<typename MatrixType::BackendType>>(
+              matrix_.backend(), opts.get("verbose", default_opts.get<int>("verbose")));
+          mark_as_factorized(type, opts, default_opts);
+        }
+        cache_->umfpack->apply(solution.backend(), writable_rhs.backend(), solver_result);
+        if (!opts.get("cache_factorization", default_opts.get<bool>("cache_factorization")))
+          cache_->umfpack.reset();
 #endif // HAVE_UMFPACK
 #if HAVE_SUPERLU
       } else if (type == "superlu") {
-        SuperLU<typename MatrixType::BackendType> solver(matrix_.backend(),
-                                                         opts.get("verbose", default_opts.get<int>("verbose")));
-
-        solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+        std::lock_guard<std::mutex> lock(cache_->mutex);
+        if (!has_current_factorization(type, opts, default_opts)) {
+          cache_->superlu = std::make_unique<SuperLU<typename MatrixType::BackendType>>(
+              matrix_.backend(), opts.get("verbose", default_opts.get<int>("verbose")));
+          mark_as_factorized(type, opts, default_opts);
+        }
+        cache_->superlu->apply(solution.backend(), writable_rhs.backend(), solver_result);
+        if (!opts.get("cache_factorization", default_opts.get<bool>("cache_factorization")))
+          cache_->superlu.reset();
 #endif // HAVE_SUPERLU
       } else
         DUNE_THROW(Common::Exceptions::internal_error,
@@ -362,8 +419,39 @@ public:
   } // ... apply(...)
 
 private:
+  // to be called with locked cache_->mutex, takes a snapshot of matrix_ (if caching is enabled)
+  bool has_current_factorization(const std::string& type,
+                                 const Common::Configuration& opts,
+                                 const Common::Configuration& default_opts) const
+  {
+    if (!opts.get("cache_factorization", default_opts.get<bool>("cache_factorization")))
+      return false;
+    auto& snapshot = cache_->current_matrix;
+    snapshot.clear();
+    const auto& backend = matrix_.backend();
+    for (auto row_it = backend.begin(); row_it != backend.end(); ++row_it) {
+      for (auto col_it = row_it->begin(); col_it != row_it->end(); ++col_it)
+        snapshot.push_back(col_it.index(), (*col_it)[0][0]);
+      snapshot.finish_outer();
+    }
+    return type == cache_->type && snapshot.same_values(cache_->factorized_matrix);
+  } // ... has_current_factorization(...)
+
+  // to be called with locked cache_->mutex after has_current_factorization() and a successful factorization
+  void mark_as_factorized(const std::string& type,
+                          const Common::Configuration& opts,
+                          const Common::Configuration& default_opts) const
+  {
+    if (opts.get("cache_factorization", default_opts.get<bool>("cache_factorization"))) {
+      std::swap(cache_->factorized_matrix, cache_->current_matrix);
+      cache_->type = type;
+    } else
+      cache_->type.clear();
+  }
+
   const MatrixType& matrix_;
   const Common::ConstStorageProvider<CommunicatorType> communicator_;
+  std::unique_ptr<FactorizationCache> cache_;
 }; // class Solver
 
 } // namespace Dune::XT::LA
@@ -11,13 +11,17 @@
 //   Tobias Leibner   (2014, 2017 - 2020)
 
 /// \file
-/// \brief Algebraic multigrid preconditioned BiCGStab applicator for IstlRowMajorSparseMatrix.
+/// \brief Algebraic multigrid preconditioned BiCGStab applicator for IstlRowMajorSparseMatrix, reusing its hierarchy.
 
 #ifndef DUNE_XT_LA_SOLVER_ISTL_AMG_HH
 #define DUNE_XT_LA_SOLVER_ISTL_AMG_HH
 
 #include <type_traits>
 #include <cmath>
+#include <memory>
+#include <string>
+
+#include <dune/common/timer.hh>
 
 #include <dune/istl/operators.hh>
 #include <dune/istl/solvers.hh>
@@ -28,156 +32,195 @@
 #include <dune/xt/common/configuration.hh>
 #include <dune/xt/common/parallel/helper.hh>
 #include <dune/xt/la/container/istl.hh>
+#include <dune/xt/la/solver.hh>
 
 #include "preconditioners.hh"
 
 namespace Dune::XT::LA {
 
 
-//! the general, parallel case
-/// \brief Applies an AMG-preconditioned BiCGStab solver to an IstlRowMajorSparseMatrix (general, parallel case).
+/// \brief Setup and solve timings (in seconds) and counters of an AmgApplicator.
+struct AmgStatistics
+{
+  size_t num_setups = 0; //!< full setups of the hierarchy (coarsening and Galerkin products)
+  size_t num_updates = 0; //!< recomputations of the Galerkin products only
+  size_t num_reuses = 0; //!< solves without touching the hierarchy
+  size_t num_retries = 0; //!< solves repeated with a new hierarchy, after a reused one did not converge
+  double setup_time = 0.; //!< accumulated over all calls
+  double solve_time = 0.; //!< accumulated over all calls
+  double last_setup_time = 0.;
+  double last_solve_time = 0.;
+  size_t last_iterations = 0;
+}; // struct AmgStatistics
+
+
+/**
+ * \brief Applies an AMG-preconditioned BiCGStab solver to an IstlRowMajorSparseMatrix, for the parallel and the
+ *        sequential case (given SequentialCommunication).
+ *
+ * The AMG hierarchy is kept between calls to call(), and the option 'preconditioner.reuse' determines what happens
+ * with it if the matrix (which is only referenced) was modified in between:
+ * - 'never': the hierarchy is set up anew in each call (as a stateless applicator would);
+ * - 'unchanged' (default): the hierarchy is only reused if pattern and values of the matrix did not change, yielding
+ *   the same results as 'never';
+ * - 'galerkin': if only the values changed, the aggregates are kept and only the Galerkin products of the coarse
+ *   level matrices are recomputed (the smoothers and the coarse solver keep the old values, as
+ *   Amg::AMG::recalculateHierarchy() does not update them);
+ * - 'lagged': if only the values changed, the hierarchy is reused as is, the Krylov solver always uses the current
+ *   matrix.
+ * In the latter two cases, the hierarchy is set up anew before the next call once a solve with a reused hierarchy
+ * needed more than 'preconditioner.reuse_max_iterations' iterations (if positive), and the solve is repeated with a
+ * new hierarchy if it did not converge. Changing the pattern of the matrix or any of the 'smoother.*' or
+ * 'preconditioner.*' options always triggers a new setup.
+ *
+ * \note Not thread-safe, call() must not be called concurrently.
+ */
 template <class S, class CommunicatorType>
 class AmgApplicator
 {
+  static constexpr bool sequential = std::is_same<CommunicatorType, SequentialCommunication>::value;
   using MatrixType = IstlRowMajorSparseMatrix<S>;
   using R = typename MatrixType::RealType;
   using IstlMatrixType = typename MatrixType::BackendType;
   using IstlVectorType = typename IstlDenseVector<S>::BackendType;
+  using MatrixOperatorType =
+      std::conditional_t<sequential,
+                         MatrixAdapter<IstlMatrixType, IstlVectorType, IstlVectorType>,
+                         OverlappingSchwarzOperator<IstlMatrixType, IstlVectorType, IstlVectorType, CommunicatorType>>;
+  using ScalarProductType = std::conditional_t<sequential,
+                                               SeqScalarProduct<IstlVectorType>,
+                                               OverlappingSchwarzScalarProduct<IstlVectorType, CommunicatorType>>;
+
+  template <class SequentialSmootherType>
+  using SmootherType = std::conditional_t<
+      sequential,
+      SequentialSmootherType,
+      BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType>>;
+
+  template <class SequentialSmootherType>
+  using PreconditionerType =
+      std::conditional_t<sequential,
+                         Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType<SequentialSmootherType>>,
+                         Amg::AMG<MatrixOperatorType,
+                                  IstlVectorType,
+                                  SmootherType<SequentialSmootherType>,
+                                  CommunicatorType>>;
+
+  using Ilu0PreconditionerType = PreconditionerType<SeqILU<IstlMatrixType, IstlVectorType, IstlVectorType, 1>>;
+  using SsorPreconditionerType = PreconditionerType<SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType, 1>>;
 
 public:
   AmgApplicator(const MatrixType& matrix, const CommunicatorType& comm)
     : matrix_(matrix)
     , communicator_(comm)
+    , rebuild_due_(false)
   {
   }
 
+  static std::vector<std::string> reuse_types()
+  {
+    return {"never", "unchanged", "galerkin", "lagged"};
+  }
+
   InverseOperatorResult call(IstlDenseVector<S>& rhs,
                              IstlDenseVector<S>& solution,
                              const Common::Configuration& opts,
                              const Common::Configuration& default_opts,
                              const std::string& smoother_type)
   {
-    // define the matrix operator
-
-    using MatrixOperatorType =
-        OverlappingSchwarzOperator<IstlMatrixType, IstlVectorType, IstlVectorType, CommunicatorType>;
-    MatrixOperatorType matrix_operator(matrix_.backend(), communicator_);
-
-    // define the scalar product
-    OverlappingSchwarzScalarProduct<IstlVectorType, CommunicatorType> scalar_product(communicator_);
-
-    // ILU0 as the smoother for the AMG
-    using SequentialSmootherType_ILU = SeqILU<IstlMatrixType, IstlVectorType, IstlVectorType, 1>;
-    using SmootherType_ILU =
-        BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType_ILU>;
-    typename Amg::SmootherTraits<SmootherType_ILU>::Arguments smoother_parameters_ILU;
-    smoother_parameters_ILU.iterations =
-        opts.get("smoother.iterations", default_opts.get<size_t>("smoother.iterations"));
-    smoother_parameters_ILU.relaxationFactor =
-        opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-    // SSOR as the smoother for the amg
-    using SequentialSmootherType_SSOR = SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType, 1>;
-    using SmootherType_SSOR =
-        BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType_SSOR>;
-    typename Amg::SmootherTraits<SmootherType_SSOR>::Arguments smoother_parameters_SSOR;
-    smoother_parameters_SSOR.iterations =
-        opts.get("smoother.iterations", default_opts.get<size_t>("smoother.iterations"));
-    smoother_parameters_SSOR.relaxationFactor =
-        opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-
-    // define the AMG as the preconditioner for the BiCGStab solver
-    Amg::Parameters amg_parameters(
-        opts.get("preconditioner.max_level", default_opts.get<size_t>("preconditioner.max_level")),
-        opts.get("preconditioner.coarse_target", default_opts.get<size_t>("preconditioner.coarse_target")),
-        opts.get("preconditioner.min_coarse_rate", default_opts.get<R>("preconditioner.min_coarse_rate")),
-        opts.get("preconditioner.prolong_damp", default_opts.get<R>("preconditioner.prolong_damp")));
-    amg_parameters.setDefaultValuesIsotropic(
-        opts.get("preconditioner.isotropy_dim", default_opts.get<size_t>("preconditioner.isotropy_dim")));
-    amg_parameters.setDefaultValuesAnisotropic(
-        opts.get("preconditioner.anisotropy_dim", default_opts.get<size_t>("preconditioner.anisotropy_dim")));
-    amg_parameters.setDebugLevel(opts.get("preconditioner.verbose", default_opts.get<int>("preconditioner.verbose")));
-    Amg::CoarsenCriterion<Amg::UnSymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
-    if (smoother_type == "ilu0") {
-      using PreconditionerType_ILU = Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType_ILU, CommunicatorType>;
-      PreconditionerType_ILU preconditioner(matrix_operator, amg_criterion, smoother_parameters_ILU, communicator_);
-
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(
-          matrix_operator,
-          scalar_product,
-          preconditioner,
-          opts.get("precision", default_opts.get<S>("precision")),
-          opts.get("max_iter", default_opts.get<size_t>("max_iter")),
-#if HAVE_MPI
-          (communicator_.communicator().rank() == 0) ? opts.get("verbose", default_opts.get<int>("verbose")) : 0
-#else // HAVE_MPI
-          opts.get("verbose", default_opts.get<int>("verbose"))
-#endif
-      );
-
-      InverseOperatorResult stats;
-      solver.apply(solution.backend(), rhs.backend(), stats);
-      return stats;
+    DUNE_THROW_IF(smoother_type != "ilu0" && smoother_type != "ssor",
+                  Common::Exceptions::wrong_input_given,
+                  "Unknown smoother requested: " << smoother_type);
+    const auto reuse = opts.get("preconditioner.reuse", default_opts.get<std::string>("preconditioner.reuse"));
+    internal::SolverUtils::check_given(reuse, reuse_types());
+    // decide what to do with the hierarchy
+    Common::Configuration setup_opts({"smoother"}, {smoother_type.c_str()});
+    for (const auto& key : {"smoother.iterations",
+                            "smoother.relaxation_factor",
+                            "preconditioner.max_level",
+                            "preconditioner.coarse_target",
+                            "preconditioner.min_coarse_rate",
+                            "preconditioner.prolong_damp",
+                            "preconditioner.anisotropy_dim",
+                            "preconditioner.isotropy_dim",
+                            "preconditioner.verbose"})
+      setup_opts.set(key, opts.get(key, default_opts.get<std::string>(key)));
+    current_matrix_.clear();
+    if (reuse != "never") {
+      const auto& backend = matrix_.backend();
+      for (auto row_it = backend.begin(); row_it != backend.end(); ++row_it) {
+        for (auto col_it = row_it->begin(); col_it != row_it->end(); ++col_it)
+          current_matrix_.push_back(col_it.index(), (*col_it)[0][0]);
+        current_matrix_.finish_outer();
+      }
     }
-    if (smoother_type == "ssor") {
-      using PreconditionerType_SSOR = Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType_SSOR, CommunicatorType>;
-      PreconditionerType_SSOR preconditioner(matrix_operator, amg_criterion, smoother_parameters_ILU, communicator_);
-
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(
-          matrix_operator,
-          scalar_product,
-          preconditioner,
-          opts.get("precision", default_opts.get<S>("precision")),
-          opts.get("max_iter", default_opts.get<size_t>("max_iter")),
-#if HAVE_MPI
-          (communicator_.communicator().rank() == 0) ? opts.get("verbose", default_opts.get<int>("verbose")) : 0
-#else // HAVE_MPI
-          opts.get("verbose", default_opts.get<int>("verbose"))
-#endif
-      );
-
-      InverseOperatorResult stats;
-      solver.apply(solution.backend(), rhs.backend(), stats);
-      return stats;
+    const bool has_hierarchy =
+        (smoother_type == "ilu0") ? ilu0_preconditioner_ != nullptr : ssor_preconditioner_ != nullptr;
+    const bool values_changed = !current_matrix_.same_values(setup_matrix_);
+    bool setup = reuse == "never" || !has_hierarchy || rebuild_due_ || !(setup_opts == setup_opts_)
+                 || !current_matrix_.same_pattern(setup_matrix_) || (values_changed && reuse == "unchanged");
+    const bool update = !setup && values_changed && reuse == "galerkin";
+    // keep the rhs and the initial guess in case we have to repeat the solve
+    const bool may_retry = !setup && values_changed;
+    std::unique_ptr<IstlDenseVector<S>> rhs_copy;
+    std::unique_ptr<IstlDenseVector<S>> solution_copy;
+    if (may_retry) {
+      rhs_copy = std::make_unique<IstlDenseVector<S>>(rhs);
+      solution_copy = std::make_unique<IstlDenseVector<S>>(solution);
+    }
+    Timer timer;
+    if (setup)
+      setup_hierarchy(opts, default_opts, smoother_type, setup_opts);
+    else if (update)
+      update_hierarchy(smoother_type);
+    else
+      ++statistics_.num_reuses;
+    statistics_.last_setup_time = timer.elapsed();
+    timer.reset();
+    auto result = solve(rhs, solution, opts, default_opts, smoother_type);
+    statistics_.last_solve_time = timer.elapsed();
+    if (may_retry && !result.converged) {
+      ++statistics_.num_retries;
+      // update_hierarchy() already moved the current values to setup_matrix_, setup_hierarchy() expects them back
+      if (update)
+        std::swap(setup_matrix_, current_matrix_);
+      timer.reset();
+      setup_hierarchy(opts, default_opts, smoother_type, setup_opts);
+      statistics_.last_setup_time += timer.elapsed();
+      rhs = *rhs_copy;
+      solution = *solution_copy;
+      timer.reset();
+      result = solve(rhs, solution, opts, default_opts, smoother_type);
+      statistics_.last_solve_time += timer.elapsed();
+      setup = true;
     }
-    DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown smoother requested: " << smoother_type);
+    statistics_.setup_time += statistics_.last_setup_time;
+    statistics_.solve_time += statistics_.last_solve_time;
+    statistics_.last_iterations = result.iterations;
+    const auto max_iterations = opts.get("preconditioner.reuse_max_iterations",
+                                         default_opts.get<size_t>("preconditioner.reuse_max_iterations"));
+    rebuild_due_ = !setup && max_iterations > 0 && size_t(result.iterations) > max_iterations;
+    return result;
   } // ... call(...)
-protected:
-  const MatrixType& matrix_;
-  const CommunicatorType& communicator_;
-};
 
-//! specialization for our faux type \ref SequentialCommunication
-/// \brief Applies an AMG-preconditioned BiCGStab solver to an IstlRowMajorSparseMatrix (sequential case).
-template <class S>
-class AmgApplicator<S, SequentialCommunication>
-{
-  using MatrixType = IstlRowMajorSparseMatrix<S>;
-  using R = typename MatrixType::RealType;
-  using IstlMatrixType = typename MatrixType::BackendType;
-  using IstlVectorType = typename IstlDenseVector<S>::BackendType;
-
-public:
-  AmgApplicator(const MatrixType& matrix, const SequentialCommunication& comm)
-    : matrix_(matrix)
-    , communicator_(comm)
+  const AmgStatistics& statistics() const
   {
+    return statistics_;
   }
 
-  InverseOperatorResult call(IstlDenseVector<S>& rhs,
-                             IstlDenseVector<S>& solution,
-                             const Common::Configuration& opts,
-                             const Common::Configuration& default_opts,
-                             const std::string& smoother_type)
+private:
+  void setup_hierarchy(const Common::Configuration& opts,
+                       const Common::Configuration& default_opts,
+                       const std::string& smoother_type,
+                       const Common::Configuration& setup_opts)
   {
-    using MatrixOperatorType = MatrixAdapter<IstlMatrixType, IstlVectorType, IstlVectorType>;
-    MatrixOperatorType matrix_operator(matrix_.backend());
-
-    // define the scalar product
-    Dune::SeqScalarProduct<typename IstlDenseVector<S>::BackendType> scalar_product;
-
-    // define the AMG as the preconditioner for the BiCGStab solver
+    // drop the old hierarchy first, it references the old operator
+    ilu0_preconditioner_.reset();
+    ssor_preconditioner_.reset();
+    if constexpr (sequential)
+      matrix_operator_ = std::make_unique<MatrixOperatorType>(matrix_.backend());
+    else
+      matrix_operator_ = std::make_unique<MatrixOperatorType>(matrix_.backend(), communicator_);
     Amg::Parameters amg_parameters(
         opts.get("preconditioner.max_level", default_opts.get<int>("preconditioner.max_level")),
         opts.get("preconditioner.coarse_target", default_opts.get<int>("preconditioner.coarse_target")),
@@ -189,51 +232,92 @@ public:
         opts.get("preconditioner.anisotropy_dim", default_opts.get<size_t>("preconditioner.anisotropy_dim")));
     amg_parameters.setDebugLevel(opts.get("preconditioner.verbose", default_opts.get<int>("preconditioner.verbose")));
     Amg::CoarsenCriterion<Amg::UnSymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
+    if (smoother_type == "ilu0")
+      ilu0_preconditioner_ = make_preconditioner<Ilu0PreconditionerType>(opts, default_opts, amg_criterion);
+    else
+      ssor_preconditioner_ = make_preconditioner<SsorPreconditionerType>(opts, default_opts, amg_criterion);
+    setup_opts_ = setup_opts;
+    std::swap(setup_matrix_, current_matrix_);
+    ++statistics_.num_setups;
+  } // ... setup_hierarchy(...)
 
+  template <class P, class CriterionType>
+  std::unique_ptr<P> make_preconditioner(const Common::Configuration& opts,
+                                         const Common::Configuration& default_opts,
+                                         const CriterionType& amg_criterion) const
+  {
+    typename Amg::SmootherTraits<typename P::Smoother>::Arguments smoother_parameters;
+    smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
+    smoother_parameters.relaxationFactor =
+        opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
+    if constexpr (sequential)
+      return std::make_unique<P>(*matrix_operator_, amg_criterion, smoother_parameters);
+    else
+      return std::make_unique<P>(*matrix_operator_, amg_criterion, smoother_parameters, communicator_);
+  }
+
+  void update_hierarchy(const std::string& smoother_type)
+  {
+    if (smoother_type == "ilu0")
+      ilu0_preconditioner_->recalculateHierarchy();
+    else
+      ssor_preconditioner_->recalculateHierarchy();
+    std::swap(setup_matrix_, current_matrix_);
+    ++statistics_.num_updates;
+  }
+
+  InverseOperatorResult solve(IstlDenseVector<S>& rhs,
+                              IstlDenseVector<S>& solution,
+                              const Common::Configuration& opts,
+                              const Common::Configuration& default_opts,
+                              const std::string& smoother_type)
+  {
+    auto scalar_product = make_scalar_product();
+    int verbose = opts.get("verbose", default_opts.get<int>("verbose"));
+#if HAVE_MPI
+    if constexpr (!sequential)
+      verbose = (communicator_.communicator().rank() == 0) ? verbose : 0;
+#endif
     InverseOperatorResult stats;
     if (smoother_type == "ilu0") {
-      using SmootherType = SeqILU<IstlMatrixType, IstlVectorType, IstlVectorType>;
-
-      typename Amg::SmootherTraits<SmootherType>::Arguments smoother_parameters;
-      smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
-      smoother_parameters.relaxationFactor =
-          opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-      using PreconditionerType = Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType>;
-      PreconditionerType preconditioner(matrix_operator, amg_criterion, smoother_parameters);
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(matrix_operator,
+      BiCGSTABSolver<IstlVectorType> solver(*matrix_operator_,
                                             scalar_product,
-                                            preconditioner,
+                                            *ilu0_preconditioner_,
                                             opts.get("precision", default_opts.get<S>("precision")),
                                             opts.get("max_iter", default_opts.get<int>("max_iter")),
-                                            opts.get("verbose", default_opts.get<int>("verbose")));
+                                            verbose);
       solver.apply(solution.backend(), rhs.backend(), stats);
-    } else if (smoother_type == "ssor") {
-      using SmootherType = SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType>;
-
-      typename Amg::SmootherTraits<SmootherType>::Arguments smoother_parameters;
-      smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
-      smoother_parameters.relaxationFactor =
-          opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-      using PreconditionerType = Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType>;
-      PreconditionerType preconditioner(matrix_operator, amg_criterion, smoother_parameters);
-      BiCGSTABSolver<IstlVectorType> solver(matrix_operator,
+    } else {
+      BiCGSTABSolver<IstlVectorType> solver(*matrix_operator_,
                                             scalar_product,
-                                            preconditioner,
+                                            *ssor_preconditioner_,
                                             opts.get("precision", default_opts.get<S>("precision")),
                                             opts.get("max_iter", default_opts.get<int>("max_iter")),
-                                            opts.get("verbose", default_opts.get<int>("verbose")));
+                                            verbose);
       solver.apply(solution.backend(), rhs.backend(), stats);
-    } else {
-      DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown smoother requested: " << smoother_type);
     }
     return stats;
-  } // ... call(...)
+  } // ... solve(...)
+
+  ScalarProductType make_scalar_product() const
+  {
+    if constexpr (sequential)
+      return ScalarProductType();
+    else
+      return ScalarProductType(communicator_);
+  }
 
-protected:
   const MatrixType& matrix_;
-  const SequentialCommunication& communicator_;
-};
+  const CommunicatorType& communicator_;
+  std::unique_ptr<MatrixOperatorType> matrix_operator_;
+  std::unique_ptr<Ilu0PreconditionerType> ilu0_preconditioner_;
+  std::unique_ptr<SsorPreconditionerType> ssor_preconditioner_;
+  Common::Configuration setup_opts_;
+  internal::SparseMatrixSnapshot<S> setup_matrix_;
+  internal::SparseMatrixSnapshot<S> current_matrix_;
+  bool rebuild_due_;
+  AmgStatistics statistics_;
+}; // class AmgApplicator
 
 
 } // namespace Dune::XT::LA
@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -25,6 +26,7 @@
 #include <dune/xt/common/convergence-study.hh>
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/float_cmp.hh>
+#include <dune/xt/common/parallel/threadmanager.hh>
 
 using namespace Dune::XT::Common;
 
@@ -131,6 +133,39 @@ private:
 };
 
 
+//! The QuadraticStudy, with levels which may be computed concurrently (the most expensive one being the coarsest).
+class ConcurrentQuadraticStudy : public QuadraticStudy
+{
+public:
+  bool levels_are_independent() const override
+  {
+    return true;
+  }
+
+  double estimated_work(const size_t refinement_level) const override
+  {
+    return 1. / (double(refinement_level) + 1.);
+  }
+
+  std::pair<std::string, std::map<std::string, std::map<std::string, double>>>
+  compute_level(const size_t refinement_level,
+                const std::vector<std::string>& actual_norms,
+                const std::vector<std::pair<std::string, std::string>>& actual_estimates,
+                const std::vector<std::string>& actual_quantities) override
+  {
+    // QuadraticStudy keeps track of the last level, so we need to guard it
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++num_calls_;
+    return QuadraticStudy::compute_level(refinement_level, actual_norms, actual_estimates, actual_quantities);
+  }
+
+  size_t num_calls_{0};
+
+private:
+  std::mutex mutex_;
+};
+
+
 //! Reports a single quantity under a given name, to drive run()'s header wrapping with different word layouts.
 class NamedQuantityStudy : public MinimalStudy
 {
@@ -319,3 +354,25 @@ GTEST_TEST(ConvergenceStudy, a_vanishing_error_is_reported_as_an_infinite_eoc)
   EXPECT_TRUE(FloatCmp::eq(data.at("norm").at("L_2").at(0), 0.));
   EXPECT_NE(std::string::npos, out.str().find("inf")) << out.str();
 }
+
+
+GTEST_TEST(ConvergenceStudy, independent_levels_give_the_same_results_and_table)
+{
+  const size_t max_threads = threadManager().max_threads();
+  threadManager().set_max_threads(4);
+  QuadraticStudy sequential_study;
+  std::stringstream sequential_out;
+  const auto expected_data = sequential_study.run({}, sequential_out);
+  ConcurrentQuadraticStudy concurrent_study;
+  std::stringstream concurrent_out;
+  const auto actual_data = concurrent_study.run({}, concurrent_out);
+  threadManager().set_max_threads(max_threads);
+  EXPECT_EQ(size_t(3), concurrent_study.num_calls_);
+  for (const std::string category : {"target", "norm", "quantity"})
+    EXPECT_EQ(expected_data.at(category), actual_data.at(category)) << "category = " << category;
+  // each level reports its wall time
+  ASSERT_EQ(1u, actual_data.count("info"));
+  EXPECT_EQ(3u, actual_data.at("info").at("time_level (s)").size());
+  // the rows are printed in order, regardless of the order in which the levels finished
+  EXPECT_EQ(sequential_out.str(), concurrent_out.str());
+}
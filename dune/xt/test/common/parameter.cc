@@ -127,3 +127,49 @@ GTEST_TEST(Parameter, creation_and_report_and_ostreamout)
     EXPECT_EQ(element.second, ss.str());
   }
 } // Parameter, creation_and_report_and_ostreamout
+
+
+GTEST_TEST(Parameter, access_by_handles)
+{
+  Parameter param({{"t", {0.}}, {"dt", {0.}}, {"mu", {1., 2., 3.}}});
+  const auto t = param.handle("t");
+  const auto mu = param.type().handle("mu");
+  EXPECT_EQ("mu", mu.key());
+  EXPECT_EQ(size_t(3), mu.size());
+  param.set(t, 0.5);
+  EXPECT_EQ(std::vector<double>({0.5}), param.get("t"));
+  EXPECT_EQ(3., param.get(mu).at(2));
+  param.set(mu, {4., 5., 6.});
+  EXPECT_EQ(std::vector<double>({4., 5., 6.}), param.get("mu"));
+  EXPECT_THROW(param.set(mu, 1.), Exceptions::parameter_error);
+  EXPECT_THROW(param.set(t, {1., 2.}), Exceptions::parameter_error);
+  // the values of all keys are stored contiguously, in the order of the keys
+  EXPECT_EQ(std::vector<double>({0., 4., 5., 6., 0.5}),
+            std::vector<double>(param.values().begin(), param.values().end()));
+  // handles may be used with parameters of another type, if these contain the key with the same size ...
+  const Parameter other({{"t", {1.}}, {"x", {2.}}});
+  EXPECT_EQ(1., other.get(t)[0]);
+  // ... but not otherwise
+  EXPECT_THROW(other.get(mu), Exceptions::parameter_error);
+  EXPECT_THROW(Parameter("t", {1., 2.}).get(t), Exceptions::parameter_error);
+  EXPECT_THROW(other.get(ParameterHandle()), Exceptions::parameter_error);
+} // Parameter, access_by_handles
+
+
+GTEST_TEST(Parameter, copies_are_independent_and_types_are_shared)
+{
+  // more values than are stored without a heap allocation
+  Parameter param("large", std::vector<double>(20, 1.));
+  param.set("t", {1.});
+  auto copy = param;
+  copy.set(copy.handle("t"), 2.);
+  EXPECT_EQ(1., param.get("t")[0]);
+  EXPECT_EQ(2., copy.get("t")[0]);
+  EXPECT_EQ(param.type(), copy.type());
+  EXPECT_EQ(ParameterType({{"t", 1}, {"large", 20}}), param.type());
+  // changing the size of a key keeps the other values
+  param.set("t", {3., 4.}, /*overwrite=*/true);
+  EXPECT_EQ(std::vector<double>({3., 4.}), param.get("t"));
+  EXPECT_EQ(std::vector<double>(20, 1.), param.get("large"));
+  EXPECT_NE(param.type(), copy.type());
+} // Parameter, copies_are_independent_and_types_are_shared
@@ -0,0 +1,147 @@
+// This file is part of the dune-xt project:
+//   https://zivgitlab.uni-muenster.de/ag-ohlberger/dune-community/dune-xt
+// Copyright 2009-2021 dune-xt developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/test/main.hxx> // <- has to come first, include config.h!
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <dune/xt/functions/expression.hh>
+#include <dune/xt/functions/expression/engine.hh>
+
+using namespace Dune;
+using namespace Dune::XT;
+
+
+namespace {
+
+
+std::vector<FieldVector<double, 2>> make_points(const size_t num_points)
+{
+  std::vector<FieldVector<double, 2>> points(num_points);
+  for (size_t pp = 0; pp < num_points; ++pp)
+    points[pp] = {double(pp) / double(num_points), 1. - 0.5 * double(pp) / double(num_points)};
+  return points;
+}
+
+
+} // namespace
+
+
+GTEST_TEST(MathExpressionBase, evaluate_batch_coincides_with_evaluate)
+{
+  const Functions::MathExpressionBase<double, 2, double, 2> expression("x", {"sin(pi*x[0])*x[1]", "exp(x[0]+x[1])"});
+  // more than one chunk and a partial last chunk
+  const auto points = make_points(150);
+  std::vector<FieldVector<double, 2>> batch_results(points.size());
+  expression.evaluate_batch(points.data(), points.size(), batch_results.data());
+  FieldVector<double, 2> result;
+  for (size_t pp = 0; pp < points.size(); ++pp) {
+    expression.evaluate(points[pp], result);
+    EXPECT_EQ(result, batch_results[pp]) << "pp = " << pp;
+  }
+}
+
+GTEST_TEST(ExpressionFunction, evaluate_batch_coincides_with_evaluate)
+{
+  const Functions::ExpressionFunction<2> function("x", {"1 + x[0]*x[0] + 2*x[1]"}, /*order=*/2);
+  const auto points = make_points(70);
+  std::vector<Functions::ExpressionFunction<2>::RangeReturnType> batch_results(points.size());
+  std::vector<Functions::ExpressionFunction<2>::DomainType> domain_points(points.begin(), points.end());
+  function.evaluate_batch(domain_points.data(), domain_points.size(), batch_results.data());
+  for (size_t pp = 0; pp < points.size(); ++pp)
+    EXPECT_EQ(function.evaluate(domain_points[pp]), batch_results[pp]) << "pp = " << pp;
+}
+
+// the same instance is evaluated concurrently, each thread has to see its own arguments
+GTEST_TEST(MathExpressionBase, concurrent_evaluations_are_independent)
+{
+  const Functions::MathExpressionBase<double, 2, double, 1> expression("x", {"x[0]*x[0] + sin(x[1])"});
+  const auto points = make_points(20000);
+  std::vector<FieldVector<double, 1>> expected(points.size());
+  for (size_t pp = 0; pp < points.size(); ++pp)
+    expression.evaluate(points[pp], expected[pp]);
+  std::atomic<size_t> num_failures(0);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size(), 16), [&](const tbb::blocked_range<size_t>& range) {
+    FieldVector<double, 1> result;
+    for (size_t pp = range.begin(); pp != range.end(); ++pp) {
+      expression.evaluate(points[pp], result);
+      if (result != expected[pp])
+        ++num_failures;
+    }
+  });
+  EXPECT_EQ(num_failures, 0);
+}
+
+/// Points the cache of natively compiled expressions to a fresh private directory, instead of the user's cache.
+struct MathExpressionEngineNative : public ::testing::Test
+{
+  void SetUp() override
+  {
+    cache_dir_ = boost::filesystem::temp_directory_path()
+                 / boost::filesystem::unique_path("dune-xt-expression-engine-test-%%%%-%%%%-%%%%");
+    boost::filesystem::create_directory(cache_dir_);
+    boost::filesystem::permissions(cache_dir_, boost::filesystem::owner_all);
+    setenv("DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_CACHE_DIR", cache_dir_.c_str(), /*overwrite=*/1);
+  }
+
+  void TearDown() override
+  {
+    unsetenv("DUNE_XT_FUNCTIONS_EXPRESSION_NATIVE_CACHE_DIR");
+    boost::filesystem::remove_all(cache_dir_);
+  }
+
+  boost::filesystem::path cache_dir_;
+}; // struct MathExpressionEngineNative
+
+
+TEST_F(MathExpressionEngineNative, evaluation_coincides_with_exprtk)
+{
+  using Functions::internal::MathExpressionEngine;
+  const std::vector<std::string> variables{"x[0]", "x[1]", "t_"};
+  const std::vector<std::string> expressions{"sin(pi*x[0])*x[1] + t_",
+                                             "-x[0]^2 + 2x[1]",
+                                             "exp(x[0])(x[1] - 1) / (1 + abs(t_))",
+                                             "ln(1 + x[1]) * x[0]t_",
+                                             "e^x[1] - x[0]"};
+  const MathExpressionEngine interpreted(variables, expressions);
+  MathExpressionEngine::enable_native_compilation();
+  const MathExpressionEngine native(variables, expressions);
+  // not supported by the translation to C++, has to fall back to ExprTk
+  const MathExpressionEngine fallback(variables, {"if(x[0] < 0.5, x[1], t_)"});
+  MathExpressionEngine::enable_native_compilation(false);
+  EXPECT_FALSE(interpreted.native());
+  EXPECT_FALSE(fallback.native());
+  if (!native.native())
+    GTEST_SKIP() << "native compilation of expressions not available (no C++ compiler?)";
+  std::vector<double> interpreted_results(expressions.size()), native_results(expressions.size());
+  for (const auto& point : make_points(50)) {
+    const std::vector<double> values{point[0], point[1], point[0] - point[1]};
+    interpreted.evaluate(values.data(), values.size(), interpreted_results.data(), interpreted_results.size());
+    native.evaluate(values.data(), values.size(), native_results.data(), native_results.size());
+    for (size_t ii = 0; ii < expressions.size(); ++ii)
+      EXPECT_NEAR(interpreted_results[ii], native_results[ii], 1e-12) << expressions[ii] << " at " << point;
+  }
+}
+
+TEST_F(MathExpressionEngineNative, cache_directory_has_to_be_private)
+{
+  using Functions::internal::MathExpressionEngine;
+  boost::filesystem::permissions(cache_dir_, boost::filesystem::all_all);
+  MathExpressionEngine::enable_native_compilation();
+  const MathExpressionEngine native({"x"}, {"2x + 1"});
+  MathExpressionEngine::enable_native_compilation(false);
+  EXPECT_FALSE(native.native());
+  EXPECT_TRUE(boost::filesystem::is_empty(cache_dir_));
+}
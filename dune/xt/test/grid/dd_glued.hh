@@ -117,6 +117,22 @@ struct GluedDdGridTest : public ::testing::Test
 
   static constexpr Layers local_layer = get_local_layer<LocalGridType>::type;
 
+  template <class G, bool anything = true>
+  struct supports_local_levels
+  {
+    static constexpr bool value = true;
+  };
+
+#  if HAVE_ALBERTA
+
+  template <int d, int dw, bool anything>
+  struct supports_local_levels<AlbertaGrid<d, dw>, anything>
+  {
+    static constexpr bool value = false;
+  };
+
+#  endif
+
   void setup()
   {
     if (!macro_grid_)
@@ -166,6 +182,122 @@ struct GluedDdGridTest : public ::testing::Test
     }
   } // ... couplings_are_of_correct_size(...)
 
+  void prepared_couplings_coincide_with_lazy_couplings()
+  {
+    setup();
+    ASSERT_NE(macro_grid_, nullptr) << "This should not happen!";
+    ASSERT_NE(dd_grid_, nullptr) << "This should not happen!";
+
+    DD::Glued<MacroGridType, LocalGridType, local_layer> prepared_dd_grid(
+        *macro_grid_,
+        Expectations::num_local_refinements(),
+        /*prepare_glues=*/true,
+        /*allow_for_broken_orientation_of_coupling_intersections=*/true);
+    const auto& macro_grid_view = dd_grid_->macro_grid_view();
+    for (auto&& macro_entity : Dune::elements(macro_grid_view)) {
+      for (auto&& macro_intersection : Dune::intersections(macro_grid_view, macro_entity)) {
+        if (macro_intersection.neighbor() && !macro_intersection.boundary()) {
+          const auto macro_neighbor = macro_intersection.outside();
+          const auto& prepared_coupling = prepared_dd_grid.coupling(
+              macro_entity, macro_neighbor, /*allow_for_broken_orientation_of_coupling_intersections=*/true);
+          const auto& lazy_coupling = dd_grid_->coupling(
+              macro_entity, macro_neighbor, /*allow_for_broken_orientation_of_coupling_intersections=*/true);
+          EXPECT_EQ(lazy_coupling.size(), prepared_coupling.size());
+          // a second access returns the same glue
+          EXPECT_EQ(&lazy_coupling,
+                    &dd_grid_->coupling(
+                        macro_entity, macro_neighbor, /*allow_for_broken_orientation_of_coupling_intersections=*/true));
+        }
+      }
+    }
+  } // ... prepared_couplings_coincide_with_lazy_couplings(...)
+
+  void level_couplings_are_kept_per_pair_of_local_levels()
+  {
+    if constexpr (!supports_local_levels<LocalGridType>::value) {
+      GTEST_SKIP() << "Layers::level is not supported for this local grid";
+    } else {
+      setup();
+      ASSERT_NE(macro_grid_, nullptr) << "This should not happen!";
+
+      using LevelDdGridType = DD::Glued<MacroGridType, LocalGridType, Layers::level>;
+      LevelDdGridType level_dd_grid(
+          *macro_grid_,
+          Expectations::num_local_refinements(),
+          /*prepare_glues=*/false,
+          /*allow_for_broken_orientation_of_coupling_intersections=*/true);
+      // request the neighbor levels of each entity level in turn, so the glues of each coupling are moved several times
+      // while the number of local levels in both directions grows
+      std::vector<std::pair<int, int>> local_levels;
+      for (int entity_level = 0; entity_level <= Expectations::num_local_refinements(); ++entity_level)
+        for (int neighbor_level = Expectations::num_local_refinements(); neighbor_level >= 0; --neighbor_level)
+          local_levels.emplace_back(entity_level, neighbor_level);
+      const auto& macro_grid_view = level_dd_grid.macro_grid_view();
+      for (auto&& macro_entity : Dune::elements(macro_grid_view)) {
+        for (auto&& macro_intersection : Dune::intersections(macro_grid_view, macro_entity)) {
+          if (macro_intersection.neighbor() && !macro_intersection.boundary()) {
+            const auto macro_neighbor = macro_intersection.outside();
+            std::vector<const typename LevelDdGridType::GlueType*> glues;
+            for (const auto& [entity_level, neighbor_level] : local_levels)
+              glues.push_back(&level_dd_grid.coupling(macro_entity,
+                                                      entity_level,
+                                                      macro_neighbor,
+                                                      neighbor_level,
+                                                      /*allow_for_broken_orientation_of_coupling_intersections=*/true));
+            for (size_t ii = 0; ii < local_levels.size(); ++ii) {
+              const auto [entity_level, neighbor_level] = local_levels[ii];
+              const auto& coupling =
+                  level_dd_grid.coupling(macro_entity,
+                                         entity_level,
+                                         macro_neighbor,
+                                         neighbor_level,
+                                         /*allow_for_broken_orientation_of_coupling_intersections=*/true);
+              // the glue is kept once created ...
+              EXPECT_EQ(glues[ii], &coupling) << "entity_level: " << entity_level << "\n"
+                                              << "neighbor_level: " << neighbor_level;
+              // ... and couples the requested local level views
+              EXPECT_EQ(coupling.template gridView<0>().indexSet().size(0),
+                        level_dd_grid.local_grid(macro_entity).level_view(entity_level).indexSet().size(0))
+                  << "entity_level: " << entity_level << "\n"
+                  << "neighbor_level: " << neighbor_level;
+              EXPECT_EQ(coupling.template gridView<1>().indexSet().size(0),
+                        level_dd_grid.local_grid(macro_neighbor).level_view(neighbor_level).indexSet().size(0))
+                  << "entity_level: " << entity_level << "\n"
+                  << "neighbor_level: " << neighbor_level;
+            }
+          }
+        }
+      }
+    }
+  } // ... level_couplings_are_kept_per_pair_of_local_levels(...)
+
+  void local_and_global_indices_are_consistent()
+  {
+    if (is_yaspgrid<LocalGridType>::value)
+      GTEST_SKIP() << "The global micro grid requires a GridFactory, which YaspGrid does not provide";
+    setup();
+    ASSERT_NE(macro_grid_, nullptr) << "This should not happen!";
+    ASSERT_NE(dd_grid_, nullptr) << "This should not happen!";
+
+    const auto& local_to_global = dd_grid_->local_to_global_indices();
+    const auto& global_to_local = dd_grid_->global_to_local_indices();
+    ASSERT_EQ(dd_grid_->num_subdomains(), local_to_global.size());
+    size_t num_local_elements = 0;
+    for (size_t ss = 0; ss < local_to_global.size(); ++ss) {
+      num_local_elements += local_to_global[ss].size();
+      for (size_t ii = 0; ii < local_to_global[ss].size(); ++ii) {
+        const auto global_index = local_to_global[ss][ii];
+        ASSERT_LT(global_index, global_to_local.size());
+        EXPECT_EQ(ss, global_to_local[global_index].first);
+        EXPECT_EQ(ii, global_to_local[global_index].second);
+        const auto global_center = dd_grid_->local_to_global_entity(ss, ii).geometry().center();
+        const auto local_center = dd_grid_->global_to_local_entity(global_index).geometry().center();
+        EXPECT_LT((global_center - local_center).infinity_norm(), 1e-12);
+      }
+    }
+    EXPECT_EQ(global_to_local.size(), num_local_elements);
+  } // ... local_and_global_indices_are_consistent(...)
+
   void visualize_is_callable()
   {
     setup();
@@ -140,6 +140,18 @@ TYPED_TEST(GluedDdGridTest, couplings_are_of_correct_size)
 {
   this->couplings_are_of_correct_size();
 }
+TYPED_TEST(GluedDdGridTest, prepared_couplings_coincide_with_lazy_couplings)
+{
+  this->prepared_couplings_coincide_with_lazy_couplings();
+}
+TYPED_TEST(GluedDdGridTest, level_couplings_are_kept_per_pair_of_local_levels)
+{
+  this->level_couplings_are_kept_per_pair_of_local_levels();
+}
+TYPED_TEST(GluedDdGridTest, local_and_global_indices_are_consistent)
+{
+  this->local_and_global_indices_are_consistent();
+}
 TYPED_TEST(GluedDdGridTest, local_grids_are_constructable)
 {
   this->local_grids_are_constructable();
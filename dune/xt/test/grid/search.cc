@@ -50,3 +50,31 @@ TEST_F(InLevelSearch, check)
 {
   this->check();
 }
+
+TEST_F(InLevelSearch, bounding_box_index_finds_the_same_elements)
+{
+  const auto view = grid_provider_.leaf_view();
+  const auto& index_set = view.indexSet();
+  const auto index = Dune::XT::Grid::make_entity_bounding_box_index(view);
+  EXPECT_EQ(index_set.size(0), index.size());
+  using PointType = typename Dune::XT::Grid::EntityBoundingBoxIndex<decltype(view)>::GlobalCoordinateType;
+  std::vector<PointType> centers;
+  for (auto&& element : elements(view))
+    centers.push_back(element.geometry().center());
+  const auto found = index(centers);
+  ASSERT_EQ(centers.size(), found.size());
+  size_t ii = 0;
+  for (auto&& element : elements(view)) {
+    ASSERT_NE(nullptr, found[ii]);
+    EXPECT_EQ(index_set.index(element), index_set.index(*found[ii]));
+    ++ii;
+  }
+  // every vertex lies in some element, no point outside of the domain does
+  for (auto&& vertex : vertices(view)) {
+    typename Dune::XT::Grid::EntityBoundingBoxIndex<decltype(view)>::SeedType seed;
+    EXPECT_TRUE(index.find(vertex.geometry().center(), seed));
+  }
+  const auto outside = index(std::vector<PointType>(1, PointType(1e3)));
+  ASSERT_EQ(size_t(1), outside.size());
+  EXPECT_EQ(nullptr, outside[0]);
+}
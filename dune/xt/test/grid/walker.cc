@@ -11,10 +11,14 @@
 
 #include <dune/xt/test/main.hxx>
 
+#include <set>
+#include <vector>
+
 #include <dune/xt/common/logstreams.hh>
 
 #include <dune/xt/grid/gridprovider/cube.hh>
 #include <dune/xt/grid/functors/boundary-detector.hh>
+#include <dune/xt/grid/parallel/partitioning/colored.hh>
 #include <dune/xt/grid/parallel/partitioning/ranged.hh>
 #include <dune/xt/grid/walker.hh>
 
@@ -65,9 +69,11 @@ struct GridWalkerTest : public ::testing::Test
     auto test3 = [&] { walker.append(counter).walk(true); };
     auto test4 = [&] { walker.append(intersection_counter).walk(false); };
     auto test5 = [&] { walker.append(intersection_counter).walk(true); };
+    auto test6 = [&] { walker.append(counter).walk_colored(); };
+    auto test7 = [&] { walker.append(intersection_counter).walk_colored(); };
 
-    list<function<void()>> element_tests({test1, test2, test3});
-    list<function<void()>> intersection_tests({test4, test5});
+    list<function<void()>> element_tests({test1, test2, test3, test6});
+    list<function<void()>> intersection_tests({test4, test5, test7});
 
     for (const auto& test : element_tests) {
       count = 0;
@@ -186,6 +192,45 @@ struct GridWalkerTest : public ::testing::Test
     EXPECT_EQ(2 * filter_count, detector.result());
   }
 
+  void check_coloring()
+  {
+    const auto gv = grid_prv.grid().leafGridView();
+    const auto& index_set = gv.indexSet();
+    for (const bool include_face_neighbors : {false, true}) {
+      const ColoredPartitioning<GridLayerType> coloring(gv, include_face_neighbors);
+      // each element has exactly one color
+      vector<size_t> element_colors(index_set.size(0), coloring.colors());
+      size_t num_colored = 0;
+      for (size_t cc = 0; cc < coloring.colors(); ++cc) {
+        EXPECT_FALSE(coloring.color(cc).empty());
+        for (const auto& seed : coloring.color(cc)) {
+          const auto ee = index_set.index(coloring.element(seed));
+          EXPECT_EQ(coloring.colors(), element_colors[ee]);
+          element_colors[ee] = cc;
+          ++num_colored;
+        }
+      }
+      EXPECT_EQ(index_set.size(0), num_colored);
+      // no two elements of the same color share a vertex (or a face neighbor, if requested)
+      vector<set<size_t>> vertex_colors(index_set.size(griddim));
+      for (auto&& element : elements(gv)) {
+        const auto color = element_colors[index_set.index(element)];
+        set<size_t> vertices;
+        for (unsigned int ii = 0; ii < element.subEntities(griddim); ++ii)
+          vertices.insert(index_set.subIndex(element, ii, griddim));
+        if (include_face_neighbors)
+          for (auto&& intersection : intersections(gv, element))
+            if (intersection.neighbor()) {
+              const auto neighbor = intersection.outside();
+              for (unsigned int ii = 0; ii < neighbor.subEntities(griddim); ++ii)
+                vertices.insert(index_set.subIndex(neighbor, ii, griddim));
+            }
+        for (const auto& vv : vertices)
+          EXPECT_TRUE(vertex_colors[vv].insert(color).second) << "vertex " << vv << ", color " << color;
+      }
+    }
+  }
+
   void check_walker_to_walker()
   {
     const auto gv = grid_prv.grid().leafGridView();
@@ -229,6 +274,10 @@ TYPED_TEST(GridWalkerTest, boundaries)
   this->check_boundaries();
   this->check_partitioning();
 }
+TYPED_TEST(GridWalkerTest, coloring)
+{
+  this->check_coloring();
+}
 TYPED_TEST(GridWalkerTest, walker_to_walker)
 {
   this->check_walker_to_walker();
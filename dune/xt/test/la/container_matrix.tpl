@@ -111,6 +111,21 @@ struct MatrixTest_{{T_NAME}} : public ::testing::Test
         EXPECT_DOUBLE_OR_COMPLEX_EQ(D_RealType(2 * ii + 2 * jj + 1), d_by_size_and_pattern.get_entry(ii, jj));
       }
     }
+    // only the first two of the three given rows are used
+    const std::vector<size_t> local_rows{2, 0, 3};
+    const std::vector<size_t> local_cols{3, 1};
+    const std::vector<std::vector<D_ScalarType>> local_matrix{{1, 2}, {3, 4}, {5, 6}};
+    d_by_size_and_pattern.add_to_entries(local_rows, local_cols, local_matrix, D_ScalarType(2), /*num_rows=*/2);
+    for (size_t ii = 0; ii < d_rows; ++ii) {
+      for (size_t jj = 0; jj < d_cols; ++jj) {
+        D_RealType expected(2 * ii + 2 * jj + 1);
+        for (size_t kk = 0; kk < 2; ++kk)
+          for (size_t ll = 0; ll < local_cols.size(); ++ll)
+            if (local_rows[kk] == ii && local_cols[ll] == jj)
+              expected += D_RealType(2) * std::real(local_matrix[kk][ll]);
+        EXPECT_DOUBLE_OR_COMPLEX_EQ(expected, d_by_size_and_pattern.get_entry(ii, jj));
+      }
+    }
   } // void fulfills_interface() const
 
   void produces_correct_results() const
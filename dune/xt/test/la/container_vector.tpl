@@ -646,6 +646,35 @@ struct LaContainerVectorTest_{{T_NAME}} : public ::testing::Test
     for (size_t ii = 0; ii < dim; ++ii) {
       EXPECT_TRUE(Common::FloatCmp::eq(ScalarType(1), ones.get_entry(ii))) << "check copy-on-write";
     }
+
+    // test lincomb and multi_axpy
+    VectorImp result_lincomb = zeros;
+    result_lincomb.lincomb({ScalarType(2.75), ScalarType(-0.25)}, {&testvector_3, &countingup});
+    correct_result = testvector_3;
+    correct_result.scal(ScalarType(2.75));
+    correct_result.axpy(ScalarType(-0.25), countingup);
+    EXPECT_EQ(correct_result, result_lincomb);
+    result_lincomb.multi_axpy({ScalarType(-3), ScalarType(1)}, {&testvector_1, &result_lincomb});
+    correct_result.scal(ScalarType(2));
+    correct_result.axpy(ScalarType(-3), testvector_1);
+    EXPECT_EQ(correct_result, result_lincomb);
+    a = ones;
+    a.lincomb({ScalarType(2), ScalarType(1)}, {&testvector_3, &a});
+    a.multi_axpy({ScalarType(2)}, {&testvector_3});
+    for (size_t ii = 0; ii < dim; ++ii) {
+      EXPECT_TRUE(Common::FloatCmp::eq(ScalarType(1), ones.get_entry(ii))) << "check copy-on-write";
+    }
+    EXPECT_THROW(a.lincomb({ScalarType(1)}, {&ones, &ones}), Common::Exceptions::shapes_do_not_match);
+    // more entries than fit into one block of the fused kernels
+    const size_t large_dim = 1000;
+    VectorImp large_ones(large_dim, ScalarType(1));
+    VectorImp large_countingup(large_dim, ScalarType(0));
+    for (size_t ii = 0; ii < large_dim; ++ii)
+      large_countingup.set_entry(ii, ScalarType(ii));
+    VectorImp large_result(large_dim, ScalarType(1));
+    large_result.multi_axpy({ScalarType(0.5), ScalarType(2)}, {&large_countingup, &large_ones});
+    for (size_t ii = 0; ii < large_dim; ++ii)
+      EXPECT_TRUE(Common::FloatCmp::eq(ScalarType(3 + 0.5 * ii), large_result.get_entry(ii))) << "ii = " << ii;
   } // void produces_correct_results() const
 }; // struct LaContainerVectorTest
 
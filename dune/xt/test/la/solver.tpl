@@ -12,11 +12,17 @@
 // This one has to come first (includes the config.h)!
 #include <dune/xt/test/main.hxx>
 
+#include <array>
+#include <map>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/logging.hh>
 #include <dune/xt/la/container.hh>
+#include <dune/xt/la/container/vector-array/list.hh>
 #include <dune/xt/la/solver.hh>
 
 #include <dune/xt/test/la/container.hh>
@@ -76,6 +82,164 @@ struct SolverTest_{{T_NAME}} : public ::testing::Test
       EXPECT_TRUE(XT::Common::FloatCmp::eq(solution, rhs));
     }
   } // ... produces_correct_results(...)
+
+  // solvers may cache a factorization, which has to be recomputed when the (referenced) matrix changes
+  static void picks_up_changes_of_the_matrix()
+  {
+    const size_t dim = 10;
+    MatrixType matrix = ContainerFactory<MatrixType>::create(dim);
+    const RhsType rhs = ContainerFactory<RhsType>::create(dim);
+    RhsType half_rhs = ContainerFactory<RhsType>::create(dim);
+    half_rhs *= 0.5;
+    const SolverType solver(matrix);
+    for (auto type : SolverType::types()) {
+      // the direct solvers only cache their factorization if requested
+      std::vector<Common::Configuration> all_options{SolverType::options(type)};
+      if (all_options[0].has_key("cache_factorization")) {
+        all_options.push_back(all_options[0]);
+        all_options[0].set("cache_factorization", "0", /*overwrite=*/true);
+        all_options[1].set("cache_factorization", "1", /*overwrite=*/true);
+      }
+      for (const auto& options : all_options) {
+        for (size_t ii = 0; ii < dim; ++ii)
+          set_diagonal_entry(matrix, ii, 1.);
+        SolutionType solution = ContainerFactory<SolutionType>::create(dim);
+        solver.apply(rhs, solution, options);
+        EXPECT_TRUE(XT::Common::FloatCmp::eq(solution, rhs)) << options;
+        solver.apply(rhs, solution, options);
+        EXPECT_TRUE(XT::Common::FloatCmp::eq(solution, rhs)) << options;
+        for (size_t ii = 0; ii < dim; ++ii)
+          set_diagonal_entry(matrix, ii, 2.);
+        solver.apply(rhs, solution, options);
+        EXPECT_TRUE(XT::Common::FloatCmp::eq(solution, half_rhs)) << options;
+        if constexpr (is_vector<RhsType>::value && std::is_same<RhsType, SolutionType>::value) {
+          ListVectorArray<RhsType> rhss(dim);
+          rhss.append(rhs);
+          rhss.append(half_rhs);
+          ListVectorArray<SolutionType> solutions(dim);
+          solve(solver, rhss, solutions, options);
+          ASSERT_EQ(size_t(2), solutions.length());
+          EXPECT_TRUE(XT::Common::FloatCmp::eq(solutions[0].vector(), half_rhs)) << options;
+          half_rhs *= 0.5;
+          EXPECT_TRUE(XT::Common::FloatCmp::eq(solutions[1].vector(), half_rhs)) << options;
+          half_rhs *= 2.;
+        }
+      }
+    }
+  } // ... picks_up_changes_of_the_matrix(...)
+
+  static void set_diagonal_entry(MatrixType& matrix, const size_t ii, const double value)
+  {
+    if constexpr (is_matrix<MatrixType>::value)
+      matrix.set_entry(ii, ii, value);
+    else
+      matrix[ii][ii] = value;
+  }
+{% if "IstlRowMajorSparseMatrix" in O_TYPE %}
+
+  // tridiagonal, with the diagonal depending on shift, so that AMG needs a few iterations with a hierarchy set up for
+  // another shift
+  static MatrixType make_amg_test_matrix(const size_t dim, const double shift)
+  {
+    SparsityPatternDefault pattern(dim);
+    for (size_t ii = 0; ii < dim; ++ii) {
+      if (ii > 0)
+        pattern.insert(ii, ii - 1);
+      pattern.insert(ii, ii);
+      if (ii + 1 < dim)
+        pattern.insert(ii, ii + 1);
+    }
+    pattern.sort();
+    MatrixType matrix(dim, dim, pattern);
+    set_amg_test_values(matrix, shift);
+    return matrix;
+  }
+
+  static void set_amg_test_values(MatrixType& matrix, const double shift)
+  {
+    for (size_t ii = 0; ii < matrix.rows(); ++ii) {
+      if (ii > 0)
+        matrix.set_entry(ii, ii - 1, -1.);
+      matrix.set_entry(ii, ii, 2. + shift * double(ii % 5));
+      if (ii + 1 < matrix.rows())
+        matrix.set_entry(ii, ii + 1, -1.);
+    }
+  }
+
+  static void reuses_the_amg_hierarchy_as_requested()
+  {
+    const size_t dim = 50;
+    const RhsType rhs(dim, 1.);
+    // the expected number of setups, updates and reuses of the hierarchy after solving twice with the same matrix and
+    // once with changed values (galerkin and lagged may have to set up a new hierarchy after the last solve)
+    const std::map<std::string, std::array<size_t, 3>> expected_counts{
+        {"never", {{3, 0, 0}}}, {"unchanged", {{2, 0, 1}}}, {"galerkin", {{1, 1, 1}}}, {"lagged", {{1, 0, 2}}}};
+    for (std::string type : {"bicgstab.amg.ssor", "bicgstab.amg.ilu0"}) {
+      for (const auto& [reuse, counts] : expected_counts) {
+        MatrixType matrix = make_amg_test_matrix(dim, 0.);
+        const SolverType solver(matrix);
+        EXPECT_EQ(size_t(0), solver.amg_statistics().num_setups);
+        auto opts = SolverType::options(type);
+        opts.set("preconditioner.reuse", reuse, /*overwrite=*/true);
+        for (size_t ii = 0; ii < 3; ++ii) {
+          if (ii == 2)
+            set_amg_test_values(matrix, 1.);
+          SolutionType solution(dim, 0.);
+          EXPECT_NO_THROW(solver.apply(rhs, solution, opts)) << "type = " << type << ", reuse = " << reuse;
+        }
+        const auto statistics = solver.amg_statistics();
+        EXPECT_EQ(counts[0] + statistics.num_retries, statistics.num_setups) << type << ", " << reuse;
+        EXPECT_EQ(counts[1], statistics.num_updates) << type << ", " << reuse;
+        EXPECT_EQ(counts[2], statistics.num_reuses) << type << ", " << reuse;
+        EXPECT_GT(statistics.last_iterations, size_t(0)) << type << ", " << reuse;
+        EXPECT_GE(statistics.setup_time, statistics.last_setup_time) << type << ", " << reuse;
+        EXPECT_GE(statistics.solve_time, statistics.last_solve_time) << type << ", " << reuse;
+      }
+    }
+  } // ... reuses_the_amg_hierarchy_as_requested(...)
+
+#  if HAVE_SUPERLU || HAVE_UMFPACK
+  // the matrix is smaller than the coarse target, so the hierarchy consists of a direct solver for the values it was
+  // set up with: one iteration suffices for these, but not for other values
+  static void rebuilds_and_retries_the_amg_hierarchy()
+  {
+    const size_t dim = 50;
+    const RhsType rhs(dim, 1.);
+    for (std::string type : {"bicgstab.amg.ssor", "bicgstab.amg.ilu0"}) {
+      MatrixType matrix = make_amg_test_matrix(dim, 0.);
+      const SolverType solver(matrix);
+      auto opts = SolverType::options(type);
+      opts.set("preconditioner.reuse", "lagged", /*overwrite=*/true);
+      opts.set("preconditioner.reuse_max_iterations", "1", /*overwrite=*/true);
+      SolutionType solution(dim, 0.);
+      solver.apply(rhs, solution, opts);
+      EXPECT_EQ(size_t(1), solver.amg_statistics().num_setups) << "type = " << type;
+      EXPECT_LE(solver.amg_statistics().last_iterations, size_t(1)) << "type = " << type;
+      // the lagged hierarchy needs more than reuse_max_iterations iterations, ...
+      set_amg_test_values(matrix, 1.);
+      solution *= 0.;
+      solver.apply(rhs, solution, opts);
+      EXPECT_EQ(size_t(1), solver.amg_statistics().num_setups) << "type = " << type;
+      EXPECT_EQ(size_t(1), solver.amg_statistics().num_reuses) << "type = " << type;
+      EXPECT_GT(solver.amg_statistics().last_iterations, size_t(1)) << "type = " << type;
+      // ... so the next call sets up a new one, although the matrix did not change
+      solution *= 0.;
+      solver.apply(rhs, solution, opts);
+      EXPECT_EQ(size_t(2), solver.amg_statistics().num_setups) << "type = " << type;
+      EXPECT_LE(solver.amg_statistics().last_iterations, size_t(1)) << "type = " << type;
+      // the lagged hierarchy does not converge within max_iter, so the solve is repeated with a new one
+      opts.set("max_iter", "1", /*overwrite=*/true);
+      opts.set("preconditioner.reuse_max_iterations", "0", /*overwrite=*/true);
+      set_amg_test_values(matrix, 2.);
+      solution *= 0.;
+      EXPECT_NO_THROW(solver.apply(rhs, solution, opts)) << "type = " << type;
+      EXPECT_EQ(size_t(3), solver.amg_statistics().num_setups) << "type = " << type;
+      EXPECT_EQ(size_t(1), solver.amg_statistics().num_retries) << "type = " << type;
+      EXPECT_EQ(size_t(2), solver.amg_statistics().num_reuses) << "type = " << type;
+    }
+  } // ... rebuilds_and_retries_the_amg_hierarchy(...)
+#  endif // HAVE_SUPERLU || HAVE_UMFPACK
+{% endif %}
 }; // struct SolverTest
 
 TEST_F(SolverTest_{{T_NAME}}, behaves_correctly)
@@ -83,4 +247,23 @@ TEST_F(SolverTest_{{T_NAME}}, behaves_correctly)
   this->produces_correct_results();
 }
 
+TEST_F(SolverTest_{{T_NAME}}, picks_up_changes_of_the_matrix)
+{
+  this->picks_up_changes_of_the_matrix();
+}
+{% if "IstlRowMajorSparseMatrix" in O_TYPE %}
+
+TEST_F(SolverTest_{{T_NAME}}, reuses_the_amg_hierarchy_as_requested)
+{
+  this->reuses_the_amg_hierarchy_as_requested();
+}
+
+#  if HAVE_SUPERLU || HAVE_UMFPACK
+TEST_F(SolverTest_{{T_NAME}}, rebuilds_and_retries_the_amg_hierarchy)
+{
+  this->rebuilds_and_retries_the_amg_hierarchy();
+}
+#  endif
+{% endif %}
+
 {% endfor %}